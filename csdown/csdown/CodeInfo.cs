@@ -134,13 +134,25 @@ namespace csdown
             string id = f.DeclaringType.FullName + "." + f.Name;
             ParameterInfo[] parms = f.GetParameters();
             if (parms.Length > 0)
-                id += "(" + string.Join(",", parms.Select(p => p.ParameterType.FullName)) + ")";
+                id += "(" + string.Join(",", parms.Select(p => XmlTypeName(p.ParameterType))) + ")";
 
             CodeItem item;
             table.TryGetValue(id, out item);
             return item;
         }
 
+        private static string XmlTypeName(Type t)
+        {
+            // The XML documentation file writes generic types like `System.Span{System.Double}`.
+            if (t.IsGenericType)
+            {
+                string name = t.GetGenericTypeDefinition().FullName;
+                name = name.Substring(0, name.IndexOf('`'));
+                return name + "{" + string.Join(",", t.GetGenericArguments().Select(XmlTypeName)) + "}";
+            }
+            return t.FullName;
+        }
+
         public CodeItem FindField(FieldInfo f)
         {
             string id = f.DeclaringType.FullName + "." + f.Name;
@@ -233,6 +233,13 @@ namespace csdown
             if (t.FullName.StartsWith("CosineKitty."))
                 return CodeInfo.InternalLink(t.Name);
 
+            if (t.IsGenericType)
+            {
+                // For example, `ReadOnlySpan<double>`.
+                string name = t.Name.Substring(0, t.Name.IndexOf('`'));
+                return "`" + name + "<" + string.Join(", ", t.GetGenericArguments().Select(a => TypeMarkdown(a).Trim('`'))) + ">`";
+            }
+
             switch (t.FullName)
             {
                 case "System.Double":
@@ -247,6 +254,9 @@ namespace csdown
                 case "System.Int32":
                     return "`int`";
 
+                case "System.Void":
+                    return "`void`";
+
                 case "System.DateTime":
                     return "`DateTime`";
 
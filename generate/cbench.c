@@ -0,0 +1,394 @@
+/*
+    cbench.c  -  Don Cross <cosinekitty.com>
+
+    C language micro-benchmarks for Astronomy Engine project.
+    https://github.com/cosinekitty/astronomy
+
+    Usage:  cbench [-t seconds] [name_prefix]
+
+    Prints one tab-separated line per benchmark:
+        name    calls   ns_per_call     calls_per_sec
+
+    All inputs are generated from a fixed seed, so results
+    from different builds of Astronomy Engine can be compared directly.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "astronomy.h"
+
+#define NUM_INPUTS  1024
+
+typedef void (* bench_func_t) (int index);
+
+typedef struct
+{
+    const char   *name;
+    bench_func_t  func;
+    astro_body_t  body;
+}
+bench_t;
+
+static astro_time_t     InputTime[NUM_INPUTS];
+static astro_observer_t InputObserver[NUM_INPUTS];
+static double           InputRa[NUM_INPUTS];
+static double           InputDec[NUM_INPUTS];
+static double           InputAlt[NUM_INPUTS];
+static astro_body_t     BenchBody;
+static astro_rotation_ephemeris_t BenchEphem;
+static astro_tracker_t  BenchTracker;
+static volatile double  Sink;       /* keeps the compiler from optimizing away results */
+
+static unsigned long RandomState = 20210101UL;
+
+static double Random(void)
+{
+    /* Simple linear congruential generator, so results are identical on every platform. */
+    RandomState = (RandomState * 1103515245UL + 12345UL) & 0x7fffffffUL;
+    return (double)RandomState / 2147483648.0;
+}
+
+static void InitInputs(void)
+{
+    int i;
+
+    for (i=0; i < NUM_INPUTS; ++i)
+    {
+        /* Times between the years 1900 and 2100. */
+        InputTime[i] = Astronomy_TimeFromDays(-36525.0 + 73050.0*Random());
+        InputObserver[i] = Astronomy_MakeObserver(-60.0 + 120.0*Random(), -180.0 + 360.0*Random(), 1000.0*Random());
+        InputRa[i] = 24.0 * Random();
+        InputDec[i] = -90.0 + 180.0*Random();
+        /* Altitudes between -1 and +89 degrees, where refraction matters. */
+        InputAlt[i] = 44.0 + InputDec[i]/2.0;
+    }
+
+    BenchEphem = Astronomy_MakeRotationEphemeris(InputTime[0], 1.0, InputObserver[0]);
+}
+
+static void BenchHelioVector(int i)
+{
+    Sink = Astronomy_HelioVector(BenchBody, InputTime[i]).x;
+}
+
+static void BenchHelioVectorRaw(int i)
+{
+    double pos[3];
+    Astronomy_HelioVectorRaw(BenchBody, InputTime[i].tt, pos);
+    Sink = pos[0];
+}
+
+static void BenchHelioVectorTol(int i)
+{
+    /* About one arcminute, seen from the Earth at Venus's closest approach. */
+    Sink = Astronomy_HelioVectorTol(BenchBody, InputTime[i], 1.0e-4).x;
+}
+
+static void BenchHelioState(int i)
+{
+    Sink = Astronomy_HelioState(BenchBody, InputTime[i]).vx;
+}
+
+static void BenchGeoVector(int i)
+{
+    Sink = Astronomy_GeoVector(BenchBody, InputTime[i], ABERRATION).x;
+}
+
+static void BenchGeoVectorRaw(int i)
+{
+    double pos[3];
+    Astronomy_GeoVectorRaw(BenchBody, InputTime[i].tt, ABERRATION, pos);
+    Sink = pos[0];
+}
+
+static void BenchEquator(int i)
+{
+    Sink = Astronomy_Equator(BenchBody, &InputTime[i], InputObserver[i], EQUATOR_OF_DATE, ABERRATION).ra;
+}
+
+static void BenchHorizon(int i)
+{
+    Sink = Astronomy_Horizon(&InputTime[i], InputObserver[i], InputRa[i], InputDec[i], REFRACTION_NORMAL).altitude;
+}
+
+static void BenchInverseRefraction(int i)
+{
+    Sink = Astronomy_InverseRefraction(REFRACTION_NORMAL, InputAlt[i]);
+}
+
+static void BenchRefractionBatch(int i)
+{
+    /* The whole input array per call. */
+    static double refr[NUM_INPUTS];
+    (void)i;
+    Astronomy_RefractionBatch(REFRACTION_NORMAL, NUM_INPUTS, InputAlt, refr);
+    Sink = refr[0];
+}
+
+static void BenchInverseRefractionBatch(int i)
+{
+    static double refr[NUM_INPUTS];
+    (void)i;
+    Astronomy_InverseRefractionBatch(REFRACTION_NORMAL, NUM_INPUTS, InputAlt, refr);
+    Sink = refr[0];
+}
+
+static void BenchRotation_EQJ_HOR(int i)
+{
+    Sink = Astronomy_Rotation_EQJ_HOR(InputTime[i], InputObserver[0]).rot[0][0];
+}
+
+static void BenchRotationEphemeris_EQJ_HOR(int i)
+{
+    /* Samples spread across the ephemeris window, as a pointing loop would request them. */
+    astro_time_t time = Astronomy_AddDays(BenchEphem.start, i / (double)NUM_INPUTS);
+    Sink = Astronomy_RotationEphemeris_EQJ_HOR(&BenchEphem, time).rot[0][0];
+}
+
+static void BenchTrackHorizon(int i)
+{
+    /* A 50 Hz sampling rate, so the tracker refits every 10 minutes of simulated time. */
+    static long sample;
+    astro_horizon_t hor;
+    if (BenchTracker.body != BenchBody)
+        BenchTracker = Astronomy_MakeTracker(BenchBody, InputObserver[0], InputTime[0], 10.0 / 1440.0);
+    Astronomy_TrackHorizon(&BenchTracker, Astronomy_AddDays(InputTime[0], (sample++) / (50.0 * 86400.0)), REFRACTION_NORMAL, &hor);
+    Sink = hor.altitude;
+}
+
+static void BenchSearchRiseSet(int i)
+{
+    Sink = Astronomy_SearchRiseSet(BenchBody, InputObserver[i], DIRECTION_RISE, InputTime[i], 2.0).time.ut;
+}
+
+static void BenchSearchMoonPhase(int i)
+{
+    Sink = Astronomy_SearchMoonPhase(90.0 * (i % 4), InputTime[i], 40.0).time.ut;
+}
+
+static void BenchMoonQuarterCalendar(int i)
+{
+    /* One year of lunar quarters per call. */
+    static astro_moon_quarter_t calendar[60];
+    int count;
+    Astronomy_MoonQuarterCalendar(InputTime[i], Astronomy_AddDays(InputTime[i], 365.25), calendar, 60, &count);
+    Sink = calendar[count-1].time.ut;
+}
+
+static void BenchSearchPeakMagnitude(int i)
+{
+    Sink = Astronomy_SearchPeakMagnitude(BODY_VENUS, InputTime[i]).time.ut;
+}
+
+static void BenchSearchPlanetApsis(int i)
+{
+    Sink = Astronomy_SearchPlanetApsis(BenchBody, InputTime[i]).time.ut;
+}
+
+static void BenchSeasons(int i)
+{
+    Sink = Astronomy_Seasons(1900 + (i % 200)).mar_equinox.ut;
+}
+
+static void BenchSearchLunarEclipse(int i)
+{
+    Sink = Astronomy_SearchLunarEclipse(InputTime[i]).peak.ut;
+}
+
+static void BenchSearchGlobalSolarEclipse(int i)
+{
+    Sink = Astronomy_SearchGlobalSolarEclipse(InputTime[i]).peak.ut;
+}
+
+static void BenchSearchLocalSolarEclipse(int i)
+{
+    Sink = Astronomy_SearchLocalSolarEclipse(InputTime[i], InputObserver[i]).peak.time.ut;
+}
+
+static void BenchLocalSolarEclipseBatch(int i)
+{
+    /* One eclipse for 100 observers per call. */
+    static astro_global_solar_eclipse_t eclipse[NUM_INPUTS];
+    static astro_local_solar_eclipse_t local[100];
+    if (eclipse[i].status != ASTRO_SUCCESS || eclipse[i].kind == ECLIPSE_NONE)
+        eclipse[i] = Astronomy_SearchGlobalSolarEclipse(InputTime[i]);
+    Astronomy_LocalSolarEclipseBatch(eclipse[i], 100, &InputObserver[i % (NUM_INPUTS - 100)], local);
+    Sink = local[0].peak.time.ut;
+}
+
+static void BenchEclipseGroundTrack(int i)
+{
+    /* One eclipse sampled every second along its center line per call. */
+    static astro_global_solar_eclipse_t eclipse[NUM_INPUTS];
+    static astro_ground_track_t track[20000];
+    int count;
+    if (eclipse[i].status != ASTRO_SUCCESS || eclipse[i].kind == ECLIPSE_NONE)
+        for (eclipse[i] = Astronomy_SearchGlobalSolarEclipse(InputTime[i]); eclipse[i].kind == ECLIPSE_PARTIAL; )
+            eclipse[i] = Astronomy_NextGlobalSolarEclipse(eclipse[i].peak);
+    Astronomy_EclipseGroundTrack(eclipse[i], 1.0, track, 20000, &count);
+    Sink = track[count/2].latitude;
+}
+
+static void BenchSearchTransit(int i)
+{
+    Sink = Astronomy_SearchTransit(BenchBody, InputTime[i]).peak.ut;
+}
+
+static astro_status_t BenchTransitFunc(void *context, astro_body_t body, const astro_transit_t *transit)
+{
+    (void)context;
+    (void)body;
+    Sink = transit->peak.ut;
+    return ASTRO_SUCCESS;
+}
+
+static void BenchTransitCatalog(int i)
+{
+    /* Ten years of transits per call. */
+    astro_time_t stop = Astronomy_AddDays(InputTime[i], 3652.5);
+    if (BenchBody == BODY_INVALID)
+        Astronomy_TransitCatalogAll(InputTime[i], stop, BenchTransitFunc, NULL);
+    else
+        Astronomy_TransitCatalog(BenchBody, InputTime[i], stop, BenchTransitFunc, NULL);
+}
+
+static void BenchSearchRelativeLongitude(int i)
+{
+    Sink = Astronomy_SearchRelativeLongitude(BenchBody, 0.0, InputTime[i]).time.ut;
+}
+
+static astro_status_t BenchPhenomenonFunc(void *context, const astro_phenomenon_t *phenomenon)
+{
+    (void)context;
+    Sink = phenomenon->time.ut;
+    return ASTRO_SUCCESS;
+}
+
+static void BenchPhenomenaCatalog(int i)
+{
+    /* One year of phenomena for all the planets per call. */
+    astro_time_t stop = Astronomy_AddDays(InputTime[i], 365.25);
+    Astronomy_PhenomenaCatalogAll(InputTime[i], stop, BenchPhenomenonFunc, NULL);
+}
+
+static void BenchConstellation(int i)
+{
+    Sink = Astronomy_Constellation(InputRa[i], InputDec[i]).ra_1875;
+}
+
+#define BODY_BENCH(prefix,func) \
+    { prefix "_Sun",     func, BODY_SUN     }, \
+    { prefix "_Moon",    func, BODY_MOON    }, \
+    { prefix "_Mercury", func, BODY_MERCURY }, \
+    { prefix "_Venus",   func, BODY_VENUS   }, \
+    { prefix "_Mars",    func, BODY_MARS    }, \
+    { prefix "_Jupiter", func, BODY_JUPITER }, \
+    { prefix "_Saturn",  func, BODY_SATURN  }, \
+    { prefix "_Uranus",  func, BODY_URANUS  }, \
+    { prefix "_Neptune", func, BODY_NEPTUNE }, \
+    { prefix "_Pluto",   func, BODY_PLUTO   }
+
+static const bench_t BenchList[] =
+{
+    { "HelioVector_Earth", BenchHelioVector, BODY_EARTH },
+    BODY_BENCH("HelioVector", BenchHelioVector),
+    BODY_BENCH("HelioVectorRaw", BenchHelioVectorRaw),
+    { "HelioVectorTol_Earth", BenchHelioVectorTol, BODY_EARTH },
+    BODY_BENCH("HelioVectorTol", BenchHelioVectorTol),
+    BODY_BENCH("HelioState", BenchHelioState),
+    BODY_BENCH("GeoVector", BenchGeoVector),
+    BODY_BENCH("GeoVectorRaw", BenchGeoVectorRaw),
+    BODY_BENCH("Equator", BenchEquator),
+    { "Horizon",                    BenchHorizon,                   BODY_INVALID },
+    { "InverseRefraction",          BenchInverseRefraction,         BODY_INVALID },
+    { "RefractionBatch_1024",       BenchRefractionBatch,           BODY_INVALID },
+    { "InverseRefractionBatch_1024", BenchInverseRefractionBatch,   BODY_INVALID },
+    { "Rotation_EQJ_HOR",           BenchRotation_EQJ_HOR,          BODY_INVALID },
+    { "RotationEphemeris_EQJ_HOR",  BenchRotationEphemeris_EQJ_HOR, BODY_INVALID },
+    { "TrackHorizon_Moon",          BenchTrackHorizon,              BODY_MOON    },
+    { "TrackHorizon_Mars",          BenchTrackHorizon,              BODY_MARS    },
+    { "SearchRiseSet_Sun",          BenchSearchRiseSet,             BODY_SUN     },
+    { "SearchRiseSet_Moon",         BenchSearchRiseSet,             BODY_MOON    },
+    { "SearchMoonPhase",            BenchSearchMoonPhase,           BODY_INVALID },
+    { "MoonQuarterCalendar_1yr",    BenchMoonQuarterCalendar,       BODY_INVALID },
+    { "SearchPeakMagnitude",        BenchSearchPeakMagnitude,       BODY_VENUS   },
+    { "SearchPlanetApsis_Mars",     BenchSearchPlanetApsis,         BODY_MARS    },
+    { "SearchPlanetApsis_Neptune",  BenchSearchPlanetApsis,         BODY_NEPTUNE },
+    { "Seasons",                    BenchSeasons,                   BODY_INVALID },
+    { "SearchLunarEclipse",         BenchSearchLunarEclipse,        BODY_INVALID },
+    { "SearchGlobalSolarEclipse",   BenchSearchGlobalSolarEclipse,  BODY_INVALID },
+    { "SearchLocalSolarEclipse",    BenchSearchLocalSolarEclipse,   BODY_INVALID },
+    { "LocalSolarEclipseBatch_100", BenchLocalSolarEclipseBatch,    BODY_INVALID },
+    { "EclipseGroundTrack_1s",      BenchEclipseGroundTrack,        BODY_INVALID },
+    { "SearchTransit_Mercury",      BenchSearchTransit,             BODY_MERCURY },
+    { "SearchTransit_Venus",        BenchSearchTransit,             BODY_VENUS   },
+    { "TransitCatalog_10yr",        BenchTransitCatalog,            BODY_MERCURY },
+    { "TransitCatalogAll_10yr",     BenchTransitCatalog,            BODY_INVALID },
+    { "SearchRelativeLongitude_Mars", BenchSearchRelativeLongitude, BODY_MARS    },
+    { "PhenomenaCatalogAll_1yr",    BenchPhenomenaCatalog,          BODY_INVALID },
+    { "Constellation",              BenchConstellation,             BODY_INVALID }
+};
+
+#define NUM_BENCHMARKS  (sizeof(BenchList) / sizeof(BenchList[0]))
+
+static void RunBenchmark(const bench_t *bench, double min_seconds)
+{
+    long calls = 0;
+    clock_t start, elapsed;
+    double seconds;
+
+    BenchBody = bench->body;
+
+    /* Keep calling the function in batches until enough time has elapsed to give a stable measurement. */
+    start = clock();
+    do
+    {
+        int i;
+        for (i=0; i < 16; ++i)
+            bench->func((int)(calls++ % NUM_INPUTS));
+        elapsed = clock() - start;
+    }
+    while ((double)elapsed < min_seconds * CLOCKS_PER_SEC);
+
+    seconds = (double)elapsed / CLOCKS_PER_SEC;
+    printf("%s\t%ld\t%0.1lf\t%0.1lf\n", bench->name, calls, 1.0e9 * seconds / calls, calls / seconds);
+    fflush(stdout);
+}
+
+int main(int argc, const char *argv[])
+{
+    double min_seconds = 0.5;
+    const char *prefix = "";
+    size_t i;
+
+    if (argc > 2 && !strcmp(argv[1], "-t"))
+    {
+        min_seconds = atof(argv[2]);
+        if (min_seconds <= 0.0)
+        {
+            fprintf(stderr, "cbench: invalid number of seconds '%s'\n", argv[2]);
+            return 1;
+        }
+        argv += 2;
+        argc -= 2;
+    }
+
+    if (argc > 2)
+    {
+        fprintf(stderr, "USAGE: cbench [-t seconds] [name_prefix]\n");
+        return 1;
+    }
+
+    if (argc == 2)
+        prefix = argv[1];
+
+    InitInputs();
+    printf("name\tcalls\tns_per_call\tcalls_per_sec\n");
+    for (i=0; i < NUM_BENCHMARKS; ++i)
+        if (!strncmp(BenchList[i].name, prefix, strlen(prefix)))
+            RunBenchmark(&BenchList[i], min_seconds);
+
+    return 0;
+}
@@ -23,8 +23,10 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
+#include <math.h>
 #include "novas.h"
 #include "codegen.h"
 #include "vsop.h"
@@ -501,6 +503,22 @@ static int CVsop_Series(cg_context_t *context, const vsop_series_t *series, cons
     return 0;
 }
 
+static double CVsop_SeriesBound(const vsop_series_t *series)
+{
+    int i;
+    double bound = 0.0;
+
+    /*
+        The sum of the absolute values of all amplitudes bounds the magnitude of the whole series.
+        Add a little margin for rounding each amplitude to the 11 decimal places we print,
+        so the bound is still safe for the amplitudes the C compiler sees.
+    */
+    for (i = 0; i < series->nterms_total; ++i)
+        bound += fabs(series->term[i].amplitude);
+
+    return bound + (series->nterms_total + 1) * 1.0e-11;
+}
+
 static int CVsop_Formula(cg_context_t *context, const vsop_formula_t *formula, const char *coord_name, const char *body_name)
 {
     int error = 0;
@@ -510,6 +528,10 @@ static int CVsop_Formula(cg_context_t *context, const vsop_formula_t *formula, c
 
     snprintf(varprefix, sizeof(varprefix), "vsop_%s_%s", coord_name, body_name);
 
+    /* Must agree with VSOP_MAX_SERIES in the C template. */
+    if (formula->nseries_total > 6)
+        CHECK(LogError(context, "VSOP formula %s has %d series; the C code supports at most 6.", varprefix, formula->nseries_total));
+
     for (s=0; s < formula->nseries_total; ++s)
         CHECK(CVsop_Series(context, &formula->series[s], varprefix, s));
 
@@ -521,9 +543,10 @@ static int CVsop_Formula(cg_context_t *context, const vsop_formula_t *formula, c
         else
             snprintf(sname, sizeof(sname), "%s_%d", varprefix, s);
 
-        fprintf(context->outfile, "    { %d, %s }%s\n",
+        fprintf(context->outfile, "    { %d, %s, %0.11lf }%s\n",
             formula->series[s].nterms_total,
             sname,
+            CVsop_SeriesBound(&formula->series[s]),
             (s+1 < formula->nseries_total) ? "," : "");
     }
     fprintf(context->outfile, "};\n\n");
@@ -532,27 +555,55 @@ fail:
     return error;
 }
 
-static int CVsop(cg_context_t *context)
+static int CompareTermAmplitude(const void *a, const void *b)
+{
+    /* Sort terms in descending order of the absolute value of their amplitudes. */
+    double x = fabs(((const vsop_term_t *)a)->amplitude);
+    double y = fabs(((const vsop_term_t *)b)->amplitude);
+    return (x > y) ? -1 : (x < y) ? +1 : 0;
+}
+
+static int LoadSortedVsopModel(cg_context_t *context, const char *name, const char *tier, vsop_model_t *model)
 {
     int error;
-    const char *name;
     vsop_body_t body;
-    vsop_model_t model;
     int check_length;
-    int k;
+    int k, s;
     char filename[100];
-    const char *coord_name[3] = { "lat", "lon", "rad" };
-
-    VsopInit(&model);
 
-    name = context->args;
     CHECK(ParseVsopBodyName(context, name, &body));
 
-    check_length = snprintf(filename, sizeof(filename), "%s/vsop_%d.txt", context->datapath, (int)body);
+    if (tier == NULL)
+        check_length = snprintf(filename, sizeof(filename), "%s/vsop_%d.txt", context->datapath, (int)body);
+    else
+        check_length = snprintf(filename, sizeof(filename), "%s/vsop_%s_%d.txt", context->datapath, tier, (int)body);
+
     if (check_length < 0 || check_length != (int)strlen(filename))
         CHECK(LogError(context, "VSOP model filename is too long!"));
 
-    CHECK(VsopReadTrunc(&model, filename));
+    CHECK(VsopReadTrunc(model, filename));
+
+    /*
+        Emit the largest terms first, so Astronomy_HelioVectorTol can stop
+        summing a series as soon as the remaining amplitudes are small enough.
+    */
+    for (k=0; k < model->ncoords; ++k)
+        for (s=0; s < model->formula[k].nseries_total; ++s)
+            qsort(model->formula[k].series[s].term, (size_t)model->formula[k].series[s].nterms_total, sizeof(vsop_term_t), CompareTermAmplitude);
+
+fail:
+    return error;
+}
+
+static int CVsopFile(cg_context_t *context, const char *name, const char *tier)
+{
+    int error;
+    vsop_model_t model;
+    int k;
+    const char *coord_name[3] = { "lat", "lon", "rad" };
+
+    VsopInit(&model);
+    CHECK(LoadSortedVsopModel(context, name, tier, &model));
 
     for (k=0; k < model.ncoords; ++k)
         CHECK(CVsop_Formula(context, &model.formula[k], coord_name[k], name));
@@ -562,6 +613,89 @@ fail:
     return error;
 }
 
+static int CVsop(cg_context_t *context)
+{
+    return CVsopFile(context, context->args, NULL);
+}
+
+static int CVsopTier(cg_context_t *context)
+{
+    /* The arguments are the tier name and the body name, e.g. "low Mercury". */
+    char tier[20];
+    char name[20];
+
+    if (2 != sscanf(context->args, "%19s %19s", tier, name))
+        return LogError(context, "Expected tier name and body name.");
+
+    return CVsopFile(context, name, tier);
+}
+
+static int CppVsop(cg_context_t *context)
+{
+    int error;
+    vsop_model_t model;
+    int i, k, s;
+    const char *name = context->args;
+    const char *coord_name[3] = { "lon", "lat", "rad" };    /* the order VSOP87 stores the coordinates in */
+
+    VsopInit(&model);
+    CHECK(LoadSortedVsopModel(context, name, NULL, &model));
+
+    /*
+        Emit each series as a constexpr array whose length is part of its type,
+        so the compiler sees exactly how many terms vsop_series() has to sum.
+    */
+    for (k=0; k < model.ncoords; ++k)
+    {
+        const vsop_formula_t *formula = &model.formula[k];
+        for (s=0; s < formula->nseries_total; ++s)
+        {
+            const vsop_series_t *series = &formula->series[s];
+            if (series->nterms_total == 0)
+                continue;
+
+            fprintf(context->outfile, "ASTRO_VSOP_TABLE vsop_term vsop_%s_%s_%d[] =\n{\n", coord_name[k], name, s);
+            for (i = 0; i < series->nterms_total; ++i)
+            {
+                const vsop_term_t *term = &series->term[i];
+
+                fprintf(context->outfile, "    { %0.11lf, %0.11lf, %0.11lf }%s\n",
+                    term->amplitude,
+                    term->phase,
+                    term->frequency,
+                    (i + 1 < series->nterms_total) ? "," : "");
+            }
+            fprintf(context->outfile, "};\n\n");
+        }
+    }
+
+    /* Emit a model struct whose member functions sum each coordinate's series in Horner form. */
+    fprintf(context->outfile, "struct vsop_%s\n{\n", name);
+    for (k=0; k < model.ncoords; ++k)
+    {
+        const vsop_formula_t *formula = &model.formula[k];
+
+        fprintf(context->outfile, "    static double %s(double t)\n    {\n", coord_name[k]);
+        for (s = formula->nseries_total-1; s >= 0; --s)
+        {
+            const char *assign = (s+1 < formula->nseries_total) ? "" : "double ";
+            const char *times_t = (s+1 < formula->nseries_total) ? " + t*sum" : "";
+            if (formula->series[s].nterms_total > 0)
+                fprintf(context->outfile, "        %ssum = vsop_series(vsop_%s_%s_%d, t)%s;\n", assign, coord_name[k], name, s, times_t);
+            else if (*times_t)
+                fprintf(context->outfile, "        sum *= t;\n");
+            else
+                fprintf(context->outfile, "        double sum = 0.0;\n");
+        }
+        fprintf(context->outfile, "        return sum;\n    }\n%s", (k+1 < model.ncoords) ? "\n" : "");
+    }
+    fprintf(context->outfile, "}");
+
+fail:
+    VsopFreeModel(&model);
+    return error;
+}
+
 static int CsharpVsop_Series(cg_context_t *context, const vsop_series_t *series, const char *varprefix, int s)
 {
     int i;
@@ -1094,15 +1228,14 @@ static int OptAddSolC(cg_context_t *context, const double *data)
 {
     int i;
 
-    fprintf(context->outfile, "    AddSol(ctx");
+    fprintf(context->outfile, "    {");
 
     for (i=0; i < 4; ++i)
-        fprintf(context->outfile, ",%11.4lf", data[i]);
+        fprintf(context->outfile, "%11.4lf,", data[i]);
 
     for(; i < 8; ++i)
-        fprintf(context->outfile, ",%2.0lf", data[i]);
+        fprintf(context->outfile, "%2.0lf%s", data[i], (i < 7) ? "," : " },\n");
 
-    fprintf(context->outfile, ");\n");
     return 0;
 }
 
@@ -1208,6 +1341,122 @@ static double RoundAngle(double x)
 }
 
 #define NUM_CONSTELLATIONS 88
+#define MAX_CONSTEL_BOUNDARIES  400
+#define MAX_CONSTEL_SPANS       64      /* maximum number of RA spans in a single declination band */
+
+typedef struct
+{
+    int    index;
+    double ra_lo;
+    double ra_hi;
+    double dec_lo;
+}
+constel_bound_t;
+
+static double ConstelTableValue(double x)
+{
+    /*
+        Returns the value the C compiler will see after we print 'x' into the boundary table.
+        The index must agree exactly with the table, or lookups on the edges would differ.
+    */
+    char text[40];
+    snprintf(text, sizeof(text), "%17.14lf", x);
+    return atof(text);
+}
+
+static int CompareDoubles(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x < y) ? -1 : (x > y) ? +1 : 0;
+}
+
+static int SortUnique(double list[], int count)
+{
+    int i, n;
+
+    qsort(list, (size_t)count, sizeof(list[0]), CompareDoubles);
+    for (i = n = 0; i < count; ++i)
+        if (n == 0 || list[i] != list[n-1])
+            list[n++] = list[i];
+
+    return n;
+}
+
+static int ConstellationIndex(cg_context_t *context, const constel_bound_t bound[], int nbounds)
+{
+    /*
+        Astronomy_Constellation() wants the first boundary, in table order,
+        with dec_lo <= dec and ra_lo <= ra < ra_hi.
+        Every distinct dec_lo value starts a declination band in which the set of
+        eligible boundaries is fixed. Within a band, the answer changes only at the
+        ra_lo/ra_hi values of the eligible boundaries, so we can tabulate it as a
+        sorted list of RA spans. A lookup is then two binary searches.
+    */
+    int error;
+    double dec[MAX_CONSTEL_BOUNDARIES];
+    double ra[2*MAX_CONSTEL_BOUNDARIES + 1];
+    int first[MAX_CONSTEL_BOUNDARIES];
+    int count[MAX_CONSTEL_BOUNDARIES];
+    int nbands, nra, nspans, b, i, k, prev, spans_in_band;
+
+    for (i=0; i < nbounds; ++i)
+        dec[i] = bound[i].dec_lo;
+    nbands = SortUnique(dec, nbounds);
+
+    fprintf(context->outfile, "static const constel_span_t ConstelSpans[] = {\n");
+    nspans = 0;
+    for (b=0; b < nbands; ++b)
+    {
+        nra = 0;
+        ra[nra++] = 0.0;
+        for (i=0; i < nbounds; ++i)
+        {
+            if (bound[i].dec_lo <= dec[b])
+            {
+                ra[nra++] = bound[i].ra_lo;
+                ra[nra++] = bound[i].ra_hi;
+            }
+        }
+        nra = SortUnique(ra, nra);
+
+        first[b] = nspans;
+        spans_in_band = 0;
+        prev = -1;
+        for (k=0; k < nra && ra[k] < 24.0; ++k)
+        {
+            for (i=0; i < nbounds; ++i)
+                if (bound[i].dec_lo <= dec[b] && bound[i].ra_lo <= ra[k] && bound[i].ra_hi > ra[k])
+                    break;
+
+            if (i == nbounds)
+                CHECK(LogError(context, "ConstellationIndex: no boundary contains RA=%lf, DEC=%lf", ra[k], dec[b]));
+
+            if (bound[i].index != prev)
+            {
+                if (++spans_in_band > MAX_CONSTEL_SPANS)
+                    CHECK(LogError(context, "ConstellationIndex: too many spans in band DEC=%lf", dec[b]));
+
+                fprintf(context->outfile, "%c   { %17.14lf, %2d }    /* band %d */\n",
+                    ((nspans == 0) ? ' ' : ','), ra[k], bound[i].index, b);
+                prev = bound[i].index;
+                ++nspans;
+            }
+        }
+        count[b] = nspans - first[b];
+    }
+    fprintf(context->outfile, "};\n\n");
+
+    fprintf(context->outfile, "static const constel_band_t ConstelBands[] = {\n");
+    for (b=0; b < nbands; ++b)
+        fprintf(context->outfile, "%c   { %17.14lf, %4d, %2d }\n", ((b == 0) ? ' ' : ','), dec[b], first[b], count[b]);
+    fprintf(context->outfile, "};\n\n");
+    fprintf(context->outfile, "#define NUM_CONSTEL_BANDS  %d\n\n", nbands);
+
+    error = 0;
+fail:
+    return error;
+}
 
 static int ConstellationData(cg_context_t *context)
 {
@@ -1221,6 +1470,7 @@ static int ConstellationData(cg_context_t *context)
     char *d;
     double dec, ra_lo, ra_hi;
     char symbol[4];
+    constel_bound_t bound[MAX_CONSTEL_BOUNDARIES];
 
     /* Generate the table of constellation symbols and names. */
 
@@ -1311,8 +1561,8 @@ static int ConstellationData(cg_context_t *context)
     switch (context->language)
     {
     case CODEGEN_LANGUAGE_C:
+        /* C does not need the boundary table itself, only the index generated from it below. */
         fprintf(context->outfile, "};\n\n");
-        fprintf(context->outfile, "static const constel_boundary_t ConstelBounds[] = {\n");
         break;
 
     case CODEGEN_LANGUAGE_CSHARP:
@@ -1354,12 +1604,17 @@ static int ConstellationData(cg_context_t *context)
         if (index == NUM_CONSTELLATIONS)
             CHECK(LogError(context, "Invalid constellation symbol '%s' at %s line %d", symbol, borderFileName, lnum));
 
+        if (lnum > MAX_CONSTEL_BOUNDARIES)
+            CHECK(LogError(context, "Too many constellation boundaries in file: %s", borderFileName));
+
+        bound[lnum-1].index  = index;
+        bound[lnum-1].ra_lo  = ConstelTableValue(ra_lo);
+        bound[lnum-1].ra_hi  = ConstelTableValue(ra_hi);
+        bound[lnum-1].dec_lo = ConstelTableValue(dec);
+
         switch (context->language)
         {
         case CODEGEN_LANGUAGE_C:
-            fprintf(context->outfile, "%c   { %2d, %17.14lf, %17.14lf, %17.14lf }    /* %s */\n",
-                ((lnum == 1) ? ' ' : ','),
-                index, ra_lo, ra_hi, dec, symbol);
             break;
 
         case CODEGEN_LANGUAGE_CSHARP:
@@ -1392,8 +1647,7 @@ static int ConstellationData(cg_context_t *context)
     switch (context->language)
     {
     case CODEGEN_LANGUAGE_C:
-        fprintf(context->outfile, "};\n\n");
-        fprintf(context->outfile, "#define NUM_CONSTEL_BOUNDARIES  %d\n\n", lnum);
+        CHECK(ConstellationIndex(context, bound, lnum));
         break;
 
     case CODEGEN_LANGUAGE_CSHARP:
@@ -1418,6 +1672,236 @@ fail:
     return error;
 }
 
+typedef struct
+{
+    vsop_body_t body;
+    int npoly;          /* number of Chebyshev coefficients per coordinate in each segment */
+    double ndays;       /* number of days covered by each segment */
+}
+vsop_cheb_param_t;
+
+/*
+    Segment sizes for resampling the truncated VSOP models as Chebyshev polynomials.
+    Each was chosen so that the worst-case difference between the Chebyshev fit
+    and the VSOP model it replaces is less than 1.0e-9 AU. Even for Venus at its closest
+    approach to the Earth, that is less than 0.001 arcsecond, so the Chebyshev tier
+    reproduces the results of the VSOP87 series it was fitted to.
+*/
+static const vsop_cheb_param_t VsopChebParams[] =
+{
+    { VSOP_MERCURY, 32,    60.0 },
+    { VSOP_VENUS,   28,   300.0 },
+    { VSOP_EARTH,   32,   100.0 },
+    { VSOP_MARS,    28,   600.0 },
+    { VSOP_JUPITER, 28,  4000.0 },
+    { VSOP_SATURN,  28,  6000.0 },
+    { VSOP_URANUS,  32, 12000.0 },
+    { VSOP_NEPTUNE, 32, 12000.0 },
+    { VSOP_INVALID_BODY, 0, 0.0 }
+};
+
+#define VSOP_CHEB_TT_START  (-36524.5)      /* 1900-01-01T00:00 TT */
+#define VSOP_CHEB_TT_STOP   (+36525.5)      /* 2100-01-01T00:00 TT */
+
+static int VsopChebFunc(const void *context, double tt, double pos[CHEB_MAX_DIM])
+{
+    return VsopCalc(context, tt + T0, pos);
+}
+
+static int CVsopChebyshev(cg_context_t *context)
+{
+    int error;
+    const char *name;
+    vsop_body_t body;
+    vsop_model_t model;
+    const vsop_cheb_param_t *param;
+    ChebEncoder encoder;
+    double coeff[CHEB_MAX_DIM][CHEB_MAX_POLYS];
+    double tt;
+    int check_length;
+    int i, k, nsegments;
+    char filename[100];
+
+    VsopInit(&model);
+
+    name = context->args;
+    CHECK(ParseVsopBodyName(context, name, &body));
+
+    for (param = VsopChebParams; param->body != body; ++param)
+        if (param->body == VSOP_INVALID_BODY)
+            CHECK(LogError(context, "No Chebyshev resampling parameters for VSOP body '%s'", name));
+
+    check_length = snprintf(filename, sizeof(filename), "%s/vsop_%d.txt", context->datapath, (int)body);
+    if (check_length < 0 || check_length != (int)strlen(filename))
+        CHECK(LogError(context, "VSOP model filename is too long!"));
+
+    CHECK(VsopReadTrunc(&model, filename));
+
+    error = ChebInit(&encoder, param->npoly, 3);
+    if (error)
+        CHECK(LogError(context, "ChebInit returned error %d", error));
+
+    nsegments = (int)ceil((VSOP_CHEB_TT_STOP - VSOP_CHEB_TT_START) / param->ndays);
+
+    /* Write all the coefficients for this body into one array, segment by segment. */
+    fprintf(context->outfile, "static const astro_cheb_coeff_t cheb_vsop_%s_coeff[] =\n{\n", name);
+    for (k=0; k < nsegments; ++k)
+    {
+        tt = VSOP_CHEB_TT_START + (k * param->ndays);
+        error = ChebGenerate(&encoder, VsopChebFunc, &model, tt, tt + param->ndays, coeff);
+        if (error)
+            CHECK(LogError(context, "ChebGenerate returned error %d", error));
+
+        for (i=0; i < param->npoly; ++i)
+        {
+            fprintf(context->outfile, "    { { %16.12lf, %16.12lf, %16.12lf } }%s\n",
+                coeff[0][i],
+                coeff[1][i],
+                coeff[2][i],
+                (k+1 < nsegments || i+1 < param->npoly) ? "," : "");
+        }
+    }
+    fprintf(context->outfile, "};\n\n");
+
+    /* Write the segment records, each pointing into the coefficient array. */
+    fprintf(context->outfile, "static const astro_cheb_record_t cheb_vsop_%s[] =\n{\n", name);
+    for (k=0; k < nsegments; ++k)
+    {
+        fprintf(context->outfile, "    { %10.1lf, %7.1lf, %d, cheb_vsop_%s_coeff + %d }%s\n",
+            VSOP_CHEB_TT_START + (k * param->ndays),
+            param->ndays,
+            param->npoly,
+            name,
+            k * param->npoly,
+            (k+1 < nsegments) ? "," : "");
+    }
+    fprintf(context->outfile, "}");
+
+fail:
+    VsopFreeModel(&model);
+    return error;
+}
+
+static int ParseHorizonsDate(const char *text, double *ut)
+{
+    static const char MonthName[] = "janfebmaraprmayjunjulaugsepoctnovdec";
+    int year, month, day, hour, minute;
+    char mon[4];
+
+    /* Parse a date like "2020-May-14 00:00" or "2020-MAY-14" into days since the J2000 epoch. */
+    hour = minute = 0;
+    if (sscanf(text, "%d-%3s-%d %d:%d", &year, mon, &day, &hour, &minute) < 3)
+        return 1;
+
+    for (month = 0; month < 12; ++month)
+        if (tolower(mon[0]) == MonthName[3*month] && tolower(mon[1]) == MonthName[3*month+1] && tolower(mon[2]) == MonthName[3*month+2])
+            break;
+
+    if (month == 12 || year < 1583)     /* require a Gregorian calendar date */
+        return 1;
+
+    *ut = julian_date((short)year, (short)(month+1), (short)day, hour + minute/60.0) - T0;
+    return 0;
+}
+
+#define MAX_DELTA_T_ROWS    1000
+
+static int DeltaTData(cg_context_t *context)
+{
+    int error = 1;
+    const char *filename = "delta_t/airless_Moon_dt.txt";
+    const int SampleRows = 73;      /* the file has one row every 10 days; keep one row every 730 days */
+    FILE *infile;
+    char line[200];
+    const char *p;
+    int lnum, inside, nrows, count, i;
+    double ut, dt, stop_ut;
+    static double table_ut[MAX_DELTA_T_ROWS];
+    static double table_dt[MAX_DELTA_T_ROWS];
+
+    if (context->language != CODEGEN_LANGUAGE_C)
+        return LogError(context, "DeltaTData: Unsupported language %d", context->language);
+
+    infile = fopen(filename, "rt");
+    if (infile == NULL)
+        return LogError(context, "Cannot open input file: %s", filename);
+
+    /*
+        The JPL Horizons export lists TDB-UT every 10 days.
+        Only the rows covered by the Earth Orientation Parameter (EOP) data
+        are based on observations; rows after that repeat the last value.
+        Keep rows from the year 1600 through the end of the EOP data.
+    */
+    lnum = inside = nrows = count = 0;
+    stop_ut = NAN;
+    while (fgets(line, sizeof(line), infile))
+    {
+        ++lnum;
+        if (!inside)
+        {
+            if (!strncmp(line, "EOP coverage", 12))
+            {
+                p = strstr(line, " TO ");
+                if (p == NULL || ParseHorizonsDate(p + 4, &stop_ut))
+                    CHECK(LogError(context, "DeltaTData: invalid EOP coverage in %s line %d", filename, lnum));
+            }
+            else if (!strncmp(line, "$$SOE", 5))
+            {
+                if (isnan(stop_ut))
+                    CHECK(LogError(context, "DeltaTData: missing EOP coverage in %s", filename));
+                inside = 1;
+            }
+            continue;
+        }
+
+        if (!strncmp(line, "$$EOE", 5))
+            break;
+
+        if (ParseHorizonsDate(line + 1, &ut) || ut < -146096.5)
+            continue;       /* skip dates before the year 1600 */
+
+        if (ut > stop_ut)
+            break;
+
+        p = strrchr(line, ' ');
+        if (p == NULL || 1 != sscanf(p, "%lf", &dt))
+            CHECK(LogError(context, "DeltaTData: invalid TDB-UT in %s line %d", filename, lnum));
+
+        /* Keep every SampleRows-th row. Remember the latest row in the next slot, in case it is the last one. */
+        if (count == MAX_DELTA_T_ROWS)
+            CHECK(LogError(context, "DeltaTData: too many rows in %s", filename));
+        table_ut[count] = ut;
+        table_dt[count] = dt;
+        if (nrows % SampleRows == 0)
+            ++count;
+        ++nrows;
+    }
+
+    /* Always keep the last observed row. */
+    if (nrows > 0 && (nrows - 1) % SampleRows != 0)
+        ++count;
+
+    if (count < 2)
+        CHECK(LogError(context, "DeltaTData: not enough rows in %s", filename));
+
+    fprintf(context->outfile, "#define DELTA_T_BUILTIN_COUNT   %d\n\n", count);
+
+    fprintf(context->outfile, "static const double DeltaTBuiltinUt[DELTA_T_BUILTIN_COUNT] =\n{\n");
+    for (i=0; i < count; ++i)
+        fprintf(context->outfile, "%s%10.1lf%s", (i % 8 == 0) ? "    " : " ", table_ut[i], (i+1 < count) ? ((i % 8 == 7) ? ",\n" : ",") : "\n");
+    fprintf(context->outfile, "};\n\n");
+
+    fprintf(context->outfile, "static const double DeltaTBuiltinDt[DELTA_T_BUILTIN_COUNT] =\n{\n");
+    for (i=0; i < count; ++i)
+        fprintf(context->outfile, "%s%11.6lf%s", (i % 8 == 0) ? "    " : " ", table_dt[i], (i+1 < count) ? ((i % 8 == 7) ? ",\n" : ",") : "\n");
+    fprintf(context->outfile, "}");
+
+    error = 0;
+fail:
+    fclose(infile);
+    return error;
+}
+
 static int LogError(const cg_context_t *context, const char *format, ...)
 {
     va_list v;
@@ -1432,7 +1916,10 @@ static int LogError(const cg_context_t *context, const char *format, ...)
 static const cg_directive_entry DirectiveTable[] =
 {
     { "C_VSOP",             CVsop               },
+    { "C_VSOP_CHEBYSHEV",   CVsopChebyshev      },
+    { "C_VSOP_TIER",        CVsopTier           },
     { "CSHARP_VSOP",        CsharpVsop          },
+    { "CPP_VSOP",           CppVsop             },
     { "LIST_VSOP",          ListVsop            },
     { "LIST_CHEBYSHEV",     ListChebyshev       },
     { "C_CHEBYSHEV",        CChebyshev          },
@@ -1440,6 +1927,7 @@ static const cg_directive_entry DirectiveTable[] =
     { "IAU_DATA",           OptIauData          },
     { "ADDSOL",             OptAddSol           },
     { "CONSTEL",            ConstellationData   },
+    { "C_DELTA_T",          DeltaTData          },
     { NULL, NULL }  /* Marks end of list */
 };
 
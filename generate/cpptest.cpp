@@ -0,0 +1,82 @@
+/*
+    cpptest.cpp  -  Don Cross <cosinekitty.com>
+
+    https://github.com/cosinekitty/astronomy
+
+    Unit tests for the header-only C++ wrapper astronomy.hpp.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include "astronomy.hpp"
+
+static int Verbose = 0;
+#define DEBUG(...)      do{if(Verbose)std::printf(__VA_ARGS__);}while(0)
+
+template <astro::Body body>
+static int CheckHelio(double *maxdiff)
+{
+    int i;
+    const char *name = Astronomy_BodyName(static_cast<astro_body_t>(body));
+
+    /* Compare against the C engine once every 97 days from 1800 to 2200. */
+    for (i = -146100/97; i <= 146100/97; ++i)
+    {
+        const double tt = 97.0 * i;
+        const astro_time_t time = Astronomy_TimeFromDays(tt);
+        const astro_vector_t cvec = Astronomy_HelioVector(static_cast<astro_body_t>(body), time);
+        if (cvec.status != ASTRO_SUCCESS)
+        {
+            std::fprintf(stderr, "C++ CheckHelio(%s): Astronomy_HelioVector returned status %d\n", name, cvec.status);
+            return 1;
+        }
+
+        /* Evaluate the template at the same TT the C engine used. */
+        const astro::Vector pos = astro::helio<body>(cvec.t.tt);
+        const double dx = pos.x - cvec.x;
+        const double dy = pos.y - cvec.y;
+        const double dz = pos.z - cvec.z;
+        const double diff = std::sqrt(dx*dx + dy*dy + dz*dz);
+        if (!std::isfinite(diff) || diff > 1.0e-12)
+        {
+            std::fprintf(stderr, "C++ CheckHelio(%s): excessive difference %lg AU at tt=%lf\n", name, diff, cvec.t.tt);
+            return 1;
+        }
+
+        if (diff > *maxdiff)
+            *maxdiff = diff;
+    }
+
+    DEBUG("C++ CheckHelio(%s): PASS\n", name);
+    return 0;
+}
+
+static int HelioTest(void)
+{
+    double maxdiff = 0.0;
+
+    if (CheckHelio<astro::Body::Sun>(&maxdiff)) return 1;
+    if (CheckHelio<astro::Body::Mercury>(&maxdiff)) return 1;
+    if (CheckHelio<astro::Body::Venus>(&maxdiff)) return 1;
+    if (CheckHelio<astro::Body::Earth>(&maxdiff)) return 1;
+    if (CheckHelio<astro::Body::Mars>(&maxdiff)) return 1;
+    if (CheckHelio<astro::Body::Jupiter>(&maxdiff)) return 1;
+    if (CheckHelio<astro::Body::Saturn>(&maxdiff)) return 1;
+    if (CheckHelio<astro::Body::Uranus>(&maxdiff)) return 1;
+    if (CheckHelio<astro::Body::Neptune>(&maxdiff)) return 1;
+
+    std::printf("C++ HelioTest: PASS (maxdiff = %lg AU)\n", maxdiff);
+    return 0;
+}
+
+int main(int argc, const char *argv[])
+{
+    if (argc > 1 && !std::strcmp(argv[1], "-v"))
+        Verbose = 1;
+
+    if (HelioTest())
+        return 1;
+
+    return 0;
+}
@@ -42,6 +42,7 @@ namespace csharp_test
             new Test("rotation", RotationTest),
             new Test("seasons", SeasonsTest),
             new Test("transit", TransitTest),
+            new Test("batch", BatchTest),
             new Test("astro_check", AstroCheck),
         };
 
@@ -2228,5 +2229,120 @@ namespace csharp_test
 
             return 0;
         }
+
+        static int BatchCompare(string label, int i, double batch, double scalar)
+        {
+            if (batch != scalar && !(double.IsNaN(batch) && double.IsNaN(scalar)))
+            {
+                Console.WriteLine("C# BatchTest({0}): element {1}: batch={2}, scalar={3}", label, i, batch, scalar);
+                return 1;
+            }
+            return 0;
+        }
+
+        static int BatchTest()
+        {
+            const int count = 200;
+            var ut = new double[count];
+            var x = new double[count];
+            var y = new double[count];
+            var z = new double[count];
+            var ra = new double[count];
+            var dec = new double[count];
+            var dist = new double[count];
+            var az = new double[count];
+            var alt = new double[count];
+            var observer = new Observer(-33.9, 18.4, 250.0);
+
+            for (int i = 0; i < count; ++i)
+                ut[i] = -36500.0 + 365.8137*i;
+
+            // The batch functions must return exactly the same numbers as the functions they replace.
+            var bodies = new Body[] { Body.Sun, Body.Moon, Body.Mercury, Body.Earth, Body.Mars, Body.Jupiter, Body.Neptune, Body.Pluto, Body.EMB, Body.SSB };
+            foreach (Body body in bodies)
+            {
+                Astronomy.HelioVectorBatch(body, ut, x, y, z);
+                for (int i = 0; i < count; ++i)
+                {
+                    AstroVector vec = Astronomy.HelioVector(body, new AstroTime(ut[i]));
+                    if (0 != BatchCompare(body + " helio x", i, x[i], vec.x)) return 1;
+                    if (0 != BatchCompare(body + " helio y", i, y[i], vec.y)) return 1;
+                    if (0 != BatchCompare(body + " helio z", i, z[i], vec.z)) return 1;
+                }
+
+                if (body == Body.EMB || body == Body.SSB)
+                    continue;
+
+                foreach (Aberration aberration in new Aberration[] { Aberration.None, Aberration.Corrected })
+                {
+                    Astronomy.GeoVectorBatch(body, ut, aberration, x, y, z);
+                    for (int i = 0; i < count; ++i)
+                    {
+                        AstroVector vec = Astronomy.GeoVector(body, new AstroTime(ut[i]), aberration);
+                        if (0 != BatchCompare(body + " geo x", i, x[i], vec.x)) return 1;
+                        if (0 != BatchCompare(body + " geo y", i, y[i], vec.y)) return 1;
+                        if (0 != BatchCompare(body + " geo z", i, z[i], vec.z)) return 1;
+                    }
+                }
+
+                if (body == Body.Earth)
+                    continue;
+
+                foreach (EquatorEpoch equdate in new EquatorEpoch[] { EquatorEpoch.J2000, EquatorEpoch.OfDate })
+                {
+                    Astronomy.EquatorBatch(body, ut, observer, equdate, Aberration.Corrected, ra, dec, dist);
+                    for (int i = 0; i < count; ++i)
+                    {
+                        Equatorial equ = Astronomy.Equator(body, new AstroTime(ut[i]), observer, equdate, Aberration.Corrected);
+                        if (0 != BatchCompare(body + " ra", i, ra[i], equ.ra)) return 1;
+                        if (0 != BatchCompare(body + " dec", i, dec[i], equ.dec)) return 1;
+                        if (0 != BatchCompare(body + " dist", i, dist[i], equ.dist)) return 1;
+                    }
+                }
+
+                Astronomy.HorizonBatch(ut, observer, ra, dec, Refraction.Normal, az, alt);
+                for (int i = 0; i < count; ++i)
+                {
+                    Topocentric hor = Astronomy.Horizon(new AstroTime(ut[i]), observer, ra[i], dec[i], Refraction.Normal);
+                    if (0 != BatchCompare(body + " azimuth", i, az[i], hor.azimuth)) return 1;
+                    if (0 != BatchCompare(body + " altitude", i, alt[i], hor.altitude)) return 1;
+                }
+            }
+
+            // Sunrise on every day of a year, at a location where the Sun does not rise for weeks in the winter.
+            var tromso = new Observer(69.65, 18.96, 0.0);
+            var start = new double[365];
+            var rise = new double[365];
+            for (int i = 0; i < start.Length; ++i)
+                start[i] = new AstroTime(2020, 1, 1, 0, 0, 0).ut + i;
+
+            Astronomy.SearchRiseSetBatch(Body.Sun, tromso, Direction.Rise, start, 1.0, rise);
+            int nodays = 0;
+            for (int i = 0; i < start.Length; ++i)
+            {
+                AstroTime time = Astronomy.SearchRiseSet(Body.Sun, tromso, Direction.Rise, new AstroTime(start[i]), 1.0);
+                if (0 != BatchCompare("sunrise", i, rise[i], (time != null) ? time.ut : double.NaN)) return 1;
+                if (time == null)
+                    ++nodays;
+            }
+            if (nodays == 0)
+            {
+                Console.WriteLine("C# BatchTest: expected some days with no sunrise.");
+                return 1;
+            }
+
+            try
+            {
+                Astronomy.HelioVectorBatch(Body.Mars, ut, x, y, new double[count - 1]);
+                Console.WriteLine("C# BatchTest: allowed a short output span.");
+                return 1;
+            }
+            catch (ArgumentException)
+            {
+            }
+
+            Console.WriteLine("C# BatchTest: PASS ({0} days without sunrise)", nodays);
+            return 0;
+        }
     }
 }
@@ -0,0 +1,229 @@
+/*
+    eclipse_table.c  -  Don Cross <cosinekitty.com>
+
+    Generates the optional eclipse lookup tables for Astronomy Engine.
+    https://github.com/cosinekitty/astronomy
+
+    Usage:  eclipse_table outfile.h
+
+    Runs the full lunar eclipse and global solar eclipse searches
+    over the years 1700 through 2199 and writes every eclipse found
+    into a C header file. When astronomy.c is compiled with
+    ASTRONOMY_ECLIPSE_TABLES defined, it includes that header and
+    answers eclipse searches inside the covered range by looking up
+    the answer, instead of searching one new/full moon at a time.
+
+    This program must be linked with an astronomy.c built WITHOUT
+    ASTRONOMY_ECLIPSE_TABLES, so that the tables come from the real searches.
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include "astronomy.h"
+
+#ifdef ASTRONOMY_ECLIPSE_TABLES
+#error eclipse_table must be built without ASTRONOMY_ECLIPSE_TABLES.
+#endif
+
+static const char *KindName(astro_eclipse_kind_t kind)
+{
+    switch (kind)
+    {
+    case ECLIPSE_PENUMBRAL: return "ECLIPSE_PENUMBRAL";
+    case ECLIPSE_PARTIAL:   return "ECLIPSE_PARTIAL";
+    case ECLIPSE_ANNULAR:   return "ECLIPSE_ANNULAR";
+    case ECLIPSE_TOTAL:     return "ECLIPSE_TOTAL";
+    default:                return NULL;
+    }
+}
+
+static void PrintNumber(FILE *outfile, double x)
+{
+    if (isnan(x))
+        fprintf(outfile, "NAN");
+    else
+        fprintf(outfile, "%0.17g", x);
+}
+
+static int MoonPhaseTime(double phase, astro_time_t peak, double *ut)
+{
+    /* Find the new/full moon that the eclipse search started from. */
+    astro_search_result_t result = Astronomy_SearchMoonPhase(phase, Astronomy_AddDays(peak, -1.0), 2.0);
+    if (result.status != ASTRO_SUCCESS)
+    {
+        fprintf(stderr, "eclipse_table: cannot find moon phase %0.1lf near ut=%0.6lf (status %d)\n", phase, peak.ut, result.status);
+        return 1;
+    }
+    *ut = result.time.ut;
+    return 0;
+}
+
+static int LunarTable(FILE *outfile, astro_time_t startTime, astro_time_t stopTime)
+{
+    astro_lunar_eclipse_t eclipse;
+    const char *kind;
+    double fullmoon_ut;
+    int count = 0;
+
+    fprintf(outfile, "static const lunar_eclipse_record_t LunarEclipseTable[] =\n{\n");
+    eclipse = Astronomy_SearchLunarEclipse(startTime);
+    while (eclipse.status == ASTRO_SUCCESS && eclipse.peak.ut < stopTime.ut)
+    {
+        kind = KindName(eclipse.kind);
+        if (kind == NULL)
+        {
+            fprintf(stderr, "eclipse_table: invalid lunar eclipse kind %d\n", eclipse.kind);
+            return 1;
+        }
+
+        if (MoonPhaseTime(180.0, eclipse.peak, &fullmoon_ut))
+            return 1;
+
+        fprintf(outfile, "%s    { ", (count > 0) ? ",\n" : "");
+        PrintNumber(outfile, fullmoon_ut);      fprintf(outfile, ", ");
+        PrintNumber(outfile, eclipse.peak.ut);  fprintf(outfile, ", ");
+        PrintNumber(outfile, eclipse.sd_penum); fprintf(outfile, ", ");
+        PrintNumber(outfile, eclipse.sd_partial); fprintf(outfile, ", ");
+        PrintNumber(outfile, eclipse.sd_total);
+        fprintf(outfile, ", %s }", kind);
+        ++count;
+
+        eclipse = Astronomy_NextLunarEclipse(eclipse.peak);
+    }
+
+    if (eclipse.status != ASTRO_SUCCESS)
+    {
+        fprintf(stderr, "eclipse_table: lunar eclipse search failed (status %d)\n", eclipse.status);
+        return 1;
+    }
+
+    fprintf(outfile, "\n};\n\n");
+    printf("eclipse_table: %d lunar eclipses\n", count);
+    return 0;
+}
+
+static int SolarTable(FILE *outfile, astro_time_t startTime, astro_time_t stopTime)
+{
+    astro_global_solar_eclipse_t eclipse;
+    const char *kind;
+    double newmoon_ut;
+    int count = 0;
+
+    fprintf(outfile, "static const solar_eclipse_record_t SolarEclipseTable[] =\n{\n");
+    eclipse = Astronomy_SearchGlobalSolarEclipse(startTime);
+    while (eclipse.status == ASTRO_SUCCESS && eclipse.peak.ut < stopTime.ut)
+    {
+        kind = KindName(eclipse.kind);
+        if (kind == NULL || eclipse.kind == ECLIPSE_PENUMBRAL)
+        {
+            fprintf(stderr, "eclipse_table: invalid solar eclipse kind %d\n", eclipse.kind);
+            return 1;
+        }
+
+        if (MoonPhaseTime(0.0, eclipse.peak, &newmoon_ut))
+            return 1;
+
+        fprintf(outfile, "%s    { ", (count > 0) ? ",\n" : "");
+        PrintNumber(outfile, newmoon_ut);       fprintf(outfile, ", ");
+        PrintNumber(outfile, eclipse.peak.ut);  fprintf(outfile, ", ");
+        PrintNumber(outfile, eclipse.distance); fprintf(outfile, ", ");
+        PrintNumber(outfile, eclipse.latitude); fprintf(outfile, ", ");
+        PrintNumber(outfile, eclipse.longitude);
+        fprintf(outfile, ", %s }", kind);
+        ++count;
+
+        eclipse = Astronomy_NextGlobalSolarEclipse(eclipse.peak);
+    }
+
+    if (eclipse.status != ASTRO_SUCCESS)
+    {
+        fprintf(stderr, "eclipse_table: solar eclipse search failed (status %d)\n", eclipse.status);
+        return 1;
+    }
+
+    fprintf(outfile, "\n};\n\n");
+    printf("eclipse_table: %d solar eclipses\n", count);
+    return 0;
+}
+
+int main(int argc, const char *argv[])
+{
+    const char *filename;
+    FILE *outfile;
+    astro_time_t startTime, stopTime;
+    int error;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "USAGE: eclipse_table outfile.h\n");
+        return 1;
+    }
+
+    filename = argv[1];
+    startTime = Astronomy_MakeTime(1700, 1, 1, 0, 0, 0.0);
+    stopTime  = Astronomy_MakeTime(2200, 1, 1, 0, 0, 0.0);
+
+    outfile = fopen(filename, "wt");
+    if (outfile == NULL)
+    {
+        fprintf(stderr, "eclipse_table: cannot open output file: %s\n", filename);
+        return 1;
+    }
+
+    fprintf(outfile,
+        "/*\n"
+        "    Astronomy Engine for C/C++.\n"
+        "    https://github.com/cosinekitty/astronomy\n"
+        "\n"
+        "    MIT License\n"
+        "\n"
+        "    Copyright (c) 2019-2020 Don Cross <cosinekitty@gmail.com>\n"
+        "\n"
+        "    Permission is hereby granted, free of charge, to any person obtaining a copy\n"
+        "    of this software and associated documentation files (the \"Software\"), to deal\n"
+        "    in the Software without restriction, including without limitation the rights\n"
+        "    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell\n"
+        "    copies of the Software, and to permit persons to whom the Software is\n"
+        "    furnished to do so, subject to the following conditions:\n"
+        "\n"
+        "    The above copyright notice and this permission notice shall be included in all\n"
+        "    copies or substantial portions of the Software.\n"
+        "\n"
+        "    THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR\n"
+        "    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,\n"
+        "    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE\n"
+        "    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER\n"
+        "    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,\n"
+        "    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE\n"
+        "    SOFTWARE.\n"
+        "*/\n"
+        "\n"
+        "/*\n"
+        "    Optional eclipse tables generated by generate/eclipse_table.c. Do not edit.\n"
+        "\n"
+        "    This file is included by astronomy.c only when it is compiled with\n"
+        "    ASTRONOMY_ECLIPSE_TABLES defined. Otherwise it is not needed.\n"
+        "\n"
+        "    Each record holds the result of a full lunar eclipse search or global\n"
+        "    solar eclipse search, along with the full/new moon the search found.\n"
+        "    The tables cover the years 1700 through 2199 using the default\n"
+        "    Delta T model. Outside that range, astronomy.c falls back to searching.\n"
+        "*/\n"
+        "\n"
+        "#define ECLIPSE_TABLE_START_UT  ");
+    PrintNumber(outfile, startTime.ut);
+    fprintf(outfile, "\n#define ECLIPSE_TABLE_STOP_UT   ");
+    PrintNumber(outfile, stopTime.ut);
+    fprintf(outfile, "\n\n");
+
+    error = LunarTable(outfile, startTime, stopTime) || SolarTable(outfile, startTime, stopTime);
+    fclose(outfile);
+    if (error)
+    {
+        remove(filename);
+        return 1;
+    }
+
+    printf("eclipse_table: wrote %s\n", filename);
+    return 0;
+}
@@ -22,6 +22,8 @@
     SOFTWARE.
 */
 
+#include <errno.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -30,6 +32,8 @@
 #define unlink _unlink
 #else
 #include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 #endif
 
 #include "eph_manager.h"
@@ -44,6 +48,7 @@
 #include "vsop.h"
 
 int Verbose;
+static int Jobs = 1;    /* maximum number of worker processes, set by the '-j' option */
 #define DEBUG(...)  do{if(Verbose)printf(__VA_ARGS__);}while(0)
 
 #define VECTOR_DIM 3
@@ -72,7 +77,7 @@ static short int de_number;
 
 static int OpenEphem(void);
 static int PrintUsage(void);
-static int GenerateVsopPlanets(void);
+static int GeneratePlanets(void);
 static int GeneratePluto(void);
 static int GenerateApsisTestData(void);
 static int GenerateSource(void);
@@ -92,6 +97,8 @@ static int UnitTestChebyshev(void);
 static int DistancePlot(const char *name, double tt1, double tt2);
 static int ImproveVsopApsides(vsop_model_t *model);
 static int DeltaTimePlot(const char *outFileName);
+static int GenerateVsopTiers(void);
+static int GenerateEphemerisFile(const char *outFileName, int startYear, int stopYear);
 
 #define MOON_PERIGEE        0.00238
 #define MERCURY_APHELION    0.466697
@@ -129,19 +136,55 @@ const double ErrorRadius[] =
 
 int main(int argc, const char *argv[])
 {
-    if (argc > 1 && !strcmp(argv[1], "-v"))
+    long jobs;
+    char *end;
+
+    /* Options may appear in any order, but all of them must precede the command. */
+    while (argc > 1 && argv[1][0] == '-')
     {
-        Verbose = 1;
-        --argc;
-        ++argv;
+        if (!strcmp(argv[1], "-v"))
+        {
+            Verbose = 1;
+            --argc;
+            ++argv;
+        }
+        else if (!strcmp(argv[1], "-j"))
+        {
+            if (argc < 3)
+            {
+                fprintf(stderr, "generate: missing number of jobs after -j\n");
+                return 1;
+            }
+            errno = 0;
+            jobs = strtol(argv[2], &end, 10);
+            if (errno != 0 || end == argv[2] || *end != '\0' || jobs < 1 || jobs > INT_MAX)
+            {
+                fprintf(stderr, "generate: invalid number of jobs '%s'\n", argv[2]);
+                return 1;
+            }
+            Jobs = (int)jobs;
+            argc -= 2;
+            argv += 2;
+        }
+        else
+        {
+            fprintf(stderr, "generate: unknown option '%s'\n", argv[1]);
+            return PrintUsage();
+        }
     }
 
     if (argc == 2 && !strcmp(argv[1], "planets"))
-        return GenerateVsopPlanets() || GeneratePluto();
+        return GeneratePlanets();
 
     if (argc == 2 && !strcmp(argv[1], "pluto"))
         return GeneratePluto();
 
+    if (argc == 2 && !strcmp(argv[1], "tiers"))
+        return GenerateVsopTiers();
+
+    if (argc == 5 && !strcmp(argv[1], "ephemeris"))
+        return GenerateEphemerisFile(argv[2], atoi(argv[3]), atoi(argv[4]));
+
     if (argc == 2 && !strcmp(argv[1], "apsis"))
         return GenerateApsisTestData();
 
@@ -169,12 +212,25 @@ static int PrintUsage(void)
         "\n"
         "USAGE:\n"
         "\n"
+        "generate [-v] [-j N] command ...\n"
+        "    -v    Print verbose diagnostic output.\n"
+        "    -j N  Run up to N bodies at a time in separate processes\n"
+        "          for the planets, tiers, and apsis commands.\n"
+        "\n"
         "generate planets\n"
         "    Generate predictive models for all planets.\n"
         "\n"
         "generate pluto\n"
         "    Generate predictive models for Pluto only.\n"
         "\n"
+        "generate tiers\n"
+        "    Generate the low and high accuracy VSOP models\n"
+        "    selected by ASTRONOMY_ACCURACY_ARCMIN.\n"
+        "\n"
+        "generate ephemeris outfile.eph start_year stop_year\n"
+        "    Write a binary Chebyshev ephemeris file, for Astronomy_LoadEphemeris,\n"
+        "    covering the given years. Requires the JPL ephemeris.\n"
+        "\n"
         "generate check testfile\n"
         "    Verify the calculations in the testfile generated by a unit test.\n"
         "\n"
@@ -576,42 +632,233 @@ fail:
     return error;
 }
 
-static int BuildVsopData(void)
+/*
+    The slow generate commands repeat the same independent work for each body.
+    With '-j N', RunBodyJobs runs up to N bodies at the same time, each in its own child process.
+    Every job opens the JPL ephemeris for itself, so the NOVAS ephemeris state
+    (the open file and its record cache in eph_manager.c) is never shared between workers.
+*/
+typedef int (* body_job_t) (int body);
+
+static int RunBodyJobs(body_job_t job, const int *bodies, int count)
 {
-    int body;
-    int error;
+    int error, i;
+#ifndef _WIN32
+    int status, running = 0, failed = 0;
+    pid_t pid;
 
-    for (body=0; body < 8; ++body)
-        if (0 != (error = SearchVsop(body)))
-            break;
+    if (Jobs > 1)
+    {
+        i = 0;
+        while ((i < count && !failed) || running > 0)
+        {
+            if (i < count && !failed && running < Jobs)
+            {
+                /* Flush first, so the child does not print a second copy of anything buffered. */
+                fflush(stdout);
+                fflush(stderr);
+                pid = fork();
+                if (pid < 0)
+                {
+                    fprintf(stderr, "RunBodyJobs: fork() failed for body %d\n", bodies[i]);
+                    failed = 1;
+                    continue;
+                }
+                if (pid == 0)
+                    exit(job(bodies[i]) ? 1 : 0);
+                ++running;
+                ++i;
+            }
+            else
+            {
+                pid = wait(&status);
+                if (pid < 0)
+                {
+                    fprintf(stderr, "RunBodyJobs: wait() failed\n");
+                    return 1;
+                }
+                --running;
+                if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+                    failed = 1;
+            }
+        }
+        return failed;
+    }
+#endif
 
+    for (i=0; i < count; ++i)
+        CHECK(job(bodies[i]));
+    error = 0;
+fail:
     return error;
 }
 
-static int GeneratePluto(void)
+static int PlanetJob(int body)
 {
     int error;
 
     CHECK(OpenEphem());
-    CHECK(ManualResample(8, 19, 8, MIN_YEAR, MAX_YEAR));
+    if (body == BODY_PLUTO)
+        CHECK(ManualResample(BODY_PLUTO, 19, 8, MIN_YEAR, MAX_YEAR));
+    else
+        CHECK(SearchVsop(body));
 
 fail:
     ephem_close();
     return error;
 }
 
-static int GenerateVsopPlanets(void)
+static int GeneratePluto(void)
+{
+    return PlanetJob(BODY_PLUTO);
+}
+
+static int GeneratePlanets(void)
+{
+    /* Bodies 0..7 use VSOP87 (2 = Earth); Pluto is resampled as Chebyshev polynomials. */
+    static const int bodies[] = { 0, 1, 2, 3, 4, 5, 6, 7, BODY_PLUTO };
+    return RunBodyJobs(PlanetJob, bodies, (int)(sizeof(bodies) / sizeof(bodies[0])));
+}
+
+/*
+    The default VSOP model for each planet, written by 'generate planets',
+    is truncated until its error compared to the JPL ephemeris reaches 0.4 arcminutes.
+    Programs that need smaller or more accurate models can compile astronomy.c
+    with ASTRONOMY_ACCURACY_ARCMIN defined to select one of these other tiers instead.
+    Each tier is truncated from the complete VSOP87 series, and its error is measured
+    against the complete series, so generating the tiers does not need the JPL ephemeris.
+*/
+typedef struct
+{
+    const char *name;       /* the tier's VSOP files are output/vsop_<name>_<body>.txt */
+    double arcmin_limit;    /* worst-case error compared to the complete VSOP87 series */
+}
+vsop_tier_t;
+
+static const vsop_tier_t VsopTier[] =
+{
+    { "low",  4.0  },
+    { "high", 0.01 }
+};
+
+#define NUM_VSOP_TIERS      (sizeof(VsopTier) / sizeof(VsopTier[0]))
+#define TIER_SAMPLE_DAYS    10.0
+
+static int TierArcminError(vsop_model_t *model, int body, int nsamples, const double *ref, double *max_arcmin)
+{
+    int error, i, k;
+    double pos[3], diff[3], arcmin;
+
+    *max_arcmin = 0.0;
+    for (i=0; i < nsamples; ++i)
+    {
+        CHECK(VsopCalc(model, julian_date(MIN_YEAR, 1, 1, 0.0) + i*TIER_SAMPLE_DAYS, pos));
+        for (k=0; k < 3; ++k)
+            diff[k] = pos[k] - ref[3*i + k];
+
+        /* Assume the worst-case geometry: the error seen from the Earth at the body's closest approach. */
+        arcmin = (RAD2DEG * 60.0) * VectorLength(diff) / ErrorRadius[body];
+        if (arcmin > *max_arcmin)
+            *max_arcmin = arcmin;
+    }
+    error = 0;
+fail:
+    return error;
+}
+
+static int SearchVsopTier(vsop_model_t *model, int body, const vsop_tier_t *tier, int nsamples, const double *ref)
 {
     int error;
+    int trunc_terms, winner_terms = -1;
+    double thresh_lo = 1.0e-10;
+    double thresh_hi = 1.0e-1;
+    double max_arcmin, threshold;
+    double winner_threshold = 0.0;
+    double winner_arcmin = -1.0;
+    double jdStart = julian_date(MIN_YEAR, 1, 1, 0.0);
+    double jdStop = julian_date(MAX_YEAR, 1, 1, 0.0);
+    char filename[100];
 
-    CHECK(OpenEphem());
-    CHECK(BuildVsopData());
+    /* Same threshold bisection as SearchVsop, only measuring error against the complete series. */
+    while (thresh_hi / thresh_lo > 1.0001)
+    {
+        threshold = sqrt(thresh_lo * thresh_hi);
+        CHECK(VsopTruncate(model, jdStart, jdStop, threshold));
+        trunc_terms = VsopTermCount(model);
+        CHECK(TierArcminError(model, body, nsamples, ref, &max_arcmin));
+        if (max_arcmin >= tier->arcmin_limit)
+        {
+            thresh_hi = threshold;
+        }
+        else
+        {
+            thresh_lo = threshold;
+            if (winner_terms < 0 || trunc_terms < winner_terms)
+            {
+                winner_terms = trunc_terms;
+                winner_arcmin = max_arcmin;
+                winner_threshold = threshold;
+                VsopTrim(model);
+                snprintf(filename, sizeof(filename), "output/vsop_%s_%d.txt", tier->name, (int)model->body);
+                CHECK(VsopWriteTrunc(model, filename));
+            }
+        }
+    }
 
+    if (winner_terms < 0)
+    {
+        fprintf(stderr, "SearchVsopTier: could not find a %s tier solution for body %d\n", tier->name, body);
+        error = 1;
+        goto fail;
+    }
+
+    printf("SearchVsopTier(WINNER): tier=%s, body=%d, terms=%d, arcmin=%0.6lf, threshold=%0.4le\n", tier->name, body, winner_terms, winner_arcmin, winner_threshold);
+    fflush(stdout);
+    error = 0;
 fail:
-    ephem_close();
     return error;
 }
 
+static int VsopTierJob(int body)
+{
+    int error, i;
+    size_t t;
+    vsop_model_t model;
+    double *ref = NULL;
+    const int nsamples = 1 + (int)((julian_date(MAX_YEAR, 1, 1, 0.0) - julian_date(MIN_YEAR, 1, 1, 0.0)) / TIER_SAMPLE_DAYS);
+
+    VsopInit(&model);
+
+    ref = malloc(3 * nsamples * sizeof(double));
+    if (ref == NULL)
+    {
+        fprintf(stderr, "VsopTierJob: out of memory\n");
+        error = 1;
+        goto fail;
+    }
+
+    CHECK(LoadVsopFile(&model, body));
+
+    /* Sample the complete series once; every truncation is compared against it. */
+    for (i=0; i < nsamples; ++i)
+        CHECK(VsopCalc(&model, julian_date(MIN_YEAR, 1, 1, 0.0) + i*TIER_SAMPLE_DAYS, &ref[3*i]));
+
+    for (t=0; t < NUM_VSOP_TIERS; ++t)
+        CHECK(SearchVsopTier(&model, body, &VsopTier[t], nsamples, ref));
+
+    error = 0;
+fail:
+    VsopFreeModel(&model);
+    free(ref);
+    return error;
+}
+
+static int GenerateVsopTiers(void)
+{
+    static const int bodies[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    return RunBodyJobs(VsopTierJob, bodies, (int)(sizeof(bodies) / sizeof(bodies[0])));
+}
+
 static double PlanetOrbitalPeriod(int body)
 {
     switch (body)
@@ -686,6 +933,129 @@ static void PrintApsis(FILE *outfile, int kind, double jdx, double dist)
     fprintf(outfile, "%d %04d-%02d-%02dT%02d:%02d:%02dZ %12.7lf\n", kind, (int)year, (int)month, (int)day, hour, minute, second, dist);
 }
 
+typedef struct
+{
+    int     body;       /* NOVAS body code */
+    int     ncoeff;     /* Chebyshev coefficients per coordinate */
+    double  ndays;      /* maximum length of each segment */
+}
+ephemeris_plan_t;
+
+/* Segment sizes match the compiled-in Chebyshev models written by 'generate source'. */
+static const ephemeris_plan_t EphemerisPlan[] =
+{
+    { BODY_MERCURY, 32,   100.0 },
+    { BODY_VENUS,   40,   800.0 },
+    { BODY_EARTH,   40,   280.0 },
+    { BODY_MARS,    36,  1200.0 },
+    { BODY_JUPITER, 32,  7305.0 },
+    { BODY_SATURN,  36, 14610.0 },
+    { BODY_URANUS,  36, 24350.0 },
+    { BODY_NEPTUNE, 36, 24350.0 },
+    { BODY_PLUTO,   19, 22830.0 }
+};
+
+#define EPHEMERIS_NUM_BODIES    ((int)(sizeof(EphemerisPlan) / sizeof(EphemerisPlan[0])))
+
+static int EphemerisSampleFunc(const void *context, double jd, double pos[CHEB_MAX_DIM])
+{
+    const sample_context_t *c = context;
+    return NovasBodyPos(jd, c->body, pos);
+}
+
+static int WriteDoubles(FILE *outfile, const double *data, size_t count)
+{
+    return (fwrite(data, sizeof(double), count, outfile) == count) ? 0 : 1;
+}
+
+static int GenerateEphemerisFile(const char *outFileName, int startYear, int stopYear)
+{
+    int error, b, s, k, i, nsegments[EPHEMERIS_NUM_BODIES];
+    double ndays[EPHEMERIS_NUM_BODIES];
+    double jdStart, jdStop, jd, offset;
+    double header[2], entry[6], triplet[3];
+    double coeff[CHEB_MAX_DIM][CHEB_MAX_POLYS];
+    ChebEncoder encoder;
+    sample_context_t context;
+    FILE *outfile = NULL;
+
+    if (startYear < MIN_YEAR || stopYear < startYear || MAX_YEAR <= stopYear)
+    {
+        fprintf(stderr, "GenerateEphemerisFile: Invalid year range %d..%d\n", startYear, stopYear);
+        error = 1;
+        goto fail;
+    }
+
+    CHECK(OpenEphem());
+
+    jdStart = julian_date((short)startYear, 1, 1, 0.0) - 1.0;   /* subtract 1 day for light travel time allowance */
+    jdStop = julian_date((short)(stopYear+1), 1, 1, 0.0);
+
+    outfile = fopen(outFileName, "wb");
+    if (outfile == NULL)
+    {
+        fprintf(stderr, "GenerateEphemerisFile: Cannot open output file: %s\n", outFileName);
+        error = 1;
+        goto fail;
+    }
+
+    /* Write the magic string, the format version, and the number of bodies. */
+    if (fwrite("ASTROEPH", 1, 8, outfile) != 8) goto write_fail;
+    header[0] = 1.0;
+    header[1] = EPHEMERIS_NUM_BODIES;
+    if (WriteDoubles(outfile, header, 2)) goto write_fail;
+
+    /* Write the body directory. The coefficient blocks follow it in the same order. */
+    offset = 24.0 + EPHEMERIS_NUM_BODIES * sizeof(entry);
+    for (b=0; b < EPHEMERIS_NUM_BODIES; ++b)
+    {
+        /* Shorten the segments slightly so they exactly cover the requested years. */
+        nsegments[b] = (int)ceil((jdStop - jdStart) / EphemerisPlan[b].ndays);
+        ndays[b] = (jdStop - jdStart) / nsegments[b];
+        entry[0] = (EphemerisPlan[b].body == BODY_EARTH) ? 2 : EphemerisPlan[b].body;     /* astro_body_t code */
+        entry[1] = EphemerisPlan[b].ncoeff;
+        entry[2] = nsegments[b];
+        entry[3] = jdStart - 2451545.0;
+        entry[4] = ndays[b];
+        entry[5] = offset;
+        if (WriteDoubles(outfile, entry, 6)) goto write_fail;
+        offset += (double)nsegments[b] * EphemerisPlan[b].ncoeff * sizeof(triplet);
+    }
+
+    for (b=0; b < EPHEMERIS_NUM_BODIES; ++b)
+    {
+        CHECK(ChebInit(&encoder, EphemerisPlan[b].ncoeff, 3));
+        context.body = EphemerisPlan[b].body;
+        for (s=0; s < nsegments[b]; ++s)
+        {
+            jd = jdStart + s*ndays[b];
+            CHECK(ChebGenerate(&encoder, EphemerisSampleFunc, &context, jd, jd + ndays[b], coeff));
+            for (k=0; k < EphemerisPlan[b].ncoeff; ++k)
+            {
+                for (i=0; i < 3; ++i)
+                    triplet[i] = coeff[i][k];
+                if (WriteDoubles(outfile, triplet, 3)) goto write_fail;
+            }
+        }
+        printf("GenerateEphemerisFile: body %d, %d segments of %d coefficients.\n", EphemerisPlan[b].body, nsegments[b], EphemerisPlan[b].ncoeff);
+    }
+
+    error = 0;
+    goto fail;
+
+write_fail:
+    fprintf(stderr, "GenerateEphemerisFile: Error writing to file: %s\n", outFileName);
+    error = 1;
+fail:
+    if (outfile != NULL)
+    {
+        fclose(outfile);
+        if (error)
+            remove(outFileName);
+    }
+    return error;
+}
+
 static int GenerateApsisFile(int body, const char *outFileName)
 {
     int error = 1;
@@ -815,36 +1185,42 @@ fail:
     return error;
 }
 
-static int GenerateApsisTestData(void)
+static int ApsisJob(int body)
 {
     int error;
-
-    CHECK(OpenEphem());
+    char filename[100];
 
     /*
         Tricky: BODY_EARTH=11, but we write to output/apsis_2.txt.
         The BODY_EARTH is my extension here for working around NOVAS,
         but Astronomy Engine uses 2 to represent the Earth.
     */
-    CHECK(GenerateApsisFile(BODY_MERCURY, "apsides/apsis_0.txt"));
-    CHECK(GenerateApsisFile(BODY_VENUS,   "apsides/apsis_1.txt"));
-    CHECK(GenerateApsisFile(BODY_EARTH,   "apsides/apsis_2.txt"));
-    CHECK(GenerateApsisFile(BODY_MARS,    "apsides/apsis_3.txt"));
-    CHECK(GenerateApsisFile(BODY_JUPITER, "apsides/apsis_4.txt"));
-    CHECK(GenerateApsisFile(BODY_SATURN,  "apsides/apsis_5.txt"));
-    CHECK(GenerateApsisFile(BODY_URANUS,  "apsides/apsis_6.txt"));
-    CHECK(GenerateApsisFile(BODY_NEPTUNE, "apsides/apsis_7.txt"));
-    CHECK(GenerateApsisFile(BODY_PLUTO,   "apsides/apsis_8.txt"));
+    snprintf(filename, sizeof(filename), "apsides/apsis_%d.txt", (body == BODY_EARTH) ? 2 : body);
+
+    CHECK(OpenEphem());
+    CHECK(GenerateApsisFile(body, filename));
 
 fail:
     ephem_close();
     return error;
 }
 
+static int GenerateApsisTestData(void)
+{
+    static const int bodies[] =
+    {
+        BODY_MERCURY, BODY_VENUS, BODY_EARTH, BODY_MARS, BODY_JUPITER,
+        BODY_SATURN, BODY_URANUS, BODY_NEPTUNE, BODY_PLUTO
+    };
+    return RunBodyJobs(ApsisJob, bodies, (int)(sizeof(bodies) / sizeof(bodies[0])));
+}
+
 static int GenerateSource(void)
 {
     int error;
     CHECK(GenerateCode(CODEGEN_LANGUAGE_C, "../source/c/astronomy.c", "template/astronomy.c",  "output"));
+    CHECK(GenerateCode(CODEGEN_LANGUAGE_C, "../source/c/astronomy_cheb.h", "template/astronomy_cheb.h",  "output"));
+    CHECK(GenerateCode(CODEGEN_LANGUAGE_C, "../source/c/astronomy.hpp", "template/astronomy.hpp",  "output"));
     CHECK(GenerateCode(CODEGEN_LANGUAGE_CSHARP, "../source/csharp/astronomy.cs", "template/astronomy.cs",  "output"));
     CHECK(GenerateCode(CODEGEN_LANGUAGE_JS, "../source/js/astronomy.js", "template/astronomy.js", "output"));
     CHECK(GenerateCode(CODEGEN_LANGUAGE_PYTHON, "../source/python/astronomy.py", "template/astronomy.py", "output"));
@@ -135,6 +135,22 @@ if !FASTMODE! == true (
         output\vsop_6.txt
         output\vsop_7.txt
         output\vsop_11.txt
+        output\vsop_low_0.txt
+        output\vsop_low_1.txt
+        output\vsop_low_3.txt
+        output\vsop_low_4.txt
+        output\vsop_low_5.txt
+        output\vsop_low_6.txt
+        output\vsop_low_7.txt
+        output\vsop_low_11.txt
+        output\vsop_high_0.txt
+        output\vsop_high_1.txt
+        output\vsop_high_3.txt
+        output\vsop_high_4.txt
+        output\vsop_high_5.txt
+        output\vsop_high_6.txt
+        output\vsop_high_7.txt
+        output\vsop_high_11.txt
     ) do (
         if not exist %%f (
             echo.Missing required planet model file: %%f
@@ -153,6 +169,11 @@ if !FASTMODE! == false (
         echo.FATAL: !GENEXE! planets
         exit /b 1
     )
+    !GENEXE! tiers
+    if errorlevel 1 (
+        echo.FATAL: !GENEXE! tiers
+        exit /b 1
+    )
 )
 
 echo.
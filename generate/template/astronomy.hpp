@@ -0,0 +1,209 @@
+/*
+    Astronomy Engine for C/C++.
+    https://github.com/cosinekitty/astronomy
+
+    MIT License
+
+    Copyright (c) 2019-2020 Don Cross <cosinekitty@gmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+/*
+    Header-only C++ wrapper for Astronomy Engine.
+
+    This file adds templates whose body is a compile-time parameter, for example:
+
+        astro::Vector v = astro::helio<astro::Body::Jupiter>(tt);
+
+    The VSOP87 series for each planet are emitted by the code generator as constexpr
+    arrays, and each specialization of astro::helio sums its own planet's arrays directly.
+    The compiler therefore knows every series length and can inline and unroll the
+    whole calculation into the caller, with no runtime switch on the body
+    and no status field to check.
+
+    The tables are the same ones astronomy.c uses in its default configuration,
+    so the results agree with Astronomy_HelioVector to within rounding error.
+    (If astronomy.c is compiled with ASTRONOMY_ACCURACY_ARCMIN or
+    ASTRONOMY_CHEBYSHEV_PLANETS, the two may differ by as much as that accuracy setting allows.)
+
+    Requires C++11 or later. This header includes astronomy.h, so the C functions
+    are all available too; link with astronomy.c as usual.
+*/
+
+#ifndef __ASTRONOMY_HPP
+#define __ASTRONOMY_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include "astronomy.h"
+
+/** @cond DOXYGEN_SKIP */
+/*
+    Since C++17, the tables can be inline variables, so every translation unit
+    that includes this header refers to the same arrays. Before that, each
+    translation unit gets its own private copy of the tables.
+*/
+#if __cplusplus >= 201703L
+#define ASTRO_VSOP_TABLE    inline constexpr
+#else
+#define ASTRO_VSOP_TABLE    constexpr
+#endif
+/** @endcond */
+
+namespace astro
+{
+    /**
+     * @brief A celestial body, usable as a template argument.
+     *
+     * The values are the same as the corresponding #astro_body_t values,
+     * so a `Body` can be cast to #astro_body_t to call the C functions.
+     */
+    enum class Body
+    {
+        Mercury = BODY_MERCURY,
+        Venus   = BODY_VENUS,
+        Earth   = BODY_EARTH,
+        Mars    = BODY_MARS,
+        Jupiter = BODY_JUPITER,
+        Saturn  = BODY_SATURN,
+        Uranus  = BODY_URANUS,
+        Neptune = BODY_NEPTUNE,
+        Pluto   = BODY_PLUTO,
+        Sun     = BODY_SUN,
+        Moon    = BODY_MOON,
+        EMB     = BODY_EMB,
+        SSB     = BODY_SSB
+    };
+
+    /**
+     * @brief A Cartesian vector in astronomical units (AU), in the J2000 equatorial orientation (EQJ).
+     */
+    struct Vector
+    {
+        double x;
+        double y;
+        double z;
+    };
+
+    /** @cond DOXYGEN_SKIP */
+    namespace detail
+    {
+        struct vsop_term
+        {
+            double amplitude;
+            double phase;
+            double frequency;
+        };
+
+        template <std::size_t N>
+        inline double vsop_series(const vsop_term (&term)[N], double t)
+        {
+            double sum = 0.0;
+            for (std::size_t i = 0; i < N; ++i)
+                sum += term[i].amplitude * std::cos(term[i].phase + (t * term[i].frequency));
+            return sum;
+        }
+
+        template <typename model>
+        inline Vector vsop_position(double tt)
+        {
+            const double t = tt / 365250;     /* millennia since 2000 */
+
+            /* Calculate the VSOP "B" trigonometric series to obtain ecliptic spherical coordinates. */
+            const double lon = model::lon(t);
+            const double lat = model::lat(t);
+            const double rad = model::rad(t);
+
+            /* Convert ecliptic spherical coordinates to ecliptic Cartesian coordinates. */
+            const double r_coslat = rad * std::cos(lat);
+            const double ex = r_coslat * std::cos(lon);
+            const double ey = r_coslat * std::sin(lon);
+            const double ez = rad * std::sin(lat);
+
+            /* Convert ecliptic Cartesian coordinates to equatorial Cartesian coordinates. */
+            return Vector {
+                ex + 0.000000440360*ey - 0.000000190919*ez,
+                -0.000000479966*ex + 0.917482137087*ey - 0.397776982902*ez,
+                0.397776982902*ey + 0.917482137087*ez
+            };
+        }
+
+        template <Body body>
+        struct unsupported_body : std::false_type {};
+
+$ASTRO_CPP_VSOP(Mercury);
+
+$ASTRO_CPP_VSOP(Venus);
+
+$ASTRO_CPP_VSOP(Earth);
+
+$ASTRO_CPP_VSOP(Mars);
+
+$ASTRO_CPP_VSOP(Jupiter);
+
+$ASTRO_CPP_VSOP(Saturn);
+
+$ASTRO_CPP_VSOP(Uranus);
+
+$ASTRO_CPP_VSOP(Neptune);
+
+    }
+    /** @endcond */
+
+    /**
+     * @brief Calculates the heliocentric position of a body at a given time.
+     *
+     * This is the compile-time counterpart of #Astronomy_HelioVector.
+     * It is specialized for the Sun and the planets Mercury through Neptune.
+     * Using it with any other body is a compile-time error;
+     * call #Astronomy_HelioVector for those bodies instead.
+     *
+     * @param tt
+     *      Terrestrial Time expressed in days since noon on January 1, 2000,
+     *      the same as the `tt` field of #astro_time_t.
+     *
+     * @return
+     *      The body's position in AU, relative to the center of the Sun,
+     *      in the J2000 equatorial orientation (EQJ).
+     */
+    template <Body body>
+    inline Vector helio(double tt)
+    {
+        static_assert(detail::unsupported_body<body>::value,
+            "astro::helio supports only the Sun and Mercury through Neptune; use Astronomy_HelioVector for other bodies.");
+        return Vector { tt, tt, tt };
+    }
+
+    template <> inline Vector helio<Body::Sun>    (double)    { return Vector { 0.0, 0.0, 0.0 }; }
+    template <> inline Vector helio<Body::Mercury>(double tt) { return detail::vsop_position<detail::vsop_Mercury>(tt); }
+    template <> inline Vector helio<Body::Venus>  (double tt) { return detail::vsop_position<detail::vsop_Venus>  (tt); }
+    template <> inline Vector helio<Body::Earth>  (double tt) { return detail::vsop_position<detail::vsop_Earth>  (tt); }
+    template <> inline Vector helio<Body::Mars>   (double tt) { return detail::vsop_position<detail::vsop_Mars>   (tt); }
+    template <> inline Vector helio<Body::Jupiter>(double tt) { return detail::vsop_position<detail::vsop_Jupiter>(tt); }
+    template <> inline Vector helio<Body::Saturn> (double tt) { return detail::vsop_position<detail::vsop_Saturn> (tt); }
+    template <> inline Vector helio<Body::Uranus> (double tt) { return detail::vsop_position<detail::vsop_Uranus> (tt); }
+    template <> inline Vector helio<Body::Neptune>(double tt) { return detail::vsop_position<detail::vsop_Neptune>(tt); }
+}
+
+#undef ASTRO_VSOP_TABLE
+
+#endif  /* ifndef __ASTRONOMY_HPP */
@@ -35,6 +35,14 @@ import math
 import datetime
 import enum
 import re
+import sys
+import array
+
+try:
+    # The optional compiled extension module built by build_native.
+    import _astronomy as _native
+except ImportError:
+    _native = None
 
 _CalcMoonCount = 0
 
@@ -1747,6 +1755,197 @@ def Horizon(time, observer, ra, dec, refraction):
 
     return HorizontalCoordinates(az, 90.0 - zd, hor_ra, hor_dec)
 
+def _BatchInput(values, count, name):
+    # Convert a sequence, array, or single number into a contiguous array of doubles
+    # that the compiled extension module can read directly.
+    if isinstance(values, (int, float)):
+        return array.array('d', [values]) * count
+    numpy = sys.modules.get('numpy')
+    if numpy is not None and isinstance(values, numpy.ndarray):
+        values = numpy.ascontiguousarray(values, dtype=numpy.float64)
+    elif not (isinstance(values, array.array) and values.typecode == 'd'):
+        values = array.array('d', values)
+    if len(values) != count:
+        raise Error('Batch input {} has {} elements, but {} are required.'.format(name, len(values), count))
+    return values
+
+def _BatchOutput(ut, count):
+    # Results are numpy arrays when the times were passed in as a numpy array,
+    # otherwise array.array('d') objects.
+    numpy = sys.modules.get('numpy')
+    if numpy is not None and isinstance(ut, numpy.ndarray):
+        return numpy.empty(count)
+    return array.array('d', [0.0]) * count
+
+def _NativeBatch():
+    # The compiled extension module uses the C engine's default Delta T model.
+    # Use it only when _DeltaT has not been replaced with another model.
+    return (_native is not None) and (_DeltaT is DeltaT_EspenakMeeus)
+
+def _BatchStatus(status):
+    # Translate an astro_status_t value returned by the compiled extension module.
+    if status == 0:
+        return
+    if status == 2:     # ASTRO_INVALID_BODY
+        raise InvalidBodyError()
+    if status == 7:     # ASTRO_EARTH_NOT_ALLOWED
+        raise EarthNotAllowedError()
+    raise Error('The compiled extension module returned status {}.'.format(status))
+
+def HelioVectorBatch(body, ut):
+    """Calculates heliocentric Cartesian coordinates of a body for many times at once.
+
+    This is a batch version of #HelioVector. When the optional compiled extension
+    module `_astronomy` (built by `build_native`) is available, the whole batch is
+    calculated by the C version of Astronomy Engine without holding the
+    Python global interpreter lock, so batches in separate threads run in parallel.
+    Otherwise, or when the default Delta T model has been replaced,
+    this function calls #HelioVector for each time.
+
+    Parameters
+    ----------
+    body : Body
+        A body for which to calculate a heliocentric position: the Sun, Moon, EMB, SSB, or any of the planets.
+    ut : sequence of float
+        The times at which to calculate the positions, each expressed as the
+        `ut` attribute of a #Time object. A numpy array works without being copied.
+
+    Returns
+    -------
+    tuple
+        Three arrays `(x, y, z)` of coordinates in AU, in the J2000 equatorial orientation (EQJ).
+        They are numpy arrays if `ut` is a numpy array, otherwise `array.array('d')` objects.
+    """
+    ut_array = _BatchInput(ut, len(ut), 'ut')
+    count = len(ut_array)
+    x = _BatchOutput(ut, count)
+    y = _BatchOutput(ut, count)
+    z = _BatchOutput(ut, count)
+    if _NativeBatch():
+        _BatchStatus(_native.helio_vector(body.value, count, ut_array, x, y, z))
+    else:
+        for i in range(count):
+            vec = HelioVector(body, Time(ut_array[i]))
+            x[i] = vec.x
+            y[i] = vec.y
+            z[i] = vec.z
+    return (x, y, z)
+
+def EquatorBatch(body, ut, latitude, longitude, height, ofdate, aberration):
+    """Calculates equatorial coordinates of a body for many times and observers at once.
+
+    This is a batch version of #Equator. Element `i` of each result is the same
+    as `Equator(body, Time(ut[i]), Observer(latitude[i], longitude[i], height[i]), ofdate, aberration)`.
+    When the optional compiled extension module `_astronomy` is available,
+    the whole batch runs in the C version of Astronomy Engine without holding
+    the Python global interpreter lock. Otherwise, or when the default Delta T model
+    has been replaced, this function calls #Equator for each element.
+
+    Parameters
+    ----------
+    body : Body
+        The celestial body to be observed. Not allowed to be `Body.Earth`.
+    ut : sequence of float
+        The times of the observations, each expressed as the `ut` attribute of a #Time object.
+    latitude : float or sequence of float
+        The observers' geographic latitudes in degrees.
+        A single number applies to every time.
+    longitude : float or sequence of float
+        The observers' geographic longitudes in degrees.
+        A single number applies to every time.
+    height : float or sequence of float
+        The observers' elevations above sea level in meters.
+        A single number applies to every time.
+    ofdate : bool
+        If `True`, returns coordinates using the equator and equinox of date.
+        If `False`, returns coordinates converted to the J2000 system.
+    aberration : bool
+        If `True`, corrects for aberration of light.
+
+    Returns
+    -------
+    tuple
+        Three arrays `(ra, dec, dist)`: right ascensions in sidereal hours,
+        declinations in degrees, and distances in AU.
+        They are numpy arrays if `ut` is a numpy array, otherwise `array.array('d')` objects.
+    """
+    ut_array = _BatchInput(ut, len(ut), 'ut')
+    count = len(ut_array)
+    lat_array = _BatchInput(latitude, count, 'latitude')
+    lon_array = _BatchInput(longitude, count, 'longitude')
+    height_array = _BatchInput(height, count, 'height')
+    ra = _BatchOutput(ut, count)
+    dec = _BatchOutput(ut, count)
+    dist = _BatchOutput(ut, count)
+    if _NativeBatch():
+        _BatchStatus(_native.equator(body.value, count, ut_array, lat_array, lon_array, height_array, ofdate, aberration, ra, dec, dist))
+    else:
+        for i in range(count):
+            observer = Observer(lat_array[i], lon_array[i], height_array[i])
+            equ = Equator(body, Time(ut_array[i]), observer, ofdate, aberration)
+            ra[i] = equ.ra
+            dec[i] = equ.dec
+            dist[i] = equ.dist
+    return (ra, dec, dist)
+
+def HorizonBatch(ut, latitude, longitude, height, ra, dec, refraction):
+    """Calculates horizontal coordinates for many times and observers at once.
+
+    This is a batch version of #Horizon. Element `i` of each result is the same as the
+    azimuth and altitude returned by
+    `Horizon(Time(ut[i]), Observer(latitude[i], longitude[i], height[i]), ra[i], dec[i], refraction)`.
+    When the optional compiled extension module `_astronomy` is available,
+    the whole batch runs in the C version of Astronomy Engine without holding
+    the Python global interpreter lock. Otherwise, or when the default Delta T model
+    has been replaced, this function calls #Horizon for each element.
+
+    Parameters
+    ----------
+    ut : sequence of float
+        The times of the observations, each expressed as the `ut` attribute of a #Time object.
+    latitude : float or sequence of float
+        The observers' geographic latitudes in degrees.
+        A single number applies to every time.
+    longitude : float or sequence of float
+        The observers' geographic longitudes in degrees.
+        A single number applies to every time.
+    height : float or sequence of float
+        The observers' elevations above sea level in meters.
+        A single number applies to every time.
+    ra : float or sequence of float
+        Equator-of-date right ascensions in sidereal hours, as for #Horizon.
+    dec : float or sequence of float
+        Equator-of-date declinations in degrees, as for #Horizon.
+    refraction : Refraction
+        The option for selecting whether to correct for atmospheric lensing.
+
+    Returns
+    -------
+    tuple
+        Two arrays `(azimuth, altitude)` in degrees.
+        They are numpy arrays if `ut` is a numpy array, otherwise `array.array('d')` objects.
+    """
+    if not (Refraction.Airless.value <= refraction.value <= Refraction.JplHorizons.value):
+        raise Error('Invalid refraction type')
+    ut_array = _BatchInput(ut, len(ut), 'ut')
+    count = len(ut_array)
+    lat_array = _BatchInput(latitude, count, 'latitude')
+    lon_array = _BatchInput(longitude, count, 'longitude')
+    height_array = _BatchInput(height, count, 'height')
+    ra_array = _BatchInput(ra, count, 'ra')
+    dec_array = _BatchInput(dec, count, 'dec')
+    azimuth = _BatchOutput(ut, count)
+    altitude = _BatchOutput(ut, count)
+    if _NativeBatch():
+        _BatchStatus(_native.horizon(count, ut_array, lat_array, lon_array, height_array, ra_array, dec_array, refraction.value, azimuth, altitude))
+    else:
+        for i in range(count):
+            observer = Observer(lat_array[i], lon_array[i], height_array[i])
+            hor = Horizon(Time(ut_array[i]), observer, ra_array[i], dec_array[i], refraction)
+            azimuth[i] = hor.azimuth
+            altitude[i] = hor.altitude
+    return (azimuth, altitude)
+
 def RefractionAngle(refraction, altitude):
     """Calculates the amount of "lift" to an altitude angle caused by atmospheric refraction.
 
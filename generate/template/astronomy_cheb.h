@@ -0,0 +1,47 @@
+/*
+    Astronomy Engine for C/C++.
+    https://github.com/cosinekitty/astronomy
+
+    MIT License
+
+    Copyright (c) 2019-2020 Don Cross <cosinekitty@gmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Optional Chebyshev tables for the planets Mercury through Neptune.
+
+    This file is included by astronomy.c only when it is compiled with
+    ASTRONOMY_CHEBYSHEV_PLANETS defined. Otherwise it is not needed.
+
+    The tables are resampled from the same truncated VSOP87 series that
+    astronomy.c uses, so both give the same positions to within 1.0e-9 AU.
+    They cover the years 1900 through 2099. Outside that range,
+    astronomy.c falls back to evaluating the VSOP87 series.
+*/
+
+$ASTRO_C_VSOP_CHEBYSHEV(Mercury);
+$ASTRO_C_VSOP_CHEBYSHEV(Venus);
+$ASTRO_C_VSOP_CHEBYSHEV(Earth);
+$ASTRO_C_VSOP_CHEBYSHEV(Mars);
+$ASTRO_C_VSOP_CHEBYSHEV(Jupiter);
+$ASTRO_C_VSOP_CHEBYSHEV(Saturn);
+$ASTRO_C_VSOP_CHEBYSHEV(Uranus);
+$ASTRO_C_VSOP_CHEBYSHEV(Neptune);
@@ -1047,6 +1047,84 @@ def Refraction():
 
 #-----------------------------------------------------------------------------------------------------------
 
+def _BatchCompare(label, batch, scalar, tolerance):
+    for i in range(len(scalar)):
+        diff = vabs(batch[i] - scalar[i])
+        if diff > tolerance:
+            print('PY BatchTest({}): ERROR - element {}: batch={}, scalar={}, diff={}'.format(label, i, batch[i], scalar[i], diff))
+            return 1
+    return 0
+
+def _BatchCheck(kind):
+    ut = [-36500.0 + 731.3*i for i in range(100)]
+    lat = [-60.0 + 1.2*i for i in range(100)]
+    lon = [-170.0 + 3.4*i for i in range(100)]
+    height = 123.0
+    for body in [astronomy.Body.Sun, astronomy.Body.Moon, astronomy.Body.Mars, astronomy.Body.Pluto]:
+        # The native module runs the C engine, which agrees with the Python code to within rounding error.
+        (x, y, z) = astronomy.HelioVectorBatch(body, ut)
+        vec = [astronomy.HelioVector(body, astronomy.Time(t)) for t in ut]
+        if _BatchCompare(kind + ' helio x', x, [v.x for v in vec], 1.0e-12): return 1
+        if _BatchCompare(kind + ' helio y', y, [v.y for v in vec], 1.0e-12): return 1
+        if _BatchCompare(kind + ' helio z', z, [v.z for v in vec], 1.0e-12): return 1
+
+        (ra, dec, dist) = astronomy.EquatorBatch(body, ut, lat, lon, height, True, True)
+        equ = [astronomy.Equator(body, astronomy.Time(ut[i]), astronomy.Observer(lat[i], lon[i], height), True, True) for i in range(len(ut))]
+        if _BatchCompare(kind + ' ra',   ra,   [e.ra   for e in equ], 1.0e-9): return 1
+        if _BatchCompare(kind + ' dec',  dec,  [e.dec  for e in equ], 1.0e-9): return 1
+        if _BatchCompare(kind + ' dist', dist, [e.dist for e in equ], 1.0e-12): return 1
+
+        (az, alt) = astronomy.HorizonBatch(ut, lat, lon, height, ra, dec, astronomy.Refraction.Normal)
+        hor = [astronomy.Horizon(astronomy.Time(ut[i]), astronomy.Observer(lat[i], lon[i], height), ra[i], dec[i], astronomy.Refraction.Normal) for i in range(len(ut))]
+        if _BatchCompare(kind + ' alt', alt, [h.altitude for h in hor], 1.0e-9): return 1
+        for i in range(len(ut)):
+            # Compare azimuths modulo 360 degrees.
+            diff = vabs((az[i] - hor[i].azimuth + 180.0) % 360.0 - 180.0)
+            if diff > 1.0e-9:
+                print('PY BatchTest({} az): ERROR - element {}: batch={}, scalar={}'.format(kind, i, az[i], hor[i].azimuth))
+                return 1
+
+    try:
+        astronomy.HelioVectorBatch(astronomy.Body.Invalid, ut)
+        print('PY BatchTest({}): ERROR - HelioVectorBatch allowed an invalid body.'.format(kind))
+        return 1
+    except astronomy.InvalidBodyError:
+        pass
+
+    try:
+        astronomy.EquatorBatch(astronomy.Body.Moon, ut, lat[1:], lon, height, True, True)
+        print('PY BatchTest({}): ERROR - EquatorBatch allowed a short latitude list.'.format(kind))
+        return 1
+    except astronomy.Error:
+        pass
+
+    Debug('PY BatchTest({}): PASS'.format(kind))
+    return 0
+
+def BatchTest():
+    native = astronomy._native
+    if native is not None:
+        if _BatchCheck('native'):
+            return 1
+    try:
+        astronomy._native = None
+        if _BatchCheck('python'):
+            return 1
+    finally:
+        astronomy._native = native
+    # A replaced Delta T model must be honored whether or not the native module is built.
+    deltat = astronomy._DeltaT
+    try:
+        astronomy._DeltaT = lambda ut: 100.0
+        if _BatchCheck('deltat'):
+            return 1
+    finally:
+        astronomy._DeltaT = deltat
+    print('PY BatchTest: PASS ({})'.format('native module' if native else 'native module not built'))
+    return 0
+
+#-----------------------------------------------------------------------------------------------------------
+
 def PlanetApsis():
     degree_threshold = 0.1
     start_time = astronomy.Time.Make(1700, 1, 1, 0, 0, 0)
@@ -1538,6 +1616,7 @@ def Transit():
 #-----------------------------------------------------------------------------------------------------------
 
 UnitTests = {
+    'batch':                    BatchTest,
     'constellation':            Constellation,
     'elongation':               Elongation,
     'global_solar_eclipse':     GlobalSolarEclipse,
@@ -0,0 +1,117 @@
+'use strict';
+/*
+    test_wasm.js  -  Don Cross <cosinekitty.com>
+
+    https://github.com/cosinekitty/astronomy
+
+    Compares the batch functions of the WebAssembly build
+    (source/wasm/astronomy_wasm.js) against the JavaScript version astronomy.js.
+*/
+
+const Astronomy = require('../source/js/astronomy.js');
+const AstronomyWasm = require('../source/wasm/astronomy_wasm.js');
+
+function Compare(label, batch, scalar, tolerance) {
+    for (let i = 0; i < scalar.length; ++i) {
+        const diff = Math.abs(batch[i] - scalar[i]);
+        if (!(diff <= tolerance)) {
+            console.error(`JS WasmTest(${label}): element ${i}: batch=${batch[i]}, scalar=${scalar[i]}, diff=${diff}`);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+function Check(engine) {
+    const count = 100;
+    const ut = new Float64Array(count);
+    const lat = new Float64Array(count);
+    const lon = new Float64Array(count);
+    for (let i = 0; i < count; ++i) {
+        ut[i] = -36500 + 731.3*i;
+        lat[i] = -60 + 1.2*i;
+        lon[i] = -170 + 3.4*i;
+    }
+    const observers = { latitude: lat, longitude: lon, height: 123 };
+
+    for (let body of ['Sun', 'Moon', 'Mars', 'Pluto']) {
+        // The C and JavaScript versions agree to within rounding error in the positions.
+        const vec = engine.HelioVectorBatch(body, ut);
+        const helio = Array.from(ut, t => Astronomy.HelioVector(body, Astronomy.MakeTime(t)));
+        if (Compare(`${body} helio x`, vec.x, helio.map(v => v.x), 1.0e-12)) return 1;
+        if (Compare(`${body} helio y`, vec.y, helio.map(v => v.y), 1.0e-12)) return 1;
+        if (Compare(`${body} helio z`, vec.z, helio.map(v => v.z), 1.0e-12)) return 1;
+
+        const equ = engine.EquatorBatch(body, ut, observers, true, true);
+        const scalar = Array.from(ut, (t, i) => Astronomy.Equator(body, Astronomy.MakeTime(t), Astronomy.MakeObserver(lat[i], lon[i], 123), true, true));
+        if (Compare(`${body} ra`,   equ.ra,   scalar.map(e => e.ra),   1.0e-9 )) return 1;
+        if (Compare(`${body} dec`,  equ.dec,  scalar.map(e => e.dec),  1.0e-9 )) return 1;
+        if (Compare(`${body} dist`, equ.dist, scalar.map(e => e.dist), 1.0e-12)) return 1;
+
+        const hor = engine.HorizonBatch(ut, observers, equ.ra, equ.dec, 'normal');
+        const shor = Array.from(ut, (t, i) => Astronomy.Horizon(Astronomy.MakeTime(t), Astronomy.MakeObserver(lat[i], lon[i], 123), equ.ra[i], equ.dec[i], 'normal'));
+        if (Compare(`${body} altitude`, hor.altitude, shor.map(h => h.altitude), 1.0e-9)) return 1;
+        const azdiff = Array.from(hor.azimuth, (az, i) => ((az - shor[i].azimuth + 540) % 360) - 180);
+        if (Compare(`${body} azimuth`, azdiff, azdiff.map(() => 0), 1.0e-9)) return 1;
+    }
+
+    // Rise times at a location where the Sun does not rise for weeks in the winter.
+    const tromso = Astronomy.MakeObserver(69.65, 18.96, 0);
+    const start = Array.from({length: 365}, (_, i) => Astronomy.MakeTime(new Date('2020-01-01T00:00:00Z')).ut + i);
+    const rise = engine.SearchRiseSetBatch('Sun', tromso, +1, start, 1);
+    for (let i = 0; i < start.length; ++i) {
+        const evt = Astronomy.SearchRiseSet('Sun', tromso, +1, Astronomy.MakeTime(start[i]), 1);
+        const expected = evt ? evt.ut : NaN;
+        if (isNaN(expected) !== isNaN(rise[i])) {
+            console.error(`JS WasmTest(rise): day ${i}: batch=${rise[i]}, scalar=${expected}`);
+            return 1;
+        }
+        if (!isNaN(expected) && Math.abs(expected - rise[i]) * 86400 > 1.0) {
+            console.error(`JS WasmTest(rise): day ${i}: batch=${rise[i]}, scalar=${expected}, diff=${(expected - rise[i])*86400} seconds`);
+            return 1;
+        }
+    }
+    if (!rise.some(isNaN)) {
+        console.error('JS WasmTest(rise): expected some days with no sunrise.');
+        return 1;
+    }
+
+    try {
+        engine.HelioVectorBatch('Vulcan', ut);
+        console.error('JS WasmTest: allowed invalid body.');
+        return 1;
+    } catch (e) {
+    }
+
+    try {
+        engine.EquatorBatch('Moon', ut, { latitude: lat.subarray(1), longitude: lon, height: 0 }, true, true);
+        console.error('JS WasmTest: allowed a short latitude array.');
+        return 1;
+    } catch (e) {
+    }
+
+    return 0;
+}
+
+async function Main() {
+    const fs = require('fs');
+    const path = require('path');
+    if (!fs.existsSync(path.join(__dirname, '../source/wasm/astronomy.wasm'))) {
+        console.log('JS WasmTest: SKIPPED (WebAssembly modules have not been built)');
+        return 0;
+    }
+    for (let simd of [false, true]) {
+        if (simd && !AstronomyWasm.SimdSupported())
+            continue;
+        const engine = await AstronomyWasm.Load({ simd: simd });
+        if (Check(engine))
+            return 1;
+        console.log(`JS WasmTest(${simd ? 'simd' : 'plain'}): PASS`);
+    }
+    return 0;
+}
+
+if (require.main === module)
+    Main().then(rc => process.exit(rc), e => { console.error(e); process.exit(1); });
+else
+    module.exports = { Check };
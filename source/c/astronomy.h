@@ -51,7 +51,8 @@ typedef enum
     ASTRO_WRONG_MOON_QUARTER,       /**< Internal error: Astronomy_NextMoonQuarter found the wrong moon quarter. */
     ASTRO_INTERNAL_ERROR,           /**< A self-check failed inside the code somewhere, indicating a bug needs to be fixed. */
     ASTRO_INVALID_PARAMETER,        /**< A parameter value passed to a function was not valid. */
-    ASTRO_FAIL_NEPTUNE_APSIS        /**< Special-case logic for finding Neptune apsis failed. */
+    ASTRO_FAIL_NEPTUNE_APSIS,       /**< Special-case logic for finding Neptune apsis failed. */
+    ASTRO_SEARCH_PENDING            /**< A resumable search needs more calls to #Astronomy_SearchStep before it has a result. */
 }
 astro_status_t;
 
@@ -144,6 +145,28 @@ typedef struct
 }
 astro_time_t;
 
+/**
+ * @brief Selects how #Astronomy_TimeGrid handles the Earth's nutation at each time.
+ */
+typedef enum
+{
+    NUTATION_LAZY,          /**< Each time calculates its own nutation when it is first needed. */
+    NUTATION_INTERPOLATE    /**< Nutation is calculated at grid knots and interpolated for the times between them. */
+}
+astro_nutation_t;
+
+/**
+ * @brief Selects how nutation is calculated for times whose nutation is not yet known.
+ *
+ * See #Astronomy_SetNutationModel.
+ */
+typedef enum
+{
+    NUTATION_MODEL_EXACT,           /**< Evaluate the IAU2000B nutation series for each time. This is the default. */
+    NUTATION_MODEL_INTERPOLATED     /**< Interpolate between evaluations of the series at whole TT days. */
+}
+astro_nutation_model_t;
+
 /**
  * @brief A calendar date and time expressed in UTC.
  */
@@ -171,6 +194,25 @@ typedef struct
 }
 astro_vector_t;
 
+/**
+ * @brief The position and velocity of a body, expressed as 3D Cartesian vectors.
+ *
+ * Position components are expressed in Astronomical Units (AU).
+ * Velocity components are expressed in AU/day.
+ */
+typedef struct
+{
+    astro_status_t status;  /**< `ASTRO_SUCCESS` if this struct is valid; otherwise an error code. */
+    double x;               /**< The Cartesian position x-coordinate in AU. */
+    double y;               /**< The Cartesian position y-coordinate in AU. */
+    double z;               /**< The Cartesian position z-coordinate in AU. */
+    double vx;              /**< The Cartesian velocity x-component in AU/day. */
+    double vy;              /**< The Cartesian velocity y-component in AU/day. */
+    double vz;              /**< The Cartesian velocity z-component in AU/day. */
+    astro_time_t t;         /**< The date and time at which this state vector is valid. */
+}
+astro_state_vector_t;
+
 /**
  * @brief Spherical coordinates: latitude, longitude, distance.
  */
@@ -221,6 +263,19 @@ astro_body_t;
 #define MIN_YEAR    1700    /**< Minimum year value supported by Astronomy Engine. */
 #define MAX_YEAR    2200    /**< Maximum year value supported by Astronomy Engine. */
 
+/**
+ * @brief Heliocentric positions of every supported body at one time.
+ *
+ * Filled in by #Astronomy_Snapshot.
+ */
+typedef struct
+{
+    astro_status_t status;              /**< `ASTRO_SUCCESS` if this struct is valid; otherwise an error code. */
+    astro_time_t t;                     /**< The date and time at which the positions are valid. */
+    astro_vector_t helio[MAX_BODY+1];   /**< Heliocentric J2000 equatorial position of each body, indexed by #astro_body_t. */
+}
+astro_snapshot_t;
+
 /**
  * @brief The location of an observer on (or near) the surface of the Earth.
  *
@@ -238,6 +293,34 @@ typedef struct
 }
 astro_observer_t;
 
+/**
+ * @brief Precalculated quantities for an observer at a fixed location on the Earth.
+ *
+ * Every calculation of a topocentric position or of horizontal coordinates
+ * needs trigonometric functions of the observer's latitude and longitude,
+ * along with the observer's geocentric position on the Earth's ellipsoid.
+ * When an observer stays at one place for many calculations,
+ * these quantities can be calculated once with #Astronomy_MakeObserverState
+ * and passed to functions like #Astronomy_EquatorState, #Astronomy_HorizonState,
+ * and #Astronomy_SearchRiseSetState.
+ *
+ * The fields of this structure should be treated as read-only.
+ */
+typedef struct
+{
+    astro_observer_t observer;  /**< The geographic location from which this state was calculated. */
+    double sinlat;              /**< The sine of the observer's latitude. */
+    double coslat;              /**< The cosine of the observer's latitude. */
+    double sinlon;              /**< The sine of the observer's longitude. */
+    double coslon;              /**< The cosine of the observer's longitude. */
+    double axial_km;            /**< The observer's distance from the Earth's rotation axis, in kilometers. */
+    double polar_km;            /**< The observer's distance north of the Earth's equatorial plane, in kilometers. */
+    double zenith[3];           /**< Unit vector toward the zenith, in Earth-fixed equatorial coordinates. */
+    double north[3];            /**< Unit vector toward the northern horizon, in Earth-fixed equatorial coordinates. */
+    double west[3];             /**< Unit vector toward the western horizon, in Earth-fixed equatorial coordinates. */
+}
+astro_observer_state_t;
+
 /**
  * @brief Equatorial angular coordinates.
  *
@@ -384,6 +467,75 @@ astro_func_result_t;
  */
 typedef astro_func_result_t (* astro_search_func_t) (void *context, astro_time_t time);
 
+/**
+ * @brief A real value and its rate of change, returned by a function whose ascending root is to be found.
+ *
+ * This is the result type returned by callback functions passed to #Astronomy_SearchWithDerivative.
+ * It is the same as #astro_func_result_t, with the addition of `slope`.
+ */
+typedef struct
+{
+    astro_status_t status;      /**< `ASTRO_SUCCESS` if this struct is valid; otherwise an error code. */
+    double value;               /**< The value returned by a function whose ascending root is to be found. */
+    double slope;               /**< The rate of change of `value` per day. An approximation is acceptable; see #Astronomy_SearchWithDerivative. */
+}
+astro_deriv_result_t;
+
+/**
+ * @brief A pointer to a function that is to be passed as a callback to #Astronomy_SearchWithDerivative.
+ *
+ * This is the same as #astro_search_func_t, only the function returns the rate of change
+ * of its value along with the value itself.
+ */
+typedef astro_deriv_result_t (* astro_search_deriv_func_t) (void *context, astro_time_t time);
+
+/**
+ * @brief A function that receives each root found by #Astronomy_SearchAll.
+ *
+ * The `context` is the same pointer that was passed to #Astronomy_SearchAll,
+ * `time` is the time of the root, and `direction` is +1 if the function
+ * increases through zero at that time or -1 if it decreases through zero.
+ * The function returns `ASTRO_SUCCESS` to keep the search going; any other value
+ * stops the search, and #Astronomy_SearchAll returns that value.
+ */
+typedef astro_status_t (* astro_root_func_t) (void *context, astro_time_t time, int direction);
+
+/**
+ * @brief Statistics about calls to #Astronomy_Search or #Astronomy_SearchWithDerivative for one search function.
+ *
+ * These statistics are collected only when Astronomy Engine is compiled with
+ * the preprocessor symbol `ASTRONOMY_SEARCH_STATS` defined.
+ * See #Astronomy_GetSearchStats for more information.
+ */
+typedef struct
+{
+    const char *tag;                    /**< The name of the search function, or "other" for a function outside Astronomy Engine. */
+    long        searches;               /**< The number of calls to #Astronomy_Search or #Astronomy_SearchWithDerivative. */
+    long        failures;               /**< The number of searches that did not succeed, for any reason. */
+    long        evaluations;            /**< The total number of times the search function was called. */
+    long        iterations;             /**< The total number of iterations of the search loop. */
+    long        quad_hits;              /**< Iterations where quadratic interpolation (or a Newton step, for #Astronomy_SearchWithDerivative) narrowed the search window or finished the search. */
+    long        bisections;             /**< Iterations that fell back to dividing the search window in half. */
+    double      max_final_width_seconds;    /**< The widest final time window of any successful search, in seconds. */
+    double      sum_final_width_seconds;    /**< The sum of the final time windows of all successful searches, in seconds. */
+}
+astro_search_stats_t;
+
+/**
+ * @brief Statistics about one of the internal calculations counted by #Astronomy_GetStats.
+ *
+ * These statistics are collected only when Astronomy Engine is compiled with
+ * the preprocessor symbol `ASTRONOMY_PROFILE` defined.
+ * See #Astronomy_GetStats for more information.
+ */
+typedef struct
+{
+    const char *name;       /**< The name of the calculation, such as "CalcVsop" or "light_time_iteration". */
+    long        calls;      /**< The number of times the calculation was performed. */
+    double      seconds;    /**< The total time spent in the calculation, in seconds, if `ASTRONOMY_PROFILE_TIME` is defined; otherwise 0. */
+}
+astro_profile_stats_t;
+
 /**
  * @brief A pointer to a function that calculates Delta T.
  *
@@ -400,8 +552,12 @@ typedef double (* astro_deltat_func) (double ut);
 
 double Astronomy_DeltaT_EspenakMeeus(double ut);
 double Astronomy_DeltaT_JplHorizons(double ut);
+double Astronomy_DeltaT_Table(double ut);
+astro_status_t Astronomy_SetDeltaTTable(int count, const double ut[], const double dt[]);
 
 void Astronomy_SetDeltaTFunction(astro_deltat_func func);
+void Astronomy_SetThreadDeltaTFunction(astro_deltat_func func);
+astro_status_t Astronomy_SetNutationModel(astro_nutation_model_t model);
 
 /**
  * @brief Indicates whether a body (especially Mercury or Venus) is best seen in the morning or evening.
@@ -545,6 +701,15 @@ typedef struct
 }
 astro_lunar_eclipse_t;
 
+/**
+ * @brief A function that receives each lunar eclipse found by #Astronomy_LunarEclipseCatalog.
+ *
+ * The `context` is the same pointer that was passed to `Astronomy_LunarEclipseCatalog`.
+ * The function returns `ASTRO_SUCCESS` to keep the catalog going; any other value
+ * stops the catalog, and `Astronomy_LunarEclipseCatalog` returns that value.
+ */
+typedef astro_status_t (* astro_lunar_eclipse_func_t) (void *context, const astro_lunar_eclipse_t *eclipse);
+
 
 /**
  * @brief Reports the time and geographic location of the peak of a solar eclipse.
@@ -651,6 +816,25 @@ typedef struct
 astro_local_solar_eclipse_t;
 
 
+/**
+ * @brief One sample of the center line of a total or annular solar eclipse.
+ *
+ * Returned by #Astronomy_EclipseGroundTrack to report where the axis of the
+ * Moon's shadow meets the Earth's surface at a given time.
+ * The `width` is measured on the ground across the direction the center line is moving,
+ * so the northern and southern limits of the path lie about `width/2` kilometers on either side.
+ */
+typedef struct
+{
+    astro_time_t            time;           /**< The date and time of this sample. */
+    astro_eclipse_kind_t    kind;           /**< `ECLIPSE_TOTAL` or `ECLIPSE_ANNULAR`, as seen on the center line at this time. */
+    double                  latitude;       /**< The geographic latitude where the shadow axis meets the Earth's surface. */
+    double                  longitude;      /**< The geographic longitude where the shadow axis meets the Earth's surface. */
+    double                  width;          /**< The width of the path of totality or annularity, in kilometers. */
+}
+astro_ground_track_t;
+
+
 /**
  * @brief Information about a transit of Mercury or Venus, as seen from the Earth.
  *
@@ -678,6 +862,55 @@ typedef struct
 }
 astro_transit_t;
 
+/**
+ * @brief A function that receives each transit found by #Astronomy_TransitCatalog or #Astronomy_TransitCatalogAll.
+ *
+ * The `context` is the same pointer that was passed to the catalog function,
+ * and `body` is the planet that transits the Sun.
+ * The function returns `ASTRO_SUCCESS` to keep the catalog going; any other value
+ * stops the catalog, and the catalog function returns that value.
+ */
+typedef astro_status_t (* astro_transit_func_t) (void *context, astro_body_t body, const astro_transit_t *transit);
+
+
+/**
+ * @brief The kinds of planetary phenomena reported by #Astronomy_PhenomenaCatalog.
+ */
+typedef enum
+{
+    PHENOMENON_INFERIOR_CONJUNCTION,        /**< Mercury or Venus passes between the Earth and the Sun. */
+    PHENOMENON_SUPERIOR_CONJUNCTION,        /**< The planet is on the opposite side of the Sun from the Earth. */
+    PHENOMENON_OPPOSITION,                  /**< A planet beyond the Earth's orbit appears opposite the Sun in the sky. */
+    PHENOMENON_GREATEST_ELONGATION_EAST,    /**< Mercury or Venus reaches its greatest angle from the Sun in the evening sky. */
+    PHENOMENON_GREATEST_ELONGATION_WEST,    /**< Mercury or Venus reaches its greatest angle from the Sun in the morning sky. */
+    PHENOMENON_STATIONARY_RETROGRADE,       /**< The planet stops moving eastward and begins retrograde motion. */
+    PHENOMENON_STATIONARY_DIRECT            /**< The planet ends retrograde motion and resumes moving eastward. */
+}
+astro_phenomenon_kind_t;
+
+/**
+ * @brief A conjunction, opposition, greatest elongation, or station of a planet.
+ *
+ * Reported by #Astronomy_PhenomenaCatalog and #Astronomy_PhenomenaCatalogAll.
+ */
+typedef struct
+{
+    astro_body_t            body;           /**< The planet. */
+    astro_phenomenon_kind_t kind;           /**< Which phenomenon happens. */
+    astro_time_t            time;           /**< The date and time of the phenomenon. */
+    double                  elongation;     /**< The angle in degrees between the planet and the Sun, as seen from the Earth, at `time`. */
+}
+astro_phenomenon_t;
+
+/**
+ * @brief A function that receives each phenomenon found by #Astronomy_PhenomenaCatalog or #Astronomy_PhenomenaCatalogAll.
+ *
+ * The `context` is the same pointer that was passed to the catalog function.
+ * The function returns `ASTRO_SUCCESS` to keep the catalog going; any other value
+ * stops the catalog, and the catalog function returns that value.
+ */
+typedef astro_status_t (* astro_phenomenon_func_t) (void *context, const astro_phenomenon_t *phenomenon);
+
 
 /**
  * @brief   Aberration calculation options.
@@ -741,6 +974,27 @@ typedef enum
 }
 astro_direction_t;
 
+/**
+ * @brief A rise or set event found by an iterative rise/set search.
+ *
+ * The functions #Astronomy_SearchRiseSetEvent and #Astronomy_NextRiseSetEvent
+ * return this structure to report consecutive rise and set times of a body
+ * in chronological order. Besides the event itself, the structure remembers
+ * the body, the observer, and the culmination or bottom that follows the event,
+ * so that finding the next event does not need to repeat that work.
+ */
+typedef struct
+{
+    astro_status_t          status;         /**< `ASTRO_SUCCESS` if this struct is valid; otherwise an error code. */
+    astro_direction_t       direction;      /**< `DIRECTION_RISE` if the body rises at `time`, or `DIRECTION_SET` if it sets. */
+    astro_time_t            time;           /**< The date and time of the rise or set. */
+    astro_body_t            body;           /**< The body whose rise or set was found. */
+    astro_observer_state_t  observer;       /**< The observer for whom the rise or set was found. */
+    astro_time_t            bracket_time;   /**< For internal use only: the culmination or bottom after `time`. */
+    double                  bracket_alt;    /**< For internal use only: the altitude of the body at `bracket_time`. */
+}
+astro_riseset_t;
+
 
 /**
  * @brief Reports the constellation that a given celestial point lies within.
@@ -761,22 +1015,176 @@ typedef struct
 }
 astro_constellation_t;
 
+/**
+ * @brief Frame calculations shared by all bodies observed at the same date and time.
+ *
+ * Calculating the apparent position of a body involves a lot of work
+ * that depends only on the date and time of the observation, not on the body:
+ * nutation, precession, sidereal time, and the position of the Earth.
+ * An #astro_frame_t holds the results of this work, as calculated by #Astronomy_MakeFrame.
+ * Passing the same frame to #Astronomy_GeoVectorFrame, #Astronomy_EquatorFrame,
+ * or #Astronomy_HorizonFrame for many bodies avoids repeating that work for each body.
+ *
+ * The members other than `status` and `time` are intended for use by Astronomy Engine only.
+ */
+typedef struct
+{
+    astro_status_t   status;        /**< `ASTRO_SUCCESS` if this struct is valid; otherwise an error code. */
+    astro_time_t     time;          /**< The date and time of the frame, with nutation angles already calculated. */
+    double           gast;          /**< Greenwich apparent sidereal time, in sidereal hours. */
+    astro_rotation_t precession;    /**< Precession rotation from J2000 mean equator to mean equator of date. */
+    astro_rotation_t nutation;      /**< Nutation rotation from mean equator of date to true equator of date. */
+    astro_vector_t   earth;         /**< Heliocentric position of the Earth at `time`. */
+}
+astro_frame_t;
+
+#define ASTRO_ROTATION_EPHEMERIS_KNOTS  21  /**< Maximum number of knots stored in an #astro_rotation_ephemeris_t. */
+
+/**
+ * @brief Precession and nutation tabulated across a time window, for fast horizontal rotations.
+ *
+ * Pointing a telescope many times per second needs the rotation from J2000 equatorial
+ * coordinates (EQJ) to the observer's horizon (HOR) far more often than the
+ * precession and nutation parts of that rotation change.
+ * #Astronomy_MakeRotationEphemeris calculates the EQJ to EQD rotation matrix and
+ * the sidereal time offset from the Earth Rotation Angle at evenly spaced knots
+ * across a window of up to 10 days.
+ * #Astronomy_RotationEphemeris_EQJ_HOR then interpolates those quantities for any time
+ * inside the window and calculates only the Earth's rotation exactly.
+ *
+ * The members other than `status`, `start`, `ndays`, and `observer` are intended for use by Astronomy Engine only.
+ */
+typedef struct
+{
+    astro_status_t   status;        /**< `ASTRO_SUCCESS` if this struct is valid; otherwise an error code. */
+    astro_time_t     start;         /**< The beginning of the time window. */
+    double           ndays;         /**< The length of the time window in days. */
+    astro_observer_t observer;      /**< The observer whose horizon is the target orientation. */
+    int              count;         /**< The number of knots in use. */
+    double           step;          /**< The number of days between consecutive knots. */
+    double           zenith[3];     /**< Unit vector toward the zenith, in Earth-fixed equatorial coordinates. */
+    double           north[3];      /**< Unit vector toward the northern horizon, in Earth-fixed equatorial coordinates. */
+    double           west[3];       /**< Unit vector toward the western horizon, in Earth-fixed equatorial coordinates. */
+    double           knot[ASTRO_ROTATION_EPHEMERIS_KNOTS][10];  /**< EQJ to EQD matrix elements and sidereal offset in arcseconds at each knot. */
+}
+astro_rotation_ephemeris_t;
+
+#define ASTRO_TRACKER_COEFFS    8   /**< Number of Chebyshev coefficients used by #astro_tracker_t for each coordinate. */
+
+/**
+ * @brief A short-window polynomial fit of a body's topocentric apparent position.
+ *
+ * Tracking a body in real time calls #Astronomy_Equator and #Astronomy_Horizon
+ * for the same body and observer many times per second.
+ * An #astro_tracker_t, created by #Astronomy_MakeTracker, holds Chebyshev polynomials
+ * fitted to the body's topocentric equator-of-date position across a window of time.
+ * #Astronomy_TrackEquator and #Astronomy_TrackHorizon evaluate those polynomials
+ * instead of repeating the full calculation, and fit a new window automatically
+ * when asked for a time outside the current one.
+ *
+ * The members other than `status`, `body`, `start`, and `ndays` are intended for use by Astronomy Engine only.
+ */
+typedef struct
+{
+    astro_status_t         status;      /**< `ASTRO_SUCCESS` if this struct is valid; otherwise an error code. */
+    astro_body_t           body;        /**< The body being tracked. */
+    astro_time_t           start;       /**< The beginning of the window currently fitted. */
+    double                 ndays;       /**< The length of each fitted window in days. */
+    astro_observer_state_t state;       /**< The observer's location. */
+    double                 offset[2];   /**< Sidereal time minus Earth Rotation Angle at the window start and end, in arcseconds. */
+    double                 coeff[3][ASTRO_TRACKER_COEFFS];  /**< Chebyshev coefficients of the equator-of-date position vector in AU. */
+}
+astro_tracker_t;
+
+/**
+ * @brief Selects which kind of event a resumable search looks for.
+ */
+typedef enum
+{
+    SEARCH_LUNAR_ECLIPSE,           /**< Started by #Astronomy_BeginSearchLunarEclipse. */
+    SEARCH_GLOBAL_SOLAR_ECLIPSE,    /**< Started by #Astronomy_BeginSearchGlobalSolarEclipse. */
+    SEARCH_TRANSIT,                 /**< Started by #Astronomy_BeginSearchTransit. */
+    SEARCH_RISE_SET                 /**< Started by #Astronomy_BeginSearchRiseSet. */
+}
+astro_search_kind_t;
+
+/**
+ * @brief The progress of a search that can be advanced a little at a time.
+ *
+ * Searches such as #Astronomy_SearchTransit can examine hundreds of candidate events
+ * before they find the one they are looking for. A resumable search does the same work,
+ * but it keeps its progress in this structure instead of on the stack, so the caller
+ * can advance it in small steps with #Astronomy_SearchStep and do other work in between.
+ *
+ * Start a search with #Astronomy_BeginSearchLunarEclipse, #Astronomy_BeginSearchGlobalSolarEclipse,
+ * #Astronomy_BeginSearchTransit, or #Astronomy_BeginSearchRiseSet.
+ * While `status` is `ASTRO_SEARCH_PENDING`, keep calling #Astronomy_SearchStep.
+ * When the search finishes, `status` holds the final status, and the result member
+ * for the kind of search holds the same result as the corresponding blocking function.
+ *
+ * The state does not point into itself, so it may be copied or moved between steps.
+ * The members other than `status`, `kind`, `candidates`, `evaluations`,
+ * and the result for the kind of search are intended for use by Astronomy Engine only.
+ */
+typedef struct
+{
+    astro_status_t                  status;         /**< `ASTRO_SEARCH_PENDING` until the search finishes, then the status of its result. */
+    astro_search_kind_t             kind;           /**< The kind of event being searched for. */
+    int                             candidates;     /**< The number of candidate events examined so far. */
+    long                            evaluations;    /**< The number of times the search has evaluated a search function so far. */
+    astro_time_t                    time;           /**< Where the search for the next candidate starts. */
+    astro_body_t                    body;           /**< The planet for a transit search, or the body for a rise/set search. */
+    double                          planet_radius_km;   /**< The mean radius of the planet for a transit search. */
+    astro_observer_state_t          observer;       /**< The observer for a rise/set search. */
+    astro_direction_t               direction;      /**< Rise or set, for a rise/set search. */
+    double                          limit_days;     /**< How many days to search for a rise or set. */
+    astro_time_t                    time_before;    /**< The lower bound of the current rise/set bracket. */
+    astro_time_t                    time_after;     /**< The upper bound of the current rise/set bracket. */
+    double                          alt_before;     /**< The body's altitude at `time_before`. */
+    double                          alt_after;      /**< The body's altitude at `time_after`. */
+    astro_lunar_eclipse_t           lunar_eclipse;  /**< The result of a lunar eclipse search. */
+    astro_global_solar_eclipse_t    solar_eclipse;  /**< The result of a global solar eclipse search. */
+    astro_transit_t                 transit;        /**< The result of a transit search. */
+    astro_search_result_t           rise_set;       /**< The result of a rise/set search. */
+}
+astro_search_state_t;
+
 /*---------- functions ----------*/
 
 double Astronomy_VectorLength(astro_vector_t vector);
 const char *Astronomy_BodyName(astro_body_t body);
 astro_body_t Astronomy_BodyCode(const char *name);
 astro_observer_t Astronomy_MakeObserver(double latitude, double longitude, double height);
+astro_observer_state_t Astronomy_MakeObserverState(astro_observer_t observer);
 astro_time_t Astronomy_CurrentTime(void);
 astro_time_t Astronomy_MakeTime(int year, int month, int day, int hour, int minute, double second);
 astro_time_t Astronomy_TimeFromUtc(astro_utc_t utc);
 astro_utc_t  Astronomy_UtcFromTime(astro_time_t time);
 astro_time_t Astronomy_TimeFromDays(double ut);
 astro_time_t Astronomy_AddDays(astro_time_t time, double days);
+astro_status_t Astronomy_TimeGrid(astro_time_t start, double step, int count, astro_nutation_t nutation, astro_time_t times[]);
+astro_status_t Astronomy_LoadEphemeris(const char *filename);
+void Astronomy_UnloadEphemeris(void);
 astro_func_result_t Astronomy_HelioDistance(astro_body_t body, astro_time_t time);
 astro_vector_t Astronomy_HelioVector(astro_body_t body, astro_time_t time);
+astro_status_t Astronomy_Snapshot(astro_time_t time, astro_snapshot_t *snapshot);
+astro_vector_t Astronomy_HelioVectorTol(astro_body_t body, astro_time_t time, double tolerance);
+astro_status_t Astronomy_HelioVectorRaw(astro_body_t body, double tt, double pos[3]);
+
+astro_status_t Astronomy_HelioVectorBatch(
+    astro_body_t body,
+    int count,
+    const double tt[],
+    double x[],
+    double y[],
+    double z[]);
+
 astro_vector_t Astronomy_GeoVector(astro_body_t body, astro_time_t time, astro_aberration_t aberration);
+astro_status_t Astronomy_GeoVectorRaw(astro_body_t body, double tt, astro_aberration_t aberration, double pos[3]);
 astro_vector_t Astronomy_GeoMoon(astro_time_t time);
+astro_state_vector_t Astronomy_HelioState(astro_body_t body, astro_time_t time);
+astro_state_vector_t Astronomy_GeoState(astro_body_t body, astro_time_t time);
+astro_state_vector_t Astronomy_GeoMoonState(astro_time_t time);
 
 astro_equatorial_t Astronomy_Equator(
     astro_body_t body,
@@ -786,6 +1194,23 @@ astro_equatorial_t Astronomy_Equator(
     astro_aberration_t aberration
 );
 
+astro_equatorial_t Astronomy_EquatorState(
+    astro_body_t body,
+    astro_time_t *time,
+    const astro_observer_state_t *state,
+    astro_equator_date_t equdate,
+    astro_aberration_t aberration
+);
+
+astro_status_t Astronomy_EquatorRaw(
+    astro_body_t body,
+    astro_time_t *time,
+    const astro_observer_state_t *state,
+    astro_equator_date_t equdate,
+    astro_aberration_t aberration,
+    double radec[3]
+);
+
 astro_ecliptic_t Astronomy_SunPosition(astro_time_t time);
 astro_ecliptic_t Astronomy_Ecliptic(astro_vector_t equ);
 astro_angle_result_t Astronomy_EclipticLongitude(astro_body_t body, astro_time_t time);
@@ -797,6 +1222,35 @@ astro_horizon_t Astronomy_Horizon(
     double dec,
     astro_refraction_t refraction);
 
+astro_horizon_t Astronomy_HorizonState(
+    astro_time_t *time,
+    const astro_observer_state_t *state,
+    double ra,
+    double dec,
+    astro_refraction_t refraction);
+
+astro_frame_t Astronomy_MakeFrame(astro_time_t time);
+astro_vector_t Astronomy_GeoVectorFrame(astro_body_t body, const astro_frame_t *frame, astro_aberration_t aberration);
+
+astro_equatorial_t Astronomy_EquatorFrame(
+    astro_body_t body,
+    const astro_frame_t *frame,
+    astro_observer_t observer,
+    astro_equator_date_t equdate,
+    astro_aberration_t aberration
+);
+
+astro_horizon_t Astronomy_HorizonFrame(
+    const astro_frame_t *frame,
+    astro_observer_t observer,
+    double ra,
+    double dec,
+    astro_refraction_t refraction);
+
+astro_tracker_t Astronomy_MakeTracker(astro_body_t body, astro_observer_t observer, astro_time_t start, double ndays);
+astro_equatorial_t Astronomy_TrackEquator(astro_tracker_t *tracker, astro_time_t time);
+astro_status_t Astronomy_TrackHorizon(astro_tracker_t *tracker, astro_time_t time, astro_refraction_t refraction, astro_horizon_t *hor);
+
 astro_angle_result_t Astronomy_AngleFromSun(astro_body_t body, astro_time_t time);
 astro_elongation_t Astronomy_Elongation(astro_body_t body, astro_time_t time);
 astro_elongation_t Astronomy_SearchMaxElongation(astro_body_t body, astro_time_t startTime);
@@ -806,15 +1260,69 @@ astro_angle_result_t Astronomy_MoonPhase(astro_time_t time);
 astro_search_result_t Astronomy_SearchMoonPhase(double targetLon, astro_time_t startTime, double limitDays);
 astro_moon_quarter_t Astronomy_SearchMoonQuarter(astro_time_t startTime);
 astro_moon_quarter_t Astronomy_NextMoonQuarter(astro_moon_quarter_t mq);
+
+astro_status_t Astronomy_MoonQuarterCalendar(
+    astro_time_t startTime,
+    astro_time_t stopTime,
+    astro_moon_quarter_t quarters[],
+    int capacity,
+    int *count);
+
 astro_lunar_eclipse_t Astronomy_SearchLunarEclipse(astro_time_t startTime);
 astro_lunar_eclipse_t Astronomy_NextLunarEclipse(astro_time_t prevEclipseTime);
+
+astro_status_t Astronomy_LunarEclipseCatalog(
+    astro_time_t startTime,
+    astro_time_t stopTime,
+    astro_lunar_eclipse_func_t func,
+    void *context);
+
 astro_global_solar_eclipse_t Astronomy_SearchGlobalSolarEclipse(astro_time_t startTime);
 astro_global_solar_eclipse_t Astronomy_NextGlobalSolarEclipse(astro_time_t prevEclipseTime);
 astro_local_solar_eclipse_t Astronomy_SearchLocalSolarEclipse(astro_time_t startTime, astro_observer_t observer);
 astro_local_solar_eclipse_t Astronomy_NextLocalSolarEclipse(astro_time_t prevEclipseTime, astro_observer_t observer);
+
+astro_status_t Astronomy_LocalSolarEclipseBatch(
+    astro_global_solar_eclipse_t eclipse,
+    int count,
+    const astro_observer_t observers[],
+    astro_local_solar_eclipse_t local[]);
+
+astro_status_t Astronomy_EclipseGroundTrack(
+    astro_global_solar_eclipse_t eclipse,
+    double step_seconds,
+    astro_ground_track_t track[],
+    int capacity,
+    int *count);
 astro_transit_t Astronomy_SearchTransit(astro_body_t body, astro_time_t startTime);
 astro_transit_t Astronomy_NextTransit(astro_body_t body, astro_time_t prevTransitTime);
 
+astro_status_t Astronomy_TransitCatalog(
+    astro_body_t body,
+    astro_time_t startTime,
+    astro_time_t stopTime,
+    astro_transit_func_t func,
+    void *context);
+
+astro_status_t Astronomy_TransitCatalogAll(
+    astro_time_t startTime,
+    astro_time_t stopTime,
+    astro_transit_func_t func,
+    void *context);
+
+astro_status_t Astronomy_PhenomenaCatalog(
+    astro_body_t body,
+    astro_time_t startTime,
+    astro_time_t stopTime,
+    astro_phenomenon_func_t func,
+    void *context);
+
+astro_status_t Astronomy_PhenomenaCatalogAll(
+    astro_time_t startTime,
+    astro_time_t stopTime,
+    astro_phenomenon_func_t func,
+    void *context);
+
 astro_search_result_t Astronomy_Search(
     astro_search_func_t func,
     void *context,
@@ -822,6 +1330,41 @@ astro_search_result_t Astronomy_Search(
     astro_time_t t2,
     double dt_tolerance_seconds);
 
+astro_search_result_t Astronomy_SearchWithDerivative(
+    astro_search_deriv_func_t func,
+    void *context,
+    astro_time_t t1,
+    astro_time_t t2,
+    double dt_tolerance_seconds);
+
+astro_status_t Astronomy_SearchAll(
+    astro_search_func_t func,
+    void *context,
+    astro_time_t t1,
+    astro_time_t t2,
+    double min_separation,
+    int nthreads,
+    astro_root_func_t callback);
+
+astro_status_t Astronomy_BeginSearchLunarEclipse(astro_search_state_t *state, astro_time_t startTime);
+astro_status_t Astronomy_BeginSearchGlobalSolarEclipse(astro_search_state_t *state, astro_time_t startTime);
+astro_status_t Astronomy_BeginSearchTransit(astro_search_state_t *state, astro_body_t body, astro_time_t startTime);
+
+astro_status_t Astronomy_BeginSearchRiseSet(
+    astro_search_state_t *state,
+    astro_body_t body,
+    const astro_observer_state_t *observer,
+    astro_direction_t direction,
+    astro_time_t startTime,
+    double limitDays);
+
+astro_status_t Astronomy_SearchStep(astro_search_state_t *state, int max_evaluations);
+
+int Astronomy_GetSearchStats(astro_search_stats_t stats[], int max);
+void Astronomy_ResetSearchStats(void);
+int Astronomy_GetStats(astro_profile_stats_t stats[], int max);
+void Astronomy_ResetStats(void);
+
 astro_search_result_t Astronomy_SearchSunLongitude(
     double targetLon,
     astro_time_t startTime,
@@ -840,8 +1383,36 @@ astro_search_result_t Astronomy_SearchRiseSet(
     astro_time_t startTime,
     double limitDays);
 
+astro_search_result_t Astronomy_SearchRiseSetState(
+    astro_body_t body,
+    const astro_observer_state_t *state,
+    astro_direction_t direction,
+    astro_time_t startTime,
+    double limitDays);
+
+astro_riseset_t Astronomy_SearchRiseSetEvent(
+    astro_body_t body,
+    astro_observer_t observer,
+    astro_time_t startTime,
+    double limitDays);
+
+astro_riseset_t Astronomy_NextRiseSetEvent(astro_riseset_t prev, double limitDays);
+
+astro_status_t Astronomy_RiseSetTable(
+    int nobservers,
+    const astro_observer_t observers[],
+    int nbodies,
+    const astro_body_t bodies[],
+    astro_time_t startTime,
+    int ndays,
+    int nthreads,
+    astro_search_result_t rise[],
+    astro_search_result_t set[]);
+
 astro_seasons_t Astronomy_Seasons(int year);
+astro_status_t Astronomy_SeasonsRange(int year1, int year2, astro_seasons_t seasons[]);
 astro_illum_t Astronomy_Illumination(astro_body_t body, astro_time_t time);
+astro_deriv_result_t Astronomy_MagnitudeRate(astro_body_t body, astro_time_t time);
 astro_illum_t Astronomy_SearchPeakMagnitude(astro_body_t body, astro_time_t startTime);
 astro_apsis_t Astronomy_SearchLunarApsis(astro_time_t startTime);
 astro_apsis_t Astronomy_NextLunarApsis(astro_apsis_t apsis);
@@ -850,13 +1421,38 @@ astro_apsis_t Astronomy_NextPlanetApsis(astro_body_t body, astro_apsis_t apsis);
 
 astro_rotation_t Astronomy_InverseRotation(astro_rotation_t rotation);
 astro_rotation_t Astronomy_CombineRotation(astro_rotation_t a, astro_rotation_t b);
+void Astronomy_InverseRotationRaw(const double rot[3][3], double inv[3][3]);
+void Astronomy_CombineRotationRaw(const double a[3][3], const double b[3][3], double c[3][3]);
 astro_vector_t Astronomy_VectorFromSphere(astro_spherical_t sphere, astro_time_t time);
 astro_spherical_t Astronomy_SphereFromVector(astro_vector_t vector);
 astro_vector_t Astronomy_VectorFromEquator(astro_equatorial_t equ, astro_time_t time);
 astro_equatorial_t Astronomy_EquatorFromVector(astro_vector_t vector);
 astro_vector_t Astronomy_VectorFromHorizon(astro_spherical_t sphere, astro_time_t time, astro_refraction_t refraction);
 astro_spherical_t Astronomy_HorizonFromVector(astro_vector_t vector, astro_refraction_t refraction);
+
+astro_status_t Astronomy_HorizonBatch(
+    astro_rotation_t rotation,
+    astro_refraction_t refraction,
+    int count,
+    const double ra[],
+    const double dec[],
+    double azimuth[],
+    double altitude[]);
+
+astro_status_t Astronomy_HorizonGrid(
+    astro_body_t body,
+    astro_time_t *time,
+    const double latitude[],
+    const double longitude[],
+    const double height[],
+    int count,
+    double azimuth[],
+    double altitude[],
+    astro_refraction_t refraction,
+    int nthreads);
+
 astro_vector_t Astronomy_RotateVector(astro_rotation_t rotation, astro_vector_t vector);
+void Astronomy_RotateVectorRaw(const double rot[3][3], const double in[3], double out[3]);
 
 astro_rotation_t Astronomy_Rotation_EQD_EQJ(astro_time_t time);
 astro_rotation_t Astronomy_Rotation_EQD_ECL(astro_time_t time);
@@ -871,11 +1467,32 @@ astro_rotation_t Astronomy_Rotation_HOR_EQD(astro_time_t time, astro_observer_t
 astro_rotation_t Astronomy_Rotation_HOR_EQJ(astro_time_t time, astro_observer_t observer);
 astro_rotation_t Astronomy_Rotation_HOR_ECL(astro_time_t time, astro_observer_t observer);
 
+astro_rotation_ephemeris_t Astronomy_MakeRotationEphemeris(astro_time_t start, double ndays, astro_observer_t observer);
+astro_rotation_t Astronomy_RotationEphemeris_EQJ_HOR(const astro_rotation_ephemeris_t *ephem, astro_time_t time);
+
 double Astronomy_Refraction(astro_refraction_t refraction, double altitude);
 double Astronomy_InverseRefraction(astro_refraction_t refraction, double bent_altitude);
 
+astro_status_t Astronomy_RefractionBatch(
+    astro_refraction_t refraction,
+    int count,
+    const double altitude[],
+    double refr[]);
+
+astro_status_t Astronomy_InverseRefractionBatch(
+    astro_refraction_t refraction,
+    int count,
+    const double bent_altitude[],
+    double refr[]);
+
 astro_constellation_t Astronomy_Constellation(double ra, double dec);
 
+astro_status_t Astronomy_ConstellationBatch(
+    int count,
+    const double ra[],
+    const double dec[],
+    astro_constellation_t constel[]);
+
 #ifdef __cplusplus
 }
 #endif
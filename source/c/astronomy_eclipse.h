@@ -0,0 +1,2434 @@
+/*
+    Astronomy Engine for C/C++.
+    https://github.com/cosinekitty/astronomy
+
+    MIT License
+
+    Copyright (c) 2019-2020 Don Cross <cosinekitty@gmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Optional eclipse tables generated by generate/eclipse_table.c. Do not edit.
+
+    This file is included by astronomy.c only when it is compiled with
+    ASTRONOMY_ECLIPSE_TABLES defined. Otherwise it is not needed.
+
+    Each record holds the result of a full lunar eclipse search or global
+    solar eclipse search, along with the full/new moon the search found.
+    The tables cover the years 1700 through 2199 using the default
+    Delta T model. Outside that range, astronomy.c falls back to searching.
+*/
+
+#define ECLIPSE_TABLE_START_UT  -109572.5
+#define ECLIPSE_TABLE_STOP_UT   73048.5
+
+static const lunar_eclipse_record_t LunarEclipseTable[] =
+{
+    { -109509.18179152603, -109509.18244633639, 162.57789774681441, 106.6437693068292, 49.042645103763789, ECLIPSE_TOTAL },
+    { -109331.95630443242, -109331.95738526271, 187.22187244682573, 117.15846401173621, 51.143407090567052, ECLIPSE_TOTAL },
+    { -109154.51565670905, -109154.52102483199, 138.83357597398572, 69.787368988618255, 0, ECLIPSE_PARTIAL },
+    { -108977.92896387576, -108977.93598012709, 154.16873669950292, 57.507803068729118, 0, ECLIPSE_PARTIAL },
+    { -108829.44460433976, -108829.43493760144, 97.743143853731453, 0, 0, ECLIPSE_PENUMBRAL },
+    { -108799.89149000663, -108799.90173668982, 53.086769267683849, 0, 0, ECLIPSE_PENUMBRAL },
+    { -108653.10392053655, -108653.09630316806, 121.58127912436612, 0, 0, ECLIPSE_PENUMBRAL },
+    { -108475.21490523539, -108475.20960189169, 169.14201509440318, 87.768858693307266, 0, ECLIPSE_PARTIAL },
+    { -108298.45162670268, -108298.44957987274, 156.54435435659252, 102.05453422036953, 40.215574329486117, ECLIPSE_TOTAL },
+    { -108121.2290137107, -108121.22922699375, 189.89708871231414, 117.88445144891739, 52.724870183737949, ECLIPSE_TOTAL },
+    { -107943.72908005184, -107943.73227270109, 153.71738316840492, 96.136839890386909, 18.458122563315555, ECLIPSE_TOTAL },
+    { -107767.19475901627, -107767.2003971833, 163.26254039886408, 81.493050819262862, 0, ECLIPSE_PARTIAL },
+    { -107618.60275764026, -107618.59175442351, 69.993828737642616, 0, 0, ECLIPSE_PENUMBRAL },
+    { -107589.13055467857, -107589.13955209574, 102.7351209637709, 0, 0, ECLIPSE_PENUMBRAL },
+    { -107442.37587788609, -107442.36631471342, 76.250545548973605, 0, 0, ECLIPSE_PENUMBRAL },
+    { -107412.87222656919, -107412.8820664071, 86.65477569680661, 0, 0, ECLIPSE_PENUMBRAL },
+    { -107264.44236039725, -107264.43627710784, 165.51658245851286, 79.359807386063039, 0, ECLIPSE_PARTIAL },
+    { -107087.71435065709, -107087.70954548953, 143.51024374016561, 79.22538633341901, 0, ECLIPSE_PARTIAL },
+    { -106910.43079916785, -106910.43081703434, 186.70609115506522, 117.55830042762682, 53.199450743850321, ECLIPSE_TOTAL },
+    { -106733.06598037212, -106733.06607613318, 165.15540032065473, 108.19071075646207, 50.348474036436528, ECLIPSE_TOTAL },
+    { -106556.25980579227, -106556.26553987624, 155.7982425566297, 77.425875080516562, 0, ECLIPSE_PARTIAL },
+    { -106378.61822613397, -106378.62420581127, 154.19544886099175, 72.69214961444959, 0, ECLIPSE_PARTIAL },
+    { -106231.22355407606, -106231.21497741259, 97.365649075945839, 0, 0, ECLIPSE_PENUMBRAL },
+    { -106201.7932672085, -106201.80327067866, 70.702265234431252, 0, 0, ECLIPSE_PENUMBRAL },
+    { -106054.15827578701, -106054.14726180355, 97.185860123718157, 0, 0, ECLIPSE_PENUMBRAL },
+    { -106024.46627088408, -106024.47857582499, 41.037080164533108, 0, 0, ECLIPSE_PENUMBRAL },
+    { -105876.55260833539, -105876.54855501, 149.88358890870586, 88.378112748032436, 0, ECLIPSE_PARTIAL },
+    { -105700.09098927044, -105700.08628842754, 168.85867651901208, 94.050197910983115, 0, ECLIPSE_PARTIAL },
+    { -105521.97728531022, -105521.97819381143, 169.35297342133708, 109.03368440573104, 48.936800578376278, ECLIPSE_TOTAL },
+    { -105345.75516918277, -105345.75669823719, 168.18284142413177, 108.5522602731362, 46.486114219296724, ECLIPSE_TOTAL },
+    { -105167.66873846733, -105167.67556253246, 153.69161336333491, 58.920244487235323, 0, ECLIPSE_PARTIAL },
+    { -104991.14506012735, -104991.15165164394, 127.78076326358132, 44.767720343079418, 0, ECLIPSE_PARTIAL },
+    { -104843.47461550444, -104843.46260561184, 62.91912013082765, 0, 0, ECLIPSE_PENUMBRAL },
+    { -104813.64368171331, -104813.65630982968, 37.641446362249553, 0, 0, ECLIPSE_PENUMBRAL },
+    { -104665.73658399475, -104665.73046557653, 135.65373353543691, 59.537729686126113, 0, ECLIPSE_PARTIAL },
+    { -104489.36908784483, -104489.36310652067, 155.69266695412807, 72.312385080149397, 0, ECLIPSE_PARTIAL },
+    { -104311.20574346285, -104311.20487981402, 173.39647141518071, 111.86896992847323, 50.450609915424138, ECLIPSE_TOTAL },
+    { -104134.95750744935, -104134.95720957896, 165.99366265931167, 108.12939495546743, 50.007343087345362, ECLIPSE_TOTAL },
+    { -103956.97445474581, -103956.9799118848, 167.44492296595126, 86.535034803673625, 0, ECLIPSE_PARTIAL },
+    { -103780.32875577256, -103780.33322850306, 145.85887014982291, 82.852477999404073, 0, ECLIPSE_PARTIAL },
+    { -103632.62081559126, -103632.60944253688, 69.228580225026235, 0, 0, ECLIPSE_PENUMBRAL },
+    { -103602.94853819712, -103602.95993597184, 82.585909244371578, 0, 0, ECLIPSE_PENUMBRAL },
+    { -103455.12762791355, -103455.11789839223, 84.462621366837993, 0, 0, ECLIPSE_PENUMBRAL },
+    { -103425.66976353464, -103425.67890395031, 85.428707047831267, 0, 0, ECLIPSE_PENUMBRAL },
+    { -103278.37063481912, -103278.36554205517, 155.57914210134186, 82.506984143983573, 0, ECLIPSE_PARTIAL },
+    { -103100.75917015855, -103100.75388832578, 163.41447943006642, 85.681499558268115, 0, ECLIPSE_PARTIAL },
+    { -102923.83672314395, -102923.83717051856, 162.19470381969586, 106.74431592458859, 49.547672329936177, ECLIPSE_TOTAL },
+    { -102746.67133938585, -102746.67187845112, 188.06982266250998, 117.9602325707674, 52.832349850796163, ECLIPSE_TOTAL },
+    { -102569.16208272672, -102569.16730217199, 140.08144787047058, 72.372338622808456, 0, ECLIPSE_PARTIAL },
+    { -102392.64354956005, -102392.6499922082, 159.04037897475064, 70.077074960572645, 0, ECLIPSE_PARTIAL },
+    { -102244.09013704062, -102244.08037880925, 96.670862016035244, 0, 0, ECLIPSE_PENUMBRAL },
+    { -102214.53933104436, -102214.54953282581, 56.736585572361946, 0, 0, ECLIPSE_PENUMBRAL },
+    { -102067.80293821763, -102067.79488480008, 113.51713790441863, 0, 0, ECLIPSE_PENUMBRAL },
+    { -102038.38371778531, -102038.39472653679, 50.11664557736367, 0, 0, ECLIPSE_PENUMBRAL },
+    { -101889.87457899393, -101889.86920672808, 169.177102757385, 87.130268124165013, 0, ECLIPSE_PARTIAL },
+    { -101713.14170537912, -101713.13914363399, 154.70314281061292, 99.414940184215084, 33.18778487155214, ECLIPSE_TOTAL },
+    { -101535.89364356444, -101535.89379919402, 189.80106342933141, 117.85507453372702, 52.750591604271904, ECLIPSE_TOTAL },
+    { -101358.42151988643, -101358.4241922364, 156.22204821906053, 99.684602961642668, 31.684019338572398, ECLIPSE_TOTAL },
+    { -101181.84965355454, -101181.85521060017, 163.14747283584438, 82.166121132904664, 0, ECLIPSE_PARTIAL },
+    { -101033.30870831897, -101033.29716300187, 46.901775647420436, 0, 0, ECLIPSE_PENUMBRAL },
+    { -101003.83475411298, -101003.84330325246, 112.7029826422222, 0, 0, ECLIPSE_PENUMBRAL },
+    { -100857.02183303724, -100857.0122049107, 73.116388726048172, 0, 0, ECLIPSE_PENUMBRAL },
+    { -100827.51409724241, -100827.52382131288, 88.160414407029748, 0, 0, ECLIPSE_PENUMBRAL },
+    { -100679.1595680212, -100679.15291489815, 160.96178390784189, 69.227968681370839, 0, ECLIPSE_PARTIAL },
+    { -100502.36183664903, -100502.35686154747, 142.43598140543327, 76.873505607945845, 0, ECLIPSE_PARTIAL },
+    { -100325.14132663733, -100325.14082180987, 185.97489704727195, 117.21308681066148, 52.738442622357979, ECLIPSE_TOTAL },
+    { -100147.72610582589, -100147.72596878928, 165.83381252596155, 108.36911763763055, 50.332420585909858, ECLIPSE_TOTAL },
+    { -99970.948555044393, -99970.953847266661, 157.95202748849988, 83.246065947460011, 0, ECLIPSE_PARTIAL },
+    { -99793.299431664083, -99793.305148292275, 157.38488470204175, 77.576626553200185, 0, ECLIPSE_PARTIAL },
+    { -99645.872248385858, -99645.863546366803, 93.902699601603672, 0, 0, ECLIPSE_PENUMBRAL },
+    { -99616.461374992272, -99616.471037400712, 79.216451507527381, 0, 0, ECLIPSE_PENUMBRAL },
+    { -99468.878149100172, -99468.866609898338, 82.212731492472813, 0, 0, ECLIPSE_PENUMBRAL },
+    { -99439.168355167072, -99439.180339252256, 61.924835118697956, 0, 0, ECLIPSE_PENUMBRAL },
+    { -99291.195663496852, -99291.191471074722, 149.24189195386134, 87.175833428045735, 0, ECLIPSE_PARTIAL },
+    { -99114.804758835264, -99114.799512209007, 164.81229474185966, 87.292858071159571, 0, ECLIPSE_PARTIAL },
+    { -98936.625794216598, -98936.626605531099, 169.9922411958687, 109.49737961869687, 49.418875272385776, ECLIPSE_TOTAL },
+    { -98760.453702502622, -98760.45468020202, 168.38191451621242, 109.52346597681753, 49.344013592926785, ECLIPSE_TOTAL },
+    { -98582.329450805264, -98582.336225913838, 154.80490677407943, 60.802352669415995, 0, ECLIPSE_PARTIAL },
+    { -98405.834391812255, -98405.840473523582, 132.97433621948585, 58.399205227615312, 0, ECLIPSE_PARTIAL },
+    { -98258.138368033775, -98258.126328524086, 60.879841373534873, 0, 0, ECLIPSE_PENUMBRAL },
+    { -98228.310828036367, -98228.323400787194, 42.593224964803085, 0, 0, ECLIPSE_PENUMBRAL },
+    { -98080.430504407093, -98080.423832514687, 130.4600103024859, 45.325518365716562, 0, ECLIPSE_PARTIAL },
+    { -97904.0212193841, -97904.01521519036, 154.84136159881018, 71.499067138647661, 0, ECLIPSE_PARTIAL },
+    { -97725.913838619206, -97725.912377141241, 173.2804628892336, 110.92814676929265, 47.634976508561522, ECLIPSE_TOTAL },
+    { -97549.597827645499, -97549.59746676097, 165.53076081443578, 107.83936487627216, 49.815544229932129, ECLIPSE_TOTAL },
+    { -97371.697754271212, -97371.702610760884, 171.76700690179132, 94.213168469723314, 0, ECLIPSE_PARTIAL },
+    { -97194.967234086536, -97194.971616921292, 146.52528570382856, 83.881012065103278, 0, ECLIPSE_PARTIAL },
+    { -97047.322542333684, -97047.310861149628, 51.634820052422583, 0, 0, ECLIPSE_PENUMBRAL },
+    { -97017.670944606041, -97017.681778314509, 98.094469868810847, 0, 0, ECLIPSE_PENUMBRAL },
+    { -96869.796023577874, -96869.785973263512, 77.418976292246953, 0, 0, ECLIPSE_PENUMBRAL },
+    { -96840.316879781618, -96840.325962342657, 88.445804610382766, 0, 0, ECLIPSE_PENUMBRAL },
+    { -96693.049251838282, -96693.043882613987, 152.48546717804857, 78.104646555148065, 0, ECLIPSE_PARTIAL },
+    { -96515.45063827181, -96515.444943642826, 161.47567596053705, 80.341642883140594, 0, ECLIPSE_PARTIAL },
+    { -96338.495844498175, -96338.496047192733, 161.79003768833354, 106.78593896795064, 49.903072871966287, ECLIPSE_TOTAL },
+    { -96161.381164400998, -96161.381210037944, 188.55272036511451, 118.22111599612981, 53.330314841587096, ECLIPSE_TOTAL },
+    { -95983.812948350329, -95983.817987214192, 141.57813644735143, 75.321121002780274, 0, ECLIPSE_PARTIAL },
+    { -95807.352285312547, -95807.358200947987, 162.93842418934219, 79.023150948341936, 0, ECLIPSE_PARTIAL },
+    { -95658.739609695258, -95658.729729874482, 94.854414352448657, 0, 0, ECLIPSE_PENUMBRAL },
+    { -95629.193042736981, -95629.203164817736, 61.820198111236095, 0, 0, ECLIPSE_PENUMBRAL },
+    { -95482.499261687553, -95482.490793497112, 104.79409534949809, 0, 0, ECLIPSE_PENUMBRAL },
+    { -95453.07897230926, -95453.08948486502, 69.641672715079039, 0, 0, ECLIPSE_PENUMBRAL },
+    { -95304.537150166201, -95304.531686223621, 168.98803062736988, 86.181829157285392, 0, ECLIPSE_PARTIAL },
+    { -95127.830095817801, -95127.827034383372, 152.58346039569005, 96.206067474558949, 22.079222352476791, ECLIPSE_TOTAL },
+    { -94950.559887956042, -94950.55996851041, 189.62468075682409, 117.81971167190932, 52.783800306497142, ECLIPSE_TOTAL },
+    { -94773.113700264366, -94773.115856372577, 158.3612897945568, 102.52604927751236, 39.309762599878013, ECLIPSE_TOTAL },
+    { -94596.503435954917, -94596.508916598264, 162.94512431602925, 82.771420050412416, 0, ECLIPSE_PARTIAL },
+    { -94418.542037186155, -94418.550111345379, 121.86576161999255, 0, 0, ECLIPSE_PENUMBRAL },
+    { -94271.662856119394, -94271.65319394636, 70.929526143008843, 0, 0, ECLIPSE_PENUMBRAL },
+    { -94242.153185868621, -94242.162814789728, 89.108502402668819, 0, 0, ECLIPSE_PENUMBRAL },
+    { -94093.883174139482, -94093.875900590094, 155.24421712383628, 54.478498940588906, 0, ECLIPSE_PARTIAL },
+    { -93917.00396823851, -93916.998867319999, 141.66741981985979, 75.029274554690346, 0, ECLIPSE_PARTIAL },
+    { -93739.857907943326, -93739.856822500471, 184.85165207530372, 116.25860718428157, 50.935221371473745, ECLIPSE_TOTAL },
+    { -93562.380523191736, -93562.380207275972, 166.46919740480371, 108.48463287809864, 50.172702415147796, ECLIPSE_TOTAL },
+    { -93385.641687608149, -93385.646494250046, 160.1160054851789, 88.733730349922553, 0, ECLIPSE_PARTIAL },
+    { -93207.976049704565, -93207.981544029011, 160.08448815671727, 81.351341010304168, 0, ECLIPSE_PARTIAL },
+    { -93060.524771042808, -93060.515915686337, 89.55879857763648, 0, 0, ECLIPSE_PENUMBRAL },
+    { -93031.133280454625, -93031.142571062956, 87.385329123353586, 0, 0, ECLIPSE_PENUMBRAL },
+    { -92883.593546489894, -92883.581531876582, 64.481757102767006, 0, 0, ECLIPSE_PENUMBRAL },
+    { -92853.865298503777, -92853.876994187769, 75.503587543498725, 0, 0, ECLIPSE_PENUMBRAL },
+    { -92705.843111527982, -92705.838745167377, 148.35785340168513, 85.539020531577989, 0, ECLIPSE_PARTIAL },
+    { -92529.513867589441, -92529.508119176418, 160.57561456225812, 79.74955381359905, 0, ECLIPSE_PARTIAL },
+    { -92351.27867720912, -92351.279356166007, 170.64358280855231, 110.00114233000204, 49.969599901232868, ECLIPSE_TOTAL },
+    { -92175.147473960344, -92175.147939476941, 168.22259042062797, 109.88160735927522, 50.737425262341276, ECLIPSE_TOTAL },
+    { -91996.994562151493, -91997.001248743574, 156.21106892125681, 63.472065398236737, 0, ECLIPSE_PARTIAL },
+    { -91820.519833860133, -91820.52543366258, 137.30499749304727, 67.965449293842539, 0, ECLIPSE_PARTIAL },
+    { -91672.801544770715, -91672.7894846079, 58.796333764912561, 0, 0, ECLIPSE_PENUMBRAL },
+    { -91642.980730256575, -91642.993214835602, 48.44852865091525, 0, 0, ECLIPSE_PENUMBRAL },
+    { -91495.12578974104, -91495.118556734218, 124.43524731206708, 19.904900238616392, 0, ECLIPSE_PARTIAL },
+    { -91465.801598123013, -91465.811791939777, 35.315289131831378, 0, 0, ECLIPSE_PENUMBRAL },
+    { -91318.671116247191, -91318.665104537853, 154.06942519708537, 70.945944269187748, 0, ECLIPSE_PARTIAL },
+    { -91140.624986458934, -91140.622900114293, 172.70292767439969, 109.19414713047445, 42.674466163152829, ECLIPSE_TOTAL },
+    { -90964.235347078706, -90964.234942768831, 165.06543051218614, 107.57575441966765, 49.657151688588783, ECLIPSE_TOTAL },
+    { -90786.424931669128, -90786.429144707959, 175.72186070610769, 100.82161808037199, 0, ECLIPSE_PARTIAL },
+    { -90609.602040475249, -90609.606362928855, 146.98481042752974, 84.563631493365392, 0, ECLIPSE_PARTIAL },
+    { -90462.02935079801, -90462.01732697268, 15.601201462559402, 0, 0, ECLIPSE_PENUMBRAL },
+    { -90432.396701162506, -90432.406927362768, 111.45687408861704, 0, 0, ECLIPSE_PENUMBRAL },
+    { -90284.459586464363, -90284.449254741732, 70.763311012415215, 0, 0, ECLIPSE_PENUMBRAL },
+    { -90254.960310463895, -90254.969364014978, 90.610572035657242, 0, 0, ECLIPSE_PENUMBRAL },
+    { -90107.732616066191, -90107.726927595228, 148.8467739103362, 72.42779754800722, 0, ECLIPSE_PARTIAL },
+    { -89930.136917132419, -89930.130860618141, 159.69692906015553, 75.031435063574463, 0, ECLIPSE_PARTIAL },
+    { -89753.161215937944, -89753.161117165932, 161.31802563671954, 106.70947458478622, 49.988622965756804, ECLIPSE_TOTAL },
+    { -89576.084709752598, -89576.08432143768, 188.77185372984968, 118.08169413241558, 52.972629623254761, ECLIPSE_TOTAL },
+    { -89398.469917433773, -89398.474728184272, 143.39638046803884, 78.748805442592129, 0, ECLIPSE_PARTIAL },
+    { -89222.054153860576, -89222.05959961575, 165.968188442057, 85.552415420534089, 0, ECLIPSE_PARTIAL },
+    { -89073.393313730921, -89073.383280447335, 92.182145667029545, 0, 0, ECLIPSE_PENUMBRAL },
+    { -89043.852490753619, -89043.862499080249, 67.937022624537349, 0, 0, ECLIPSE_PENUMBRAL },
+    { -88897.191755014632, -88897.182901491469, 95.488661775598302, 0, 0, ECLIPSE_PENUMBRAL },
+    { -88867.768172834694, -88867.778232407043, 82.813761422876269, 0, 0, ECLIPSE_PENUMBRAL },
+    { -88719.202080157294, -88719.196507367436, 168.6149605200626, 84.972845173906535, 0, ECLIPSE_PARTIAL },
+    { -88542.517650758542, -88542.51409578025, 150.15052061062306, 92.345931250602007, 0, ECLIPSE_PARTIAL },
+    { -88365.22616012537, -88365.226164733394, 189.3737395782955, 117.76934968773276, 52.805664658080786, ECLIPSE_TOTAL },
+    { -88187.806242726438, -88187.807879939879, 160.17210897873156, 104.75724928895943, 44.413940054364502, ECLIPSE_TOTAL },
+    { -88011.156673127509, -88011.162077500238, 162.69029779010452, 83.373791190097108, 0, ECLIPSE_PARTIAL },
+    { -87833.250023210261, -87833.257615251874, 130.05086223129183, 0, 0, ECLIPSE_PENUMBRAL },
+    { -87686.300072190774, -87686.290398452606, 69.493342491332442, 0, 0, ECLIPSE_PENUMBRAL },
+    { -87656.790980007427, -87656.800522673904, 89.819776708027348, 0, 0, ECLIPSE_PENUMBRAL },
+    { -87508.609428340365, -87508.601521404358, 148.49281093804166, 30.019096294417977, 0, ECLIPSE_PARTIAL },
+    { -87331.642935509313, -87331.637732780466, 141.07567932223901, 73.482980324188247, 0, ECLIPSE_PARTIAL },
+    { -87154.576669789021, -87154.574985788568, 183.2915734697599, 114.61015616194345, 47.47006171499379, ECLIPSE_TOTAL },
+    { -86977.031191981572, -86977.030732785643, 167.08762041293085, 108.5810874402523, 49.957132490817457, ECLIPSE_TOTAL },
+    { -86800.339061370934, -86800.343340734602, 162.20728204934858, 93.789047532482073, 0, ECLIPSE_PARTIAL },
+    { -86622.647505656249, -86622.652825270357, 162.29950149776414, 84.160439172992483, 0, ECLIPSE_PARTIAL },
+    { -86475.183232218158, -86475.174178235815, 83.711226673331112, 0, 0, ECLIPSE_PENUMBRAL },
+    { -86445.810219836654, -86445.81909766444, 95.468074909877032, 0, 0, ECLIPSE_PENUMBRAL },
+    { -86298.301925841413, -86298.289507294918, 42.388566748704761, 0, 0, ECLIPSE_PENUMBRAL },
+    { -86268.555985893676, -86268.567436311627, 85.080744868610054, 0, 0, ECLIPSE_PENUMBRAL },
+    { -86120.496887636589, -86120.492294308511, 147.09735228214413, 83.181017695460469, 0, ECLIPSE_PARTIAL },
+    { -85944.215539710567, -85944.209359027693, 156.43156443955377, 71.842227765591815, 0, ECLIPSE_PARTIAL },
+    { -85765.937726210323, -85765.938220689408, 171.31053102202713, 110.53567923023365, 50.563953897217289, ECLIPSE_TOTAL },
+    { -85589.836437877559, -85589.836430639552, 167.78406769735739, 109.7492011799477, 51.034654505783692, ECLIPSE_TOTAL },
+    { -85411.665031312034, -85411.671580370894, 157.95541509753093, 66.991873009828851, 0, ECLIPSE_PARTIAL },
+    { -85235.202052185967, -85235.207192534581, 140.99107765126973, 75.276215574704111, 0, ECLIPSE_PARTIAL },
+    { -85087.464659480989, -85087.452585088424, 56.43083582050167, 0, 0, ECLIPSE_PENUMBRAL },
+    { -85057.654909520701, -85057.667258457936, 55.547001399099827, 0, 0, ECLIPSE_PENUMBRAL },
+    { -84909.822202571246, -84909.814402425094, 117.45256371446885, 0, 0, ECLIPSE_PENUMBRAL },
+    { -84880.488161271976, -84880.49798959092, 57.493122982559726, 0, 0, ECLIPSE_PENUMBRAL },
+    { -84733.318830048418, -84733.31282672385, 153.37811369332485, 70.670080591225997, 0, ECLIPSE_PARTIAL },
+    { -84555.338604911667, -84555.335872395284, 171.61406633793376, 106.5609807043802, 34.45645010098815, ECLIPSE_TOTAL },
+    { -84378.870451339957, -84378.870020780712, 164.61054102284834, 107.34157869243063, 49.53633974539116, ECLIPSE_TOTAL },
+    { -84201.154950947224, -84201.158486528235, 179.18615648173727, 106.3473488856107, 16.950292530236766, ECLIPSE_TOTAL },
+    { -84024.233896541293, -84024.238182771849, 147.29124811361544, 84.980805037776008, 0, ECLIPSE_PARTIAL },
+    { -83847.125644674015, -83847.13521930619, 123.21746241417713, 0, 0, ECLIPSE_PENUMBRAL },
+    { -83699.118417603633, -83699.107843582373, 64.716434319270775, 0, 0, ECLIPSE_PENUMBRAL },
+    { -83669.600185650124, -83669.609238644247, 91.995889908866957, 0, 0, ECLIPSE_PENUMBRAL },
+    { -83522.419849271275, -83522.413807493111, 144.64497419307008, 65.169476667651907, 0, ECLIPSE_PARTIAL },
+    { -83344.818521378926, -83344.812149850608, 158.0999404087197, 69.841184735996649, 0, ECLIPSE_PARTIAL },
+    { -83167.830511702909, -83167.830077146573, 160.74432285851799, 106.43183991545811, 49.624061349313706, ECLIPSE_TOTAL },
+    { -82990.782165171928, -82990.781400759748, 188.78847143962048, 117.67817539977841, 52.055092197842896, ECLIPSE_TOTAL },
+    { -82813.131928793766, -82813.136473143313, 145.41602756129578, 82.380163340130821, 0, ECLIPSE_PARTIAL },
+    { -82636.749765364584, -82636.754792660737, 168.31534818629734, 90.466733359498903, 0, ECLIPSE_PARTIAL },
+    { -82488.052516011579, -82488.042287131728, 88.259683989454061, 0, 0, ECLIPSE_PENUMBRAL },
+    { -82458.518432883793, -82458.528285885841, 75.004883740330115, 0, 0, ECLIPSE_PENUMBRAL },
+    { -82311.879728307526, -82311.870521969307, 85.637489003129303, 0, 0, ECLIPSE_PENUMBRAL },
+    { -82282.450814520562, -82282.460469716563, 92.451046875212342, 0, 0, ECLIPSE_PENUMBRAL },
+    { -82133.873007358925, -82133.867273267795, 167.79532105196267, 82.968307686969638, 0, ECLIPSE_PARTIAL },
+    { -81957.201455869654, -81957.197439513402, 147.56343452492729, 88.032587638590485, 0, ECLIPSE_PARTIAL },
+    { -81779.895979965266, -81779.895872367691, 189.03972016065381, 117.6977894094307, 52.803846497554332, ECLIPSE_TOTAL },
+    { -81602.497479865575, -81602.498610470269, 161.63435568683781, 106.37220135424286, 47.717376064974815, ECLIPSE_TOTAL },
+    { -81425.811225785699, -81425.816536774641, 162.50554662547074, 84.204428783850744, 0, ECLIPSE_PARTIAL },
+    { -81247.958949450767, -81247.96604913655, 137.45342337526381, 38.530491226119921, 0, ECLIPSE_PARTIAL },
+    { -81100.934084042194, -81100.924416845301, 68.717556396732107, 0, 0, ECLIPSE_PENUMBRAL },
+    { -81071.428553727528, -81071.438010892904, 90.500624820124358, 0, 0, ECLIPSE_PENUMBRAL },
+    { -80923.341017213854, -80923.332438594036, 140.17095822491683, 0, 0, ECLIPSE_PENUMBRAL },
+    { -80746.277581261631, -80746.272312799279, 140.7645329029765, 72.470454960130155, 0, ECLIPSE_PARTIAL },
+    { -80569.299347857508, -80569.29703035143, 181.2026218988467, 112.09358640946448, 41.544200718635693, ECLIPSE_TOTAL },
+    { -80391.677785185107, -80391.677222565399, 167.6994363963604, 108.69088694569655, 49.760172025999054, ECLIPSE_TOTAL },
+    { -80215.039146741256, -80215.04287234052, 164.0812947275117, 98.220862839370966, 0, ECLIPSE_PARTIAL },
+    { -80037.314260168452, -80037.319449680857, 164.10670195240527, 86.21173319988884, 0, ECLIPSE_PARTIAL },
+    { -79889.846061796401, -79889.836778091936, 76.320984496269375, 0, 0, ECLIPSE_PENUMBRAL },
+    { -79860.49085118869, -79860.499286346923, 103.1499502575025, 0, 0, ECLIPSE_PENUMBRAL },
+    { -79683.241251090338, -79683.252495927198, 92.22360496991314, 0, 0, ECLIPSE_PENUMBRAL },
+    { -79535.155472386774, -79535.150614711281, 145.49491480691358, 80.131194626446813, 0, ECLIPSE_PARTIAL },
+    { -79358.910985770985, -79358.904428876369, 152.39704411360435, 63.454684820026159, 0, ECLIPSE_PARTIAL },
+    { -79180.602874361502, -79180.603133268916, 171.96010916610248, 111.04249025112949, 51.079610382439569, ECLIPSE_TOTAL },
+    { -79004.5191377921, -79004.51871105413, 167.13288100319915, 109.24505361355841, 50.513473340542987, ECLIPSE_TOTAL },
+    { -78826.340961929498, -78826.347324143702, 160.0273692375049, 71.184534577187151, 0, ECLIPSE_PARTIAL },
+    { -78649.880093884203, -78649.884805949958, 144.06325486837886, 80.945591339841485, 0, ECLIPSE_PARTIAL },
+    { -78502.129445844199, -78502.117347840191, 52.987164985388517, 0, 0, ECLIPSE_PENUMBRAL },
+    { -78472.333350563305, -78472.345518597023, 63.437992060789838, 0, 0, ECLIPSE_PENUMBRAL },
+    { -78324.518176581245, -78324.509818060789, 109.51315731508657, 0, 0, ECLIPSE_PENUMBRAL },
+    { -78295.172005602988, -78295.181482603177, 72.100029867142439, 0, 0, ECLIPSE_PENUMBRAL },
+    { -78147.967120792688, -78147.961116931503, 152.54855503910221, 70.200771996751428, 0, ECLIPSE_PARTIAL },
+    { -77970.053794330059, -77970.050403015252, 169.99456343357451, 102.93262823252007, 19.030542658874765, ECLIPSE_TOTAL },
+    { -77793.504881412984, -77793.504426056228, 164.1426890459843, 107.12562040309422, 49.432405256666243, ECLIPSE_TOTAL },
+    { -77615.886260416417, -77615.889100064975, 182.09260062198155, 110.76301627792418, 34.864454031921923, ECLIPSE_TOTAL },
+    { -77438.864802635057, -77438.869058671451, 147.5479751941748, 85.340338057139888, 0, ECLIPSE_PARTIAL },
+    { -77261.855347449076, -77261.864248859172, 133.37098126765341, 0, 0, ECLIPSE_PENUMBRAL },
+    { -77113.772712476028, -77113.761935073548, 59.496379588963464, 0, 0, ECLIPSE_PENUMBRAL },
+    { -77084.237710516463, -77084.246781771042, 92.851539573166519, 0, 0, ECLIPSE_PENUMBRAL },
+    { -76937.111561562517, -76937.105128175637, 139.70713645569049, 55.40773680084385, 0, ECLIPSE_PARTIAL },
+    { -76759.494681726545, -76759.488049563704, 156.81980467052199, 65.105106857372448, 0, ECLIPSE_PARTIAL },
+    { -76582.505209057053, -76582.504389847527, 159.99775141594, 105.8570246596355, 48.597267743898556, ECLIPSE_TOTAL },
+    { -76405.472711721421, -76405.471637332623, 188.69240407948382, 117.14169463142753, 50.849957530153915, ECLIPSE_TOTAL },
+    { -76227.800274076042, -76227.804500550134, 147.66428299597465, 86.24480701633729, 0, ECLIPSE_PARTIAL },
+    { -76051.437389237763, -76051.442066460484, 169.99755586730316, 94.002158258808777, 0, ECLIPSE_PARTIAL },
+    { -75902.716980529178, -75902.70651667699, 82.913195405853912, 0, 0, ECLIPSE_PENUMBRAL },
+    { -75873.190165929875, -75873.199825772754, 82.56479159463197, 0, 0, ECLIPSE_PENUMBRAL },
+    { -75726.563258059221, -75726.553729133346, 75.077168623683974, 0, 0, ECLIPSE_PENUMBRAL },
+    { -75697.12746134738, -75697.136755532789, 99.844302870333195, 0, 0, ECLIPSE_PENUMBRAL },
+    { -75548.547765460593, -75548.541838903009, 166.65570189594291, 80.364064652239904, 0, ECLIPSE_PARTIAL },
+    { -75371.882659302515, -75371.878201477535, 144.79302178951912, 83.173724182415754, 0, ECLIPSE_PARTIAL },
+    { -75194.568710717635, -75194.568461164919, 188.61627752892673, 117.58452662732452, 52.734672641381621, ECLIPSE_TOTAL },
+    { -75017.187266079811, -75017.187902778969, 162.78574200812727, 107.43923702160828, 49.665884122950956, ECLIPSE_TOTAL },
+    { -74840.467126905845, -74840.472327578755, 162.38559899269603, 85.239658041391522, 0, ECLIPSE_PARTIAL },
+    { -74662.666479523483, -74662.673096523853, 143.95785269793123, 55.607407595962286, 0, ECLIPSE_PARTIAL },
+    { -74515.566911900503, -74515.557253751569, 68.069933719234541, 0, 0, ECLIPSE_PENUMBRAL },
+    { -74486.06752438804, -74486.076883967064, 91.477044727653265, 0, 0, ECLIPSE_PENUMBRAL },
+    { -74338.072882207431, -74338.063642421053, 130.55438420386054, 0, 0, ECLIPSE_PENUMBRAL },
+    { -74160.910280623415, -74160.904960790911, 140.57392673799768, 71.695571219315752, 0, ECLIPSE_PARTIAL },
+    { -73984.023438531338, -73984.020477766084, 178.56492184801027, 108.64748199353926, 31.808597574708983, ECLIPSE_TOTAL },
+    { -73806.321437300881, -73806.320800783622, 168.31350343418308, 108.82883173995651, 49.60914405528456, ECLIPSE_TOTAL },
+    { -73629.741663423745, -73629.744811193421, 165.68478543078527, 102.00127319782041, 24.54750086995773, ECLIPSE_TOTAL },
+    { -73451.977132100452, -73451.982229048779, 165.5760290636681, 87.702112802071497, 0, ECLIPSE_PARTIAL },
+    { -73304.514911223363, -73304.50535271001, 66.313693486154079, 0, 0, ECLIPSE_PENUMBRAL },
+    { -73275.175377233929, -73275.183337874958, 110.49347631633282, 0, 0, ECLIPSE_PENUMBRAL },
+    { -73097.920413601925, -73097.931498537713, 97.338194634066895, 0, 0, ECLIPSE_PENUMBRAL },
+    { -72949.820395844028, -72949.815221476223, 143.39400846278295, 75.998167984653264, 0, ECLIPSE_PARTIAL },
+    { -72773.599368603449, -72773.592497669291, 148.63405404263176, 54.807735288050026, 0, ECLIPSE_PARTIAL },
+    { -72595.274872503884, -72595.274837248304, 172.55435125320219, 111.45490073715337, 51.372119147563353, ECLIPSE_TOTAL },
+    { -72419.195917581732, -72419.195120383709, 166.35004842071794, 108.48608470754698, 49.413991996552795, ECLIPSE_TOTAL },
+    { -72241.0246343545, -72241.030737565903, 162.54696837742813, 76.248532257741317, 0, ECLIPSE_PARTIAL },
+    { -72064.553389561945, -72064.557710492576, 146.60785971907899, 85.361354862106964, 0, ECLIPSE_PARTIAL },
+    { -71916.79620593664, -71916.784074000374, 48.055992851732299, 0, 0, ECLIPSE_PENUMBRAL },
+    { -71887.017315177887, -71887.029244317033, 72.205859703244641, 0, 0, ECLIPSE_PENUMBRAL },
+    { -71739.213476315112, -71739.204569139722, 100.43995999032632, 0, 0, ECLIPSE_PENUMBRAL },
+    { -71709.85243399821, -71709.861580733676, 83.156845722114667, 0, 0, ECLIPSE_PENUMBRAL },
+    { -71562.61605336293, -71562.610039895502, 151.58684992929921, 69.534851886564866, 0, ECLIPSE_PARTIAL },
+    { -71384.769176146088, -71384.765127121631, 167.85132093471475, 98.257017434807494, 0, ECLIPSE_PARTIAL },
+    { -71208.138628803164, -71208.138151470659, 163.67638493422419, 106.92908002878539, 49.345474652945995, ECLIPSE_TOTAL },
+    { -71030.619333990981, -71030.62145408857, 184.42978436127305, 114.16557176155038, 44.211749491514638, ECLIPSE_TOTAL },
+    { -70853.494262952634, -70853.498501123031, 147.72687391494401, 85.576793075306341, 0, ECLIPSE_PARTIAL },
+    { -70676.585666488128, -70676.593873511956, 142.20003658323549, 0, 0, ECLIPSE_PENUMBRAL },
+    { -70528.423487442953, -70528.412537898519, 55.03986326395534, 0, 0, ECLIPSE_PENUMBRAL },
+    { -70498.874019643059, -70498.883119343853, 93.392422768520191, 0, 0, ECLIPSE_PENUMBRAL },
+    { -70351.805728070423, -70351.798883304742, 134.09765511984006, 41.815898464992642, 0, ECLIPSE_PARTIAL },
+    { -70174.166347049715, -70174.159500766182, 155.81936627277173, 60.872901168186218, 0, ECLIPSE_PARTIAL },
+    { -69997.182925853165, -69997.181695828753, 159.05293635441922, 104.92251069517806, 46.73228204017505, ECLIPSE_TOTAL },
+    { -69820.158346194294, -69820.157008179202, 188.50749395205639, 116.53431913931854, 49.487057696096599, ECLIPSE_TOTAL },
+    { -69642.473095771202, -69642.476968974384, 149.96677676215768, 90.028629846638069, 0, ECLIPSE_PARTIAL },
+    { -69466.118532301043, -69466.122913276849, 171.19845338864252, 96.618281080154702, 0, ECLIPSE_PARTIAL },
+    { -69317.389092746962, -69317.378334619076, 75.079217758029699, 0, 0, ECLIPSE_PENUMBRAL },
+    { -69287.869416559566, -69287.878829259251, 90.815112087875605, 0, 0, ECLIPSE_PENUMBRAL },
+    { -69141.240916714902, -69141.231104539955, 64.000520127592608, 0, 0, ECLIPSE_PENUMBRAL },
+    { -69111.796962720502, -69111.805950466442, 105.37332469364628, 0, 0, ECLIPSE_PENUMBRAL },
+    { -68963.229808781674, -68963.223625548766, 164.90513089927845, 76.482820145320147, 0, ECLIPSE_PARTIAL },
+    { -68786.559054791083, -68786.554194996745, 142.01822282513604, 78.018051510443911, 0, ECLIPSE_PARTIAL },
+    { -68609.246891464543, -68609.246445232886, 188.0854348372668, 117.38646129146218, 52.503094329731539, ECLIPSE_TOTAL },
+    { -68431.873777148197, -68431.873949820816, 163.64523572847247, 108.0056952056475, 50.489545385353267, ECLIPSE_TOTAL },
+    { -68255.126218828344, -68255.131275511085, 162.43712394498289, 86.664854621049017, 0, ECLIPSE_PARTIAL },
+    { -68077.373670973757, -68077.379805694611, 149.80324592557736, 67.626112595899031, 0, ECLIPSE_PARTIAL },
+    { -67930.198237158125, -67930.188594649007, 67.705184568185359, 0, 0, ECLIPSE_PENUMBRAL },
+    { -67900.708033665636, -67900.717283956124, 92.714708492858335, 0, 0, ECLIPSE_PENUMBRAL },
+    { -67752.807270919409, -67752.797359813718, 118.97473927005194, 0, 0, ECLIPSE_PENUMBRAL },
+    { -67575.541036177354, -67575.535681544614, 140.51628258777782, 71.211987447459251, 0, ECLIPSE_PARTIAL },
+    { -67398.7489354891, -67398.745322394199, 175.33641733811237, 104.1302205179818, 10.015076865674928, ECLIPSE_TOTAL },
+    { -67220.962308058268, -67220.961627614743, 168.92829365213402, 109.00668664136901, 49.534429300110787, ECLIPSE_TOTAL },
+    { -67044.445657162447, -67044.448212850883, 166.93933634203859, 105.06620709900744, 36.041588983498514, ECLIPSE_TOTAL },
+    { -66866.636948348401, -66866.641984588568, 166.77911451319233, 88.759458350250497, 0, ECLIPSE_PARTIAL },
+    { -66719.187545154244, -66719.177687075105, 52.896718854317442, 0, 0, ECLIPSE_PENUMBRAL },
+    { -66689.862277892185, -66689.869745197735, 117.26283078663982, 0, 0, ECLIPSE_PENUMBRAL },
+    { -66512.595058098334, -66512.606018592269, 101.12488362472504, 0, 0, ECLIPSE_PENUMBRAL },
+    { -66364.491169354704, -66364.485632291631, 140.73468050337397, 70.526865036226809, 0, ECLIPSE_PARTIAL },
+    { -66188.280969845408, -66188.273843478572, 145.22782956948504, 45.959184399107471, 0, ECLIPSE_PARTIAL },
+    { -66009.953125269443, -66009.952744240116, 173.0373994319234, 111.67759344563819, 51.242525212001055, ECLIPSE_TOTAL },
+    { -65833.866660722924, -65833.865543884109, 165.48911400837824, 107.57813368574716, 47.945648061577231, ECLIPSE_TOTAL },
+    { -65655.714325114328, -65655.720115279168, 165.31380707980134, 81.604840272339061, 0, ECLIPSE_PARTIAL },
+    { -65479.221531812116, -65479.225503645372, 148.67488000891171, 88.785111819743179, 0, ECLIPSE_PARTIAL },
+    { -65331.466662114763, -65331.454471369623, 40.179814170696773, 0, 0, ECLIPSE_PENUMBRAL },
+    { -65301.706942355959, -65301.718576207524, 81.492136709857732, 0, 0, ECLIPSE_PENUMBRAL },
+    { -65153.907321945902, -65153.897883872036, 90.079786173300818, 0, 0, ECLIPSE_PENUMBRAL },
+    { -65124.52923686643, -65124.538077713252, 91.964083860511892, 0, 0, ECLIPSE_PENUMBRAL },
+    { -64977.267374877571, -64977.261328582463, 150.36197053093929, 68.385589990066364, 0, ECLIPSE_PARTIAL },
+    { -64799.483553271471, -64799.478860596049, 165.24070903134998, 92.504851757548749, 0, ECLIPSE_PARTIAL },
+    { -64622.774762384441, -64622.774238348895, 163.18052617425565, 106.72368498577271, 49.218648254172876, ECLIPSE_TOTAL },
+    { -64445.350871830706, -64445.352283581276, 186.13555349875242, 116.4876766508678, 49.680383605300449, ECLIPSE_TOTAL },
+    { -64268.124743487693, -64268.128954902866, 147.95015030773357, 85.918373739696108, 0, ECLIPSE_PARTIAL },
+    { -64091.315237214236, -64091.322743321507, 149.7620504378574, 44.64453692373354, 0, ECLIPSE_PARTIAL },
+    { -63943.071414280443, -63943.060320430486, 51.384945146273822, 0, 0, ECLIPSE_PENUMBRAL },
+    { -63913.510134193188, -63913.519265725874, 93.779560559196398, 0, 0, ECLIPSE_PENUMBRAL },
+    { -63766.502795804488, -63766.495517973803, 127.62567290919833, 16.064164264826104, 0, ECLIPSE_PARTIAL },
+    { -63588.833542305467, -63588.826529510457, 155.15220966946799, 57.385607959586196, 0, ECLIPSE_PARTIAL },
+    { -63411.865795257399, -63411.864108205817, 157.81331204110757, 103.4801932820119, 43.598183791036718, ECLIPSE_TOTAL },
+    { -63234.837216545173, -63234.835680832432, 188.30782932811417, 115.97595580969937, 48.237776094465517, ECLIPSE_TOTAL },
+    { -63057.151286005304, -63057.154761479855, 152.31411936809309, 93.723417576402426, 0, ECLIPSE_PARTIAL },
+    { -62880.792899838518, -62880.797041909806, 171.96924375894014, 98.467712994315661, 0, ECLIPSE_PARTIAL },
+    { -62732.06716704154, -62732.056071562693, 64.285748272086494, 0, 0, ECLIPSE_PENUMBRAL },
+    { -62702.554009426356, -62702.563136510049, 99.07605811546091, 0, 0, ECLIPSE_PENUMBRAL },
+    { -62555.912955511267, -62555.902896625048, 52.111024538171478, 0, 0, ECLIPSE_PENUMBRAL },
+    { -62526.460080385848, -62526.468809757476, 109.54809712653514, 0, 0, ECLIPSE_PENUMBRAL },
+    { -62377.91713967824, -62377.910655901673, 162.62872479041107, 71.344594923430122, 0, ECLIPSE_PARTIAL },
+    { -62201.231819146189, -62201.226584972988, 139.21820989635307, 72.464657632517628, 0, ECLIPSE_PARTIAL },
+    { -62023.92895509443, -62023.928273720936, 187.42595460615121, 117.06524316687137, 52.022294737980701, ECLIPSE_TOTAL },
+    { -61846.557114442629, -61846.556851582063, 164.27292760752607, 108.16524541878607, 50.425661049666815, ECLIPSE_TOTAL },
+    { -61669.789083495132, -61669.793957505579, 162.68137289152946, 88.479460047092289, 0, ECLIPSE_PARTIAL },
+    { -61492.077443327275, -61492.083123804252, 154.82937329274137, 76.554368772776797, 0, ECLIPSE_PARTIAL },
+    { -61344.830179152697, -61344.820542799192, 67.051347956294194, 0, 0, ECLIPSE_PENUMBRAL },
+    { -61315.351402670858, -61315.360521599774, 94.449211925966665, 0, 0, ECLIPSE_PENUMBRAL },
+    { -61167.540843178504, -61167.530282091502, 105.3796854999382, 0, 0, ECLIPSE_PENUMBRAL },
+    { -61137.893886903308, -61137.905991341649, 40.3747329977341, 0, 0, ECLIPSE_PENUMBRAL },
+    { -60990.171997873513, -60990.166605583952, 140.44559322588611, 70.71491033595521, 0, ECLIPSE_PARTIAL },
+    { -60813.473892501694, -60813.469636774164, 171.54297636821866, 98.507374881883152, 0, ECLIPSE_PARTIAL },
+    { -60635.602666032762, -60635.601950098266, 169.53283377166372, 109.20807367307134, 49.49280237487983, ECLIPSE_TOTAL },
+    { -60459.150773611182, -60459.15272567801, 167.82370592700318, 107.41186359606218, 43.120169301400892, ECLIPSE_TOTAL },
+    { -60281.294606262018, -60281.299605102155, 167.76403364434373, 89.522732589393854, 0, ECLIPSE_PARTIAL },
+    { -60133.865078927382, -60133.854886551024, 31.064355981652625, 0, 0, ECLIPSE_PENUMBRAL },
+    { -60104.551306654932, -60104.558263182029, 123.50538833183236, 29.226874403539114, 0, ECLIPSE_PARTIAL },
+    { -59927.266356297099, -59927.277216491639, 103.99193445977289, 0, 0, ECLIPSE_PENUMBRAL },
+    { -59779.167662874366, -59779.161717369767, 137.41863387229387, 63.189459584536962, 0, ECLIPSE_PARTIAL },
+    { -59602.955228697734, -59602.947908686474, 142.31351328722667, 37.22582753514871, 0, ECLIPSE_PARTIAL },
+    { -59424.638915501084, -59424.638123414043, 173.33667505939957, 111.59385752573144, 50.423751353519037, ECLIPSE_TOTAL },
+    { -59248.530943860453, -59248.529561072522, 164.62534867110662, 106.6211333067622, 46.309026010567322, ECLIPSE_TOTAL },
+    { -59070.411777597503, -59070.41718204521, 168.36320008907933, 87.317777050193399, 0, ECLIPSE_PARTIAL },
+    { -58893.884018042125, -58893.88768764268, 150.33603715302888, 91.402489904430695, 0, ECLIPSE_PARTIAL },
+    { -58746.141441668529, -58746.129162864236, 26.194598241127096, 0, 0, ECLIPSE_PENUMBRAL },
+    { -58716.403007980924, -58716.414281714322, 91.233566177543253, 0, 0, ECLIPSE_PENUMBRAL },
+    { -58568.598312468697, -58568.588372024409, 78.314140715519898, 0, 0, ECLIPSE_PENUMBRAL },
+    { -58539.201101274128, -58539.209672376477, 98.971275372896343, 0, 0, ECLIPSE_PENUMBRAL },
+    { -58391.920737470253, -58391.914638323622, 148.90684178215452, 66.787040277267806, 0, ECLIPSE_PARTIAL },
+    { -58214.197282304638, -58214.191956259958, 162.13009191385936, 85.463302850257605, 0, ECLIPSE_PARTIAL },
+    { -58037.412061836876, -58037.411479243201, 162.67791307240259, 106.5177903289441, 49.065588646335527, ECLIPSE_TOTAL },
+    { -57860.081759171284, -57860.082464888808, 187.25095030094963, 117.85824498860165, 52.649195113917813, ECLIPSE_TOTAL },
+    { -57682.756454510003, -57682.760629622157, 148.22866089642048, 86.370055568986572, 0, ECLIPSE_PARTIAL },
+    { -57506.043182267422, -57506.049989493884, 156.17202217632439, 63.837176904198714, 0, ECLIPSE_PARTIAL },
+    { -57357.717408098229, -57357.706191247416, 48.349103715154342, 0, 0, ECLIPSE_PENUMBRAL },
+    { -57328.147162657813, -57328.156320977942, 94.214065584819764, 0, 0, ECLIPSE_PENUMBRAL },
+    { -57181.200425528128, -57181.192713208686, 120.40022272558417, 0, 0, ECLIPSE_PENUMBRAL },
+    { -57151.787111455589, -57151.798583480209, 23.691915955860168, 0, 0, ECLIPSE_PENUMBRAL },
+    { -57003.49876424174, -57003.491609359815, 154.60886143497191, 54.214495372725651, 0, ECLIPSE_PARTIAL },
+    { -56826.550095464379, -56826.547940543453, 156.29955423180945, 101.53641617973335, 38.956334361573681, ECLIPSE_TOTAL },
+    { -56649.511862494459, -56649.510169768517, 188.07682453771122, 115.45996604952961, 47.096561526996084, ECLIPSE_TOTAL },
+    { -56471.833918295029, -56471.836959041641, 154.59872507897671, 97.165946508175693, 23.242084384546615, ECLIPSE_TOTAL },
+    { -56295.461238075819, -56295.465191645126, 172.39767336111981, 99.744537917431444, 0, ECLIPSE_PARTIAL },
+    { -56146.753016937881, -56146.741526927617, 47.515647957916372, 0, 0, ECLIPSE_PENUMBRAL },
+    { -56117.245218167875, -56117.254008323987, 107.50033988035284, 0, 0, ECLIPSE_PENUMBRAL },
+    { -55970.578492070279, -55970.568228681463, 39.296873773564585, 0, 0, ECLIPSE_PENUMBRAL },
+    { -55941.116749622, -55941.125270037519, 112.57070261053741, 0, 0, ECLIPSE_PENUMBRAL },
+    { -55792.612759698975, -55792.605903341595, 159.50328720035031, 63.862645060289651, 0, ECLIPSE_PARTIAL },
+    { -55615.898636151054, -55615.893076536595, 136.6271110845264, 66.920342125813477, 0, ECLIPSE_PARTIAL },
+    { -55438.617148104626, -55438.61617164169, 186.59416191279888, 116.53260024671908, 51.088210246525705, ECLIPSE_TOTAL },
+    { -55261.236979000401, -55261.236312479479, 164.71657915972173, 107.99802790686954, 49.646031506708823, ECLIPSE_TOTAL },
+    { -55084.456323879676, -55084.460972186607, 163.12082143791486, 90.658134123659693, 0, ECLIPSE_PARTIAL },
+    { -54906.778975046655, -54906.784219841531, 159.2526927444851, 83.644217695109546, 0, ECLIPSE_PARTIAL },
+    { -54759.463600970157, -54759.453956748664, 65.914190586190671, 0, 0, ECLIPSE_PENUMBRAL },
+    { -54729.999056718749, -54730.008011068261, 96.852697326103225, 0, 0, ECLIPSE_PENUMBRAL },
+    { -54582.27460658949, -54582.26340754782, 88.702721315785311, 0, 0, ECLIPSE_PENUMBRAL },
+    { -54552.616470368564, -54552.628102269548, 68.572591171832755, 0, 0, ECLIPSE_PENUMBRAL },
+    { -54404.803262214642, -54404.797831636053, 140.36748678598087, 70.239623024244793, 0, ECLIPSE_PARTIAL },
+    { -54228.197916998062, -54228.193032738192, 167.19826476706658, 91.655030931578949, 0, ECLIPSE_PARTIAL },
+    { -54050.243048396907, -54050.242302849067, 170.12428043119144, 109.42779862729367, 49.477959622163326, ECLIPSE_TOTAL },
+    { -53873.855231413465, -53873.856586538503, 168.28077861398924, 108.99729022406973, 47.58087451918982, ECLIPSE_TOTAL },
+    { -53695.950871679823, -53695.955851616993, 168.57916904438753, 90.061330485041253, 0, ECLIPSE_PARTIAL },
+    { -53519.242139531627, -53519.24857070671, 129.20150966034271, 48.854388098116033, 0, ECLIPSE_PARTIAL },
+    { -53341.934216656526, -53341.945005052839, 105.98280197416898, 0, 0, ECLIPSE_PENUMBRAL },
+    { -53193.849089993069, -53193.842699682631, 133.38329380145296, 53.201100883889012, 0, ECLIPSE_PARTIAL },
+    { -53017.623326476685, -53017.615864025349, 139.8601886088727, 28.455976477707736, 0, ECLIPSE_PARTIAL },
+    { -52839.330623794092, -52839.329372653134, 173.38839637872297, 111.08537367603276, 48.621967132785358, ECLIPSE_TOTAL },
+    { -52663.189108182349, -52663.187511216755, 163.79069965565577, 105.69528105959762, 44.679092765436508, ECLIPSE_TOTAL },
+    { -52485.11499607101, -52485.119962969417, 171.47007442486938, 92.895286328857765, 0, ECLIPSE_PARTIAL },
+    { -52308.541824109707, -52308.545230691234, 151.69005005329382, 93.445576733211055, 2.9645406827330589, ECLIPSE_TOTAL },
+    { -52131.104627206092, -52131.115486378949, 100.9393860725686, 0, 0, ECLIPSE_PENUMBRAL },
+    { -51983.286258461645, -51983.275846648154, 64.592822207487188, 0, 0, ECLIPSE_PENUMBRAL },
+    { -51953.868503185753, -51953.876838911026, 104.66353233496193, 0, 0, ECLIPSE_PENUMBRAL },
+    { -51806.579312445589, -51806.573113584076, 146.95096892828587, 64.112037399318069, 0, ECLIPSE_PARTIAL },
+    { -51628.907846946582, -51628.901923762933, 158.7128860107623, 77.232063880073838, 0, ECLIPSE_PARTIAL },
+    { -51452.053612586547, -51452.052932016632, 162.13151583157014, 106.26865352794994, 48.798531042994, ECLIPSE_TOTAL },
+    { -51274.809098152102, -51274.809131523049, 187.80585083586629, 118.33006517321337, 53.574087449815124, ECLIPSE_TOTAL },
+    { -51097.391679824133, -51097.395789917122, 148.67617050767876, 87.123115846188739, 0, ECLIPSE_PARTIAL },
+    { -50920.767883226421, -50920.774011676753, 161.46625436609611, 76.630981175112538, 0, ECLIPSE_PARTIAL },
+    { -50772.362304417555, -50772.350981244002, 45.761635021772236, 0, 0, ECLIPSE_PENUMBRAL },
+    { -50742.786247215234, -50742.795419470451, 94.876780015183613, 0, 0, ECLIPSE_PENUMBRAL },
+    { -50595.900197679883, -50595.892037229001, 112.02199582010508, 0, 0, ECLIPSE_PENUMBRAL },
+    { -50566.495534179376, -50566.506405049899, 59.127024215413257, 0, 0, ECLIPSE_PENUMBRAL },
+    { -50418.160562027704, -50418.153305132364, 154.35016613686457, 51.911255847662687, 0, ECLIPSE_PARTIAL },
+    { -50241.237842836468, -50241.235190165615, 154.40828400081955, 98.913802742608823, 31.706184322829358, ECLIPSE_TOTAL },
+    { -50064.181786747846, -50064.17998346041, 187.84371962479781, 115.04242315131705, 46.202940694056451, ECLIPSE_TOTAL },
+    { -49886.520663924268, -49886.523235167937, 156.75567195285112, 100.26703488954809, 33.453814497333951, ECLIPSE_TOTAL },
+    { -49710.123539940781, -49710.127355850695, 172.5170723721385, 100.53071247995831, 0, ECLIPSE_PARTIAL },
+    { -49561.444743869011, -49561.432820367969, 8.478693276992999, 0, 0, ECLIPSE_PENUMBRAL },
+    { -49531.941211304387, -49531.949625730689, 115.68152501655277, 0, 0, ECLIPSE_PENUMBRAL },
+    { -49385.238928568266, -49385.228491287555, 23.069918186520226, 0, 0, ECLIPSE_PENUMBRAL },
+    { -49355.768260045937, -49355.776609517925, 114.7912998078391, 0, 0, ECLIPSE_PENUMBRAL },
+    { -49207.313722229774, -49207.306450728451, 155.64167089469265, 53.546144583960995, 0, ECLIPSE_PARTIAL },
+    { -49030.561166035841, -49030.555313462581, 134.17915124329738, 61.217109239660203, 0, ECLIPSE_PARTIAL },
+    { -48853.310967433281, -48853.309640814761, 185.53887311078142, 115.70082703081425, 49.478148634079844, ECLIPSE_TOTAL },
+    { -48675.912411323101, -48675.911381397811, 165.03594932612032, 107.59974530199543, 48.331193343037739, ECLIPSE_TOTAL },
+    { -48499.127956108561, -48499.132334937, 163.73081791971345, 93.108878338825889, 0, ECLIPSE_PARTIAL },
+    { -48321.476476266449, -48321.481319682491, 163.04261582437903, 89.228639204520732, 0, ECLIPSE_PARTIAL },
+    { -48174.099974267781, -48174.09029618885, 63.837077751522884, 0, 0, ECLIPSE_PENUMBRAL },
+    { -48144.65088183459, -48144.659639303987, 99.846096964320168, 0, 0, ECLIPSE_PENUMBRAL },
+    { -47997.005071257787, -47996.993276296394, 67.879779014037922, 0, 0, ECLIPSE_PENUMBRAL },
+    { -47967.334638820248, -47967.345822566007, 86.383509801817127, 0, 0, ECLIPSE_PENUMBRAL },
+    { -47819.436814510838, -47819.43132611856, 140.13305077969562, 69.462832971476018, 0, ECLIPSE_PARTIAL },
+    { -47642.919929366959, -47642.914438836378, 162.34258681128267, 83.436776126618497, 0, ECLIPSE_PARTIAL },
+    { -47464.884792935358, -47464.884009971378, 170.6892972526839, 109.65080938185565, 49.451094752876088, ECLIPSE_TOTAL },
+    { -47288.558351697007, -47288.559120718492, 168.33325165382121, 109.86667032586411, 50.151150137535296, ECLIPSE_TOTAL },
+    { -47110.608061432955, -47110.613017113676, 169.36210742220283, 90.666091106249951, 0, ECLIPSE_PARTIAL },
+    { -46933.932831917897, -46933.93873865965, 134.24933836155105, 61.572578529012389, 0, ECLIPSE_PARTIAL },
+    { -46756.600250475094, -46756.610978513323, 107.50626215594821, 0, 0, ECLIPSE_PENUMBRAL },
+    { -46608.535398471438, -46608.528525003028, 128.45812192128506, 38.165178517811, 0, ECLIPSE_PARTIAL },
+    { -46432.285267506537, -46432.277710809052, 137.90403429069556, 19.689613355440088, 0, ECLIPSE_PARTIAL },
+    { -46254.028886256405, -46254.027119109625, 173.09268608281855, 109.99272935092449, 45.346620503696613, ECLIPSE_TOTAL },
+    { -46077.840976196931, -46077.839216195178, 163.03443105833139, 104.86720346147195, 43.213913281797431, ECLIPSE_TOTAL },
+    { -45899.826168550586, -45899.830621439512, 174.67533357557841, 98.44778580009006, 0, ECLIPSE_PARTIAL },
+    { -45723.193411687185, -45723.196607827027, 152.73432036687154, 94.931263957405463, 17.219801578321494, ECLIPSE_TOTAL },
+    { -45545.811860634138, -45545.822247076154, 110.54407160554547, 0, 0, ECLIPSE_PENUMBRAL },
+    { -45397.970403649357, -45397.959554673886, 47.652833760366775, 0, 0, ECLIPSE_PENUMBRAL },
+    { -45368.531045451033, -45368.539183049783, 109.27309821476229, 0, 0, ECLIPSE_PENUMBRAL },
+    { -45221.241023006332, -45221.23469514669, 144.64335813070647, 60.570194633910432, 0, ECLIPSE_PARTIAL },
+    { -45043.615359951276, -45043.608872548939, 155.00784732867032, 67.499961946159601, 0, ECLIPSE_PARTIAL },
+    { -44866.698001498138, -44866.697196382673, 161.55237981467508, 105.9734616894275, 48.40709974814672, ECLIPSE_TOTAL },
+    { -44689.533818688782, -44689.53320227185, 187.86644928739406, 118.02278618502896, 52.810303496662527, ECLIPSE_TOTAL },
+    { -44512.029575329158, -44512.033598949733, 149.2463099869201, 88.086887650424615, 0, ECLIPSE_PARTIAL },
+    { -44335.488269057925, -44335.493747873894, 165.76380945334677, 85.963086425908841, 0, ECLIPSE_PARTIAL },
+    { -44187.007929586827, -44186.996499881345, 42.650878434651531, 0, 0, ECLIPSE_PENUMBRAL },
+    { -44157.428811619837, -44157.437972438718, 96.078856555977836, 0, 0, ECLIPSE_PENUMBRAL },
+    { -44010.598256250712, -44010.589664241685, 102.76957360329106, 0, 0, ECLIPSE_PENUMBRAL },
+    { -43981.199343909961, -43981.209639151995, 78.106053960509598, 0, 0, ECLIPSE_PENUMBRAL },
+    { -43832.821839591095, -43832.814491099154, 154.08572520653252, 49.711547819897532, 0, ECLIPSE_PARTIAL },
+    { -43655.926101963938, -43655.922947126892, 152.17501019651536, 95.633277527522296, 19.446991598233581, ECLIPSE_TOTAL },
+    { -43478.849277542497, -43478.847384990586, 187.57072251057252, 114.66492634091992, 45.425600102171302, ECLIPSE_TOTAL },
+    { -43301.210226231895, -43301.212302360203, 158.69930059066974, 102.91779532330111, 40.2781580662122, ECLIPSE_TOTAL },
+    { -43124.781579204748, -43124.785288980805, 172.43096394406166, 101.03181669255719, 0, ECLIPSE_PARTIAL },
+    { -42946.642896862126, -42946.650885496085, 123.76027959748171, 0, 0, ECLIPSE_PENUMBRAL },
+    { -42770.414352047759, -42770.422569834511, 116.25853926467244, 0, 0, ECLIPSE_PENUMBRAL },
+    { -42622.022169902171, -42622.014419577506, 150.68159828369971, 36.851341981091537, 0, ECLIPSE_PARTIAL },
+    { -42445.218044977904, -42445.21194341153, 132.03524338372517, 55.705747415777296, 0, ECLIPSE_PARTIAL },
+    { -42268.01054307654, -42268.008809496991, 184.19931328855455, 114.44924937444739, 46.846007576677948, ECLIPSE_TOTAL },
+    { -42090.58295065014, -42090.581601491132, 165.28753320802934, 107.06475969753228, 46.663035497185774, ECLIPSE_TOTAL },
+    { -41913.805152403591, -41913.80920603947, 164.52162251458503, 95.836613341234624, 0, ECLIPSE_PARTIAL },
+    { -41736.169910873105, -41736.174388171217, 166.31012002530042, 93.679614902939647, 0, ECLIPSE_PARTIAL },
+    { -41588.739257087633, -41588.729521177396, 60.754441145109013, 0, 0, ECLIPSE_PENUMBRAL },
+    { -41559.307585098417, -41559.316106569888, 103.43510425882414, 0, 0, ECLIPSE_PENUMBRAL },
+    { -41411.732646951961, -41411.720292063932, 36.515483165276237, 0, 0, ECLIPSE_PENUMBRAL },
+    { -41382.047903359475, -41382.058670079219, 99.554215422249399, 0, 0, ECLIPSE_PENUMBRAL },
+    { -41234.073152082179, -41234.06758361082, 139.70591315359343, 68.311180409509689, 0, ECLIPSE_PARTIAL },
+    { -41057.63834330815, -41057.632282888539, 157.10566299792845, 73.764303821953945, 0, ECLIPSE_PARTIAL },
+    { -40879.528181430491, -40879.527352297569, 171.22695117839612, 109.86908976745326, 49.401094311615452, ECLIPSE_TOTAL },
+    { -40703.259936316448, -40703.260131933275, 167.99253321485594, 110.07239035621751, 51.189925605431199, ECLIPSE_TOTAL },
+    { -40525.265621548024, -40525.270554748822, 170.0801960733952, 91.247832716326229, 0, ECLIPSE_PARTIAL },
+    { -40348.623482941955, -40348.628864971812, 138.71898977318779, 71.211757238488644, 0, ECLIPSE_PARTIAL },
+    { -40171.265609704038, -40171.276280946309, 108.79538437875453, 0, 0, ECLIPSE_PENUMBRAL },
+    { -40023.225867211258, -40023.21848037828, 122.5277344143251, 0, 0, ECLIPSE_PENUMBRAL },
+    { -39993.900201850702, -39993.910222502018, 43.311844489071518, 0, 0, ECLIPSE_PENUMBRAL },
+    { -39846.942027097422, -39846.934416608463, 136.39127593429293, 10.128240123158321, 0, ECLIPSE_PARTIAL },
+    { -39668.731622464715, -39668.729304122491, 172.40348551946227, 108.21642762981355, 40.03226000641007, ECLIPSE_TOTAL },
+    { -39492.488420919035, -39492.486532962568, 162.33489626320079, 104.1306942893425, 41.911493394873105, ECLIPSE_TOTAL },
+    { -39314.541878371361, -39314.54577556959, 177.68595409579575, 103.46526571491268, 0, ECLIPSE_PARTIAL },
+    { -39137.840373878542, -39137.843399367332, 153.56422491080593, 96.048483598278835, 22.697660186095163, ECLIPSE_TOTAL },
+    { -38960.525107350375, -38960.534961355443, 119.96873738011345, 0, 0, ECLIPSE_PENUMBRAL },
+    { -38812.650200222859, -38812.638954010567, 21.961949636461213, 0, 0, ECLIPSE_PENUMBRAL },
+    { -38783.188543403172, -38783.196524841893, 112.9097251809435, 0, 0, ECLIPSE_PENUMBRAL },
+    { -38635.908541491059, -38635.902034311053, 141.71977781283204, 55.377247235155664, 0, ECLIPSE_PARTIAL },
+    { -38458.317992238568, -38458.310993370163, 151.25806810101494, 56.209302575443871, 0, ECLIPSE_PARTIAL },
+    { -38281.348346461709, -38281.347363375171, 160.89166144549381, 105.55584692163393, 47.726158534060232, ECLIPSE_TOTAL },
+    { -38104.25287285995, -38104.251663260773, 187.52821697329637, 117.0845295174513, 50.631433110684156, ECLIPSE_TOTAL },
+    { -37926.672310136484, -37926.676209077465, 150.02843003952876, 89.399794120690785, 0, ECLIPSE_PARTIAL },
+    { -37750.204860082929, -37750.209717407248, 169.24190171062946, 93.063384150154889, 0, ECLIPSE_PARTIAL },
+    { -37601.654545710837, -37601.643010903157, 38.968451261753216, 0, 0, ECLIPSE_PENUMBRAL },
+    { -37572.0752296746, -37572.084353815655, 97.791416239924729, 0, 0, ECLIPSE_PENUMBRAL },
+    { -37425.296631780919, -37425.287610153675, 92.047522505745292, 0, 0, ECLIPSE_PENUMBRAL },
+    { -37395.90059995326, -37395.910330634862, 92.061266003292985, 0, 0, ECLIPSE_PENUMBRAL },
+    { -37247.482746777794, -37247.475319247002, 153.83215251902584, 47.710245391353965, 0, ECLIPSE_PARTIAL },
+    { -37070.616225045829, -37070.612553217114, 149.51852115627844, 91.507081167655997, 0, ECLIPSE_PARTIAL },
+    { -36893.514023985612, -36893.512069976008, 187.27441796392668, 114.36484434816521, 44.857183449785225, ECLIPSE_TOTAL },
+    { -36715.902319192166, -36715.903879323239, 160.38141884200741, 105.06467874278314, 45.070912351948209, ECLIPSE_TOTAL },
+    { -36539.436368815535, -36539.439997500762, 172.18593796365894, 101.32185951748397, 0, ECLIPSE_PARTIAL },
+    { -36361.347804342491, -36361.355338343339, 131.32142641756218, 2.3951733810827136, 0, ECLIPSE_PARTIAL },
+    { -36185.056502378517, -36185.064617779157, 117.19600601121783, 0, 0, ECLIPSE_PENUMBRAL },
+    { -36036.736502012347, -36036.7282292608, 144.58125258679502, 0, 0, ECLIPSE_PENUMBRAL },
+    { -35859.870256812865, -35859.863943666605, 130.19822036381811, 50.41042119381018, 0, ECLIPSE_PARTIAL },
+    { -35682.715167992588, -35682.712981120232, 182.5167118414538, 112.67354160547256, 42.768589215120301, ECLIPSE_TOTAL },
+    { -35505.248894065422, -35505.247269833766, 165.51871931471396, 106.47938592068385, 44.808169265161268, ECLIPSE_TOTAL },
+    { -35328.486954518528, -35328.490639387455, 165.38564835616853, 98.601741894381121, 0, ECLIPSE_PARTIAL },
+    { -35150.858244058341, -35150.86240308507, 169.05372584180441, 97.143935703788884, 0, ECLIPSE_PARTIAL },
+    { -35003.382804362678, -35003.372978440158, 56.147399601177312, 0, 0, ECLIPSE_PENUMBRAL },
+    { -34973.968928736154, -34973.977179377194, 107.43831803498324, 0, 0, ECLIPSE_PENUMBRAL },
+    { -34796.756741184501, -34796.767120441262, 109.90541993756779, 0, 0, ECLIPSE_PENUMBRAL },
+    { -34648.713643497147, -34648.70796283106, 138.99943526659627, 66.563360657310113, 0, ECLIPSE_PARTIAL },
+    { -34472.352812767727, -34472.346222712258, 151.56965157890227, 62.262750926893204, 0, ECLIPSE_PARTIAL },
+    { -34294.176296125224, -34294.175384501097, 171.70915331924334, 110.03987250092905, 49.222730492474511, ECLIPSE_TOTAL },
+    { -34117.958233805868, -34117.957886649994, 167.30412503995467, 109.66911927214824, 50.898159220232628, ECLIPSE_TOTAL },
+    { -33939.926674381175, -33939.931558511722, 170.89597402489744, 92.131654596305452, 0, ECLIPSE_PARTIAL },
+    { -33763.312619691358, -33763.31749135899, 142.56549437181093, 78.711867081583478, 0, ECLIPSE_PARTIAL },
+    { -33585.932336258193, -33585.942936947453, 110.22016679809894, 0, 0, ECLIPSE_PENUMBRAL },
+    { -33437.919758835131, -33437.911836323896, 115.46004842792172, 0, 0, ECLIPSE_PENUMBRAL },
+    { -33408.591541346883, -33408.601159230544, 63.642168825608678, 0, 0, ECLIPSE_PENUMBRAL },
+    { -33261.594058850504, -33261.58643210127, 135.32104707090184, 0, 0, ECLIPSE_PENUMBRAL },
+    { -33083.440971746022, -33083.438046881398, 171.17560510640033, 105.49308008223306, 30.886874415446073, ECLIPSE_TOTAL },
+    { -32907.130431546349, -32907.128462483161, 161.74900163488928, 103.56577499129344, 40.979727432131767, ECLIPSE_TOTAL },
+    { -32729.264266680373, -32729.267545943727, 180.50509912980488, 108.01795865030726, 25.365847565699369, ECLIPSE_TOTAL },
+    { -32552.482382641756, -32552.485282892638, 154.18857421522262, 96.822558663552627, 25.826409817091189, ECLIPSE_TOTAL },
+    { -32375.242969600455, -32375.252244605879, 128.87116063357098, 0, 0, ECLIPSE_PENUMBRAL },
+    { -32197.841324913305, -32197.849192123969, 115.71848206920549, 0, 0, ECLIPSE_PENUMBRAL },
+    { -32050.579929910626, -32050.573212770221, 138.32416534773074, 48.47209187282715, 0, ECLIPSE_PARTIAL },
+    { -31873.017694888797, -31873.010219287622, 147.38042056473205, 41.862235558801331, 0, ECLIPSE_PARTIAL },
+    { -31696.002553732982, -31696.001362049694, 160.15659541968489, 105.01298951829085, 46.734957428416237, ECLIPSE_TOTAL },
+    { -31518.967910960688, -31518.966149849792, 186.86070472060237, 115.62736566876993, 47.15894778870279, ECLIPSE_TOTAL },
+    { -31341.320307297519, -31341.324041753418, 151.0163263938739, 91.030802753521129, 0, ECLIPSE_PARTIAL },
+    { -31164.915664497465, -31164.919950077394, 171.912100170739, 98.358537437743507, 0, ECLIPSE_PARTIAL },
+    { -31016.304510924507, -31016.292853440842, 33.015817411069293, 0, 0, ECLIPSE_PENUMBRAL },
+    { -30986.72711245, -30986.736163585741, 100.26059182797326, 0, 0, ECLIPSE_PENUMBRAL },
+    { -30839.992245465091, -30839.982821454818, 79.999805116967764, 0, 0, ECLIPSE_PENUMBRAL },
+    { -30810.596783807203, -30810.60598536213, 102.64179080579197, 0, 0, ECLIPSE_PENUMBRAL },
+    { -30662.146325724621, -30662.138803254627, 153.30989481881261, 44.946204720181413, 0, ECLIPSE_PARTIAL },
+    { -30485.305353380412, -30485.301177185935, 146.54133793897927, 86.636294443742372, 0, ECLIPSE_PARTIAL },
+    { -30308.178962182403, -30308.176945804065, 186.89563992462354, 114.04589724785183, 44.262840900337324, ECLIPSE_TOTAL },
+    { -30130.596695905555, -30130.597721315451, 161.77190451213391, 106.67388536181534, 48.298382684297394, ECLIPSE_TOTAL },
+    { -29954.088930328275, -29954.092493667104, 171.81856773386244, 101.48599517124239, 7.8524864694918506, ECLIPSE_TOTAL },
+    { -29776.056563385882, -29776.063607455071, 138.48128585930681, 41.911535210092552, 0, ECLIPSE_PARTIAL },
+    { -29599.696011134027, -29599.704042138696, 117.78534692974063, 0, 0, ECLIPSE_PENUMBRAL },
+    { -29451.457205348925, -29451.448363219784, 137.02180433581816, 0, 0, ECLIPSE_PENUMBRAL },
+    { -29274.517114600789, -29274.510634189555, 128.78018382063601, 45.737034835328814, 0, ECLIPSE_PARTIAL },
+    { -29097.425272711509, -29097.422582391388, 180.39951913728146, 110.20178779639537, 36.328023346723057, ECLIPSE_TOTAL },
+    { -28919.910305504716, -28919.90844979063, 165.77303533296799, 105.91089672554517, 42.914171557640657, ECLIPSE_TOTAL },
+    { -28743.173921269412, -28743.177187470821, 166.28010368614923, 101.34448425698793, 20.751374254468828, ECLIPSE_TOTAL },
+    { -28565.541758100244, -28565.545644310299, 171.3809949500137, 99.853538258175831, 0, ECLIPSE_PARTIAL },
+    { -28418.031554102636, -28418.021599262182, 49.147485126159154, 0, 0, ECLIPSE_PENUMBRAL },
+    { -28388.636263191038, -28388.644194417306, 111.95584342785878, 0, 0, ECLIPSE_PENUMBRAL },
+    { -28211.459256147453, -28211.469295234365, 117.95550062495749, 0, 0, ECLIPSE_PENUMBRAL },
+    { -28063.358385825246, -28063.352560109965, 137.98164007690502, 64.112810483202338, 0, ECLIPSE_PARTIAL },
+    { -27887.062593791055, -27887.05551838439, 145.84077966370387, 48.068203574221116, 0, ECLIPSE_PARTIAL },
+    { -27708.828061471657, -27708.827040927481, 172.14301095285919, 110.15871776937274, 48.912988241063431, ECLIPSE_TOTAL },
+    { -27532.653173191986, -27532.652311924398, 166.31045867514331, 108.74479685589904, 49.45880872575799, ECLIPSE_TOTAL },
+    { -27354.590539630204, -27354.595353165096, 171.78048893372761, 93.236613178742118, 0, ECLIPSE_PARTIAL },
+    { -27178.000444664434, -27178.004815596112, 145.89934162970167, 84.760161908925511, 0, ECLIPSE_PARTIAL },
+    { -27000.60012630008, -27000.61064417888, 111.75578843249241, 0, 0, ECLIPSE_PENUMBRAL },
+    { -26852.61589730281, -26852.607425351616, 107.08651291555725, 0, 0, ECLIPSE_PENUMBRAL },
+    { -26823.282204351719, -26823.291423968774, 78.187339171709027, 0, 0, ECLIPSE_PENUMBRAL },
+    { -26676.24352222529, -26676.235895530932, 134.42637349187862, 0, 0, ECLIPSE_PENUMBRAL },
+    { -26498.152915773608, -26498.149365726949, 169.4274041976314, 101.79508055123733, 11.03857403883012, ECLIPSE_TOTAL },
+    { -26321.76915894145, -26321.767132916731, 161.21957110794028, 103.10550826223334, 40.269414861104451, ECLIPSE_TOTAL },
+    { -26143.990241413445, -26143.992867379886, 182.93508189206477, 111.81841546960641, 38.058871518296655, ECLIPSE_TOTAL },
+    { -25967.120840416188, -25967.123645207805, 154.68902464199346, 97.396084133069962, 27.896044577064458, ECLIPSE_TOTAL },
+    { -25789.964978958797, -25789.973629416068, 137.22409647685708, 0, 0, ECLIPSE_PENUMBRAL },
+    { -25612.489808261395, -25612.497597394489, 117.87283139914507, 0, 0, ECLIPSE_PENUMBRAL },
+    { -25465.257653989589, -25465.250671517915, 134.08768347610021, 37.772866876912303, 0, ECLIPSE_PARTIAL },
+    { -25287.711025190198, -25287.70313691322, 143.76476474833908, 21.335292589792516, 0, ECLIPSE_PARTIAL },
+    { -25110.662543981609, -25110.661091026639, 159.28134465386393, 104.23473258008016, 45.168524187756702, ECLIPSE_TOTAL },
+    { -24933.676716927592, -24933.674464100241, 185.97594094258966, 113.83074120618403, 42.600902405683883, ECLIPSE_TOTAL },
+    { -24755.973697709313, -24755.97722311367, 152.20928779046517, 92.957393745600712, 0, ECLIPSE_PARTIAL },
+    { -24579.620396299197, -24579.624159057712, 173.93101357243722, 102.33070663525723, 0, ECLIPSE_PARTIAL },
+    { -24430.95759194894, -24430.945793295243, 22.847587332653347, 0, 0, ECLIPSE_PENUMBRAL },
+    { -24401.384552362844, -24401.393489499987, 103.50197904539527, 0, 0, ECLIPSE_PENUMBRAL },
+    { -24254.686062133227, -24254.676249793687, 65.530396554095205, 0, 0, ECLIPSE_PENUMBRAL },
+    { -24225.288209445323, -24225.296911707519, 111.10034169629216, 0, 0, ECLIPSE_PENUMBRAL },
+    { -24076.811035242856, -24076.80341279248, 152.60984437685693, 41.662862931552809, 0, ECLIPSE_PARTIAL },
+    { -23899.993723998581, -23899.989048356394, 143.19436953723198, 80.826331688440405, 0, ECLIPSE_PARTIAL },
+    { -23722.843818174792, -23722.84173646877, 186.43315384571906, 113.70369183568982, 43.622806338826194, ECLIPSE_TOTAL },
+    { -23545.291009811488, -23545.291499013485, 162.82617455930449, 107.69812176906271, 50.112908317241818, ECLIPSE_TOTAL },
+    { -23368.73938885592, -23368.742897466578, 171.36437125765951, 101.56711715797428, 11.472674462129362, ECLIPSE_TOTAL },
+    { -23190.767287938117, -23190.773817495705, 145.09211329801474, 58.651532621006481, 0, ECLIPSE_PARTIAL },
+    { -23014.332850480285, -23014.340812612361, 118.09576108760666, 0, 0, ECLIPSE_PENUMBRAL },
+    { -22866.181709423829, -22866.172273355231, 127.90166701481212, 0, 0, ECLIPSE_PENUMBRAL },
+    { -22689.159631273295, -22689.153015503856, 127.68499205965782, 41.559709827415645, 0, ECLIPSE_PARTIAL },
+    { -22512.139158018032, -22512.135927662373, 177.80062786914641, 106.91277204343351, 25.502834651560988, ECLIPSE_TOTAL },
+    { -22334.566690345069, -22334.564648495172, 166.07854872039752, 105.42942366097122, 41.152579102199525, ECLIPSE_TOTAL },
+    { -22157.863940453266, -22157.866755129311, 167.08790679636877, 103.84205837210175, 31.641933517239522, ECLIPSE_TOTAL },
+    { -21980.220643510809, -21980.22429746974, 173.36409980052849, 101.99992210837081, 0, ECLIPSE_PARTIAL },
+    { -21832.684841912087, -21832.674722312389, 38.604017938196193, 0, 0, ECLIPSE_PENUMBRAL },
+    { -21803.307337134484, -21803.314916781117, 116.60314791515702, 0, 0, ECLIPSE_PENUMBRAL },
+    { -21626.155778987046, -21626.165519830789, 124.34951150673442, 0, 0, ECLIPSE_PENUMBRAL },
+    { -21478.008831140214, -21478.002811498933, 136.47607528720982, 60.470721111923922, 0, ECLIPSE_PARTIAL },
+    { -21301.766262127883, -21301.758753951926, 140.10903446614975, 28.304279306321405, 0, ECLIPSE_PARTIAL },
+    { -21123.485795998407, -21123.484614709916, 172.48571779666236, 110.15923202532576, 48.309135309245903, ECLIPSE_TOTAL },
+    { -20947.342621239615, -20947.341291371766, 165.09984111122321, 107.41691497358261, 47.062709372257814, ECLIPSE_TOTAL },
+    { -20769.260123770626, -20769.264814323535, 172.90590245596832, 94.868832512001973, 0, ECLIPSE_PARTIAL },
+    { -20592.684410444381, -20592.688311324753, 148.66162785328925, 89.493073906050995, 0, ECLIPSE_PARTIAL },
+    { -20415.270687165576, -20415.281091831865, 113.74937885266263, 0, 0, ECLIPSE_PENUMBRAL },
+    { -20267.314412926047, -20267.305374284129, 96.932929298782256, 0, 0, ECLIPSE_PENUMBRAL },
+    { -20237.972399878414, -20237.981221850918, 89.928602105355822, 0, 0, ECLIPSE_PENUMBRAL },
+    { -20090.889751788847, -20090.882146350617, 133.78381270333193, 0, 0, ECLIPSE_PENUMBRAL },
+    { -19912.869110544136, -19912.864898426007, 167.00476433354197, 96.771138265030459, 0, ECLIPSE_PARTIAL },
+    { -19736.404235271606, -19736.402179958441, 160.76330302865244, 102.77657817903673, 39.8552329960512, ECLIPSE_TOTAL },
+    { -19558.720649511099, -19558.722576967659, 184.94131314946571, 114.85355735756457, 45.933082526607905, ECLIPSE_TOTAL },
+    { -19381.755187536979, -19381.757932677549, 155.0508966812049, 97.756767411483452, 29.078940968611278, ECLIPSE_TOTAL },
+    { -19204.689298994286, -19204.697295262806, 144.79889844660647, 18.982358678185847, 0, ECLIPSE_PARTIAL },
+    { -19027.134827121761, -19027.142568654846, 119.52610307140276, 0, 0, ECLIPSE_PENUMBRAL },
+    { -18879.938282596133, -18879.931010911027, 129.26032509509241, 19.505099665839225, 0, ECLIPSE_PARTIAL },
+    { -18702.399937437531, -18702.391681482906, 140.31879544345429, 0, 0, ECLIPSE_PENUMBRAL },
+    { -18525.327129164973, -18525.325374936543, 158.24198566144332, 103.1766032348969, 42.865413332765456, ECLIPSE_TOTAL },
+    { -18348.379664903339, -18348.37697726152, 184.95323184382869, 111.8208545143716, 36.991536237183027, ECLIPSE_TOTAL },
+    { -18170.632403283613, -18170.635677345748, 153.56018259655684, 95.082843855489045, 14.269139420357533, ECLIPSE_TOTAL },
+    { -17994.317995209614, -17994.321296235543, 175.35876209061826, 105.21460904565174, 22.82116216229042, ECLIPSE_TOTAL },
+    { -17816.04831253165, -17816.057090668699, 107.53547115018591, 0, 0, ECLIPSE_PENUMBRAL },
+    { -17669.375024887966, -17669.364862388506, 47.853701939166058, 0, 0, ECLIPSE_PENUMBRAL },
+    { -17639.97294823451, -17639.981200941555, 117.68349219550146, 0, 0, ECLIPSE_PENUMBRAL },
+    { -17491.479904713869, -17491.472149651767, 151.44482013594825, 36.485790341394022, 0, ECLIPSE_PARTIAL },
+    { -17314.680197452468, -17314.675039077378, 139.54685661097756, 74.04964194225613, 0, ECLIPSE_PARTIAL },
+    { -17137.510490355031, -17137.508323782837, 185.84521108889021, 113.2681868437794, 42.757748750445899, ECLIPSE_TOTAL },
+    { -16959.985307394123, -16959.985260206267, 163.55410808318993, 108.15269577666186, 50.66473600192694, ECLIPSE_TOTAL },
+    { -16783.390670475841, -16783.394108806842, 170.91767241479829, 101.75284329772694, 14.925107482122257, ECLIPSE_TOTAL },
+    { -16605.479389747226, -16605.485387531662, 151.13504617474973, 70.87267949944362, 0, ECLIPSE_PARTIAL },
+    { -16428.968954428939, -16428.976848572092, 118.33339917211561, 0, 0, ECLIPSE_PENUMBRAL },
+    { -16280.910325037079, -16280.900271263245, 116.75219684519107, 0, 0, ECLIPSE_PENUMBRAL },
+    { -16103.79831335197, -16103.791593002665, 126.9163480498537, 38.060735121835023, 0, ECLIPSE_PARTIAL },
+    { -15926.856595026655, -15926.852793768636, 174.6458111400716, 102.63533605932025, 0, ECLIPSE_PARTIAL },
+    { -15749.218632701879, -15749.216447814226, 166.45832780646742, 105.07276088552317, 39.642705538863083, ECLIPSE_TOTAL },
+    { -15572.559125097432, -15572.561436937096, 167.80044827130041, 106.11031172331423, 39.19236064015422, ECLIPSE_TOTAL },
+    { -15394.893975303879, -15394.897450003042, 175.00123055840959, 103.59220671918592, 14.890042974147946, ECLIPSE_TOTAL },
+    { -15247.343521090314, -15247.333197715949, 18.516863537952304, 0, 0, ECLIPSE_PENUMBRAL },
+    { -15217.983476770745, -15217.99066184358, 121.43393797174213, 12.58880717708962, 0, ECLIPSE_PARTIAL },
+    { -15040.846027505462, -15040.855518244058, 129.32567040305003, 0, 0, ECLIPSE_PENUMBRAL },
+    { -14892.664572467658, -14892.658317014786, 134.49251754151192, 55.447711443412118, 0, ECLIPSE_PARTIAL },
+    { -14716.463691265562, -14716.455804489406, 134.51029893709347, 0, 0, ECLIPSE_PENUMBRAL },
+    { -14538.148309298587, -14538.146929835984, 172.73407818982378, 110.024203559733, 47.371296311903279, ECLIPSE_TOTAL },
+    { -14362.02825416218, -14362.026486145867, 163.70530849584611, 105.74670244168374, 43.736904774414143, ECLIPSE_TOTAL },
+    { -14183.933804923881, -14183.938337567419, 174.14723592053633, 96.775884995731758, 0, ECLIPSE_PARTIAL },
+    { -14007.365449004052, -14007.368902993669, 150.9825292401365, 93.281095070560696, 0, ECLIPSE_PARTIAL },
+    { -13829.945429706098, -13829.955679877665, 116.38450577316689, 0, 0, ECLIPSE_PENUMBRAL },
+    { -13682.01313456951, -13682.003532888888, 84.801338295073947, 0, 0, ECLIPSE_PENUMBRAL },
+    { -13652.659949740048, -13652.668393352929, 99.468447486724472, 0, 0, ECLIPSE_PENUMBRAL },
+    { -13505.535550584813, -13505.52796507148, 133.09249352096231, 0, 0, ECLIPSE_PENUMBRAL },
+    { -13327.586075928246, -13327.581200666371, 163.99264188890811, 90.421318853914272, 0, ECLIPSE_PARTIAL },
+    { -13151.038600481479, -13151.036517971384, 160.30988931612228, 102.47380681466893, 39.475895397918066, ECLIPSE_TOTAL },
+    { -12973.45229791778, -12973.453514577812, 186.38889818801545, 116.95080884353956, 50.729110744432546, ECLIPSE_TOTAL },
+    { -12796.387684147674, -12796.390386312112, 155.35019138405914, 98.033307446166873, 29.90059911069693, ECLIPSE_TOTAL },
+    { -12619.416672906769, -12619.423979686982, 151.71234317720518, 50.742047506064409, 0, ECLIPSE_PARTIAL },
+    { -12441.776546939316, -12441.784271606992, 120.68248267576564, 0, 0, ECLIPSE_PENUMBRAL },
+    { -12294.62427131752, -12294.616666399523, 123.43825221585575, 0, 0, ECLIPSE_PENUMBRAL },
+    { -12117.082852512531, -12117.074290163875, 137.33102172423969, 0, 0, ECLIPSE_PENUMBRAL },
+    { -11939.997243873464, -11939.995140395546, 156.97161802425398, 101.71301858383231, 39.400324001762783, ECLIPSE_TOTAL },
+    { -11763.075344436158, -11763.072293611765, 183.91678036467056, 109.81349256573594, 30.555821501329774, ECLIPSE_TOTAL },
+    { -11585.297060510837, -11585.300035447917, 155.04512022584095, 97.358314077719115, 24.746559973427793, ECLIPSE_TOTAL },
+    { -11409.00921580172, -11409.012109919595, 176.34502108863671, 107.30544913662015, 31.984285252547124, ECLIPSE_TOTAL },
+    { -11230.718380303006, -11230.726953921236, 112.21119786830968, 0, 0, ECLIPSE_PENUMBRAL },
+    { -11084.060434296785, -11084.049947461426, 18.639893239742378, 0, 0, ECLIPSE_PENUMBRAL },
+    { -11054.651761727746, -11054.659609509199, 122.93247989218798, 0, 0, ECLIPSE_PENUMBRAL },
+    { -10906.153166955601, -10906.145245287771, 149.75730524471146, 28.207031152123818, 0, ECLIPSE_PARTIAL },
+    { -10729.363963082553, -10729.358345303817, 135.67299756265129, 66.202745814516675, 0, ECLIPSE_PARTIAL },
+    { -10552.179132532056, -10552.176860503947, 185.12925651215483, 112.72618197166594, 41.615787634364096, ECLIPSE_TOTAL },
+    { -10374.678526255904, -10374.677952475136, 163.95981390582165, 108.05874877478345, 50.027386575238779, ECLIPSE_TOTAL },
+    { -10198.042434896688, -10198.045792211497, 170.47695983550511, 102.00280660545104, 18.081475646467879, ECLIPSE_TOTAL },
+    { -10020.19152169584, -10020.196982022744, 156.54094880374032, 80.434807698911754, 0, ECLIPSE_PARTIAL },
+    { -9843.6048977492646, -9843.6127211320963, 118.56819631007966, 0, 0, ECLIPSE_PENUMBRAL },
+    { -9695.6421470118512, -9695.6314619912737, 102.96887004558812, 0, 0, ECLIPSE_PENUMBRAL },
+    { -9666.0023760543863, -9666.0143518795576, 50.369999041431583, 0, 0, ECLIPSE_PENUMBRAL },
+    { -9518.4338541659563, -9518.4270550288857, 126.42728159262333, 35.268329294049181, 0, ECLIPSE_PARTIAL },
+    { -9341.5761355987524, -9341.5717473700442, 170.9190773514274, 97.243790864304174, 0, ECLIPSE_PARTIAL },
+    { -9163.8675739456176, -9163.865275967948, 166.88574086583685, 104.82269577303668, 38.354332917515421, ECLIPSE_TOTAL },
+    { -8987.2561216148843, -8987.2579121956078, 168.2731926550332, 107.90193320601247, 44.475784922396997, ECLIPSE_TOTAL },
+    { -8809.5632372282471, -8809.5665717953379, 176.38090922599076, 104.81912426112103, 20.713728036498651, ECLIPSE_TOTAL },
+    { -8632.6634440119924, -8632.6702015272986, 126.21769536228385, 38.298475965857506, 0, ECLIPSE_PARTIAL },
+    { -8455.5310293373477, -8455.5403094588437, 133.25328208433348, 0, 0, ECLIPSE_PENUMBRAL },
+    { -8307.3267422001918, -8307.3201991068054, 131.85025846090866, 48.168034571281169, 0, ECLIPSE_PARTIAL },
+    { -8131.1541272896002, -8131.1459210270377, 129.25503179096268, 0, 0, ECLIPSE_PENUMBRAL },
+    { -7952.8189776981362, -7952.8173292357797, 172.80771213590924, 109.61311029699573, 45.734608534330619, ECLIPSE_TOTAL },
+    { -7776.7071956404752, -7776.7050467439385, 162.25635462309583, 103.92131473054178, 39.774409026576905, ECLIPSE_TOTAL },
+    { -7598.6146081306133, -7598.6189179966113, 175.64145354052016, 99.177668642296339, 0, ECLIPSE_PARTIAL },
+    { -7422.0422787378557, -7422.0453208590952, 152.87700069675338, 96.232021659234306, 22.746293091695406, ECLIPSE_TOTAL },
+    { -7244.6247450344526, -7244.6347951363232, 119.64755529050308, 0, 0, ECLIPSE_PENUMBRAL },
+    { -7096.7123037665087, -7096.7021399670557, 69.587620887468802, 0, 0, ECLIPSE_PENUMBRAL },
+    { -7067.3452651620628, -7067.3533466108956, 107.52583927933301, 0, 0, ECLIPSE_PENUMBRAL },
+    { -6920.180821795886, -6920.173257200845, 132.38041779433843, 0, 0, ECLIPSE_PENUMBRAL },
+    { -6742.3059035158058, -6742.3003432211599, 160.21598481114779, 82.140718216178357, 0, ECLIPSE_PARTIAL },
+    { -6565.6712695548758, -6565.6691733980115, 159.89002708178305, 102.24985475339054, 39.265802909794729, ECLIPSE_TOTAL },
+    { -6388.1858890801268, -6388.1863758998825, 187.2720432371716, 118.1244001340383, 53.206804707442643, ECLIPSE_TOTAL },
+    { -6211.0186287272654, -6211.0213037100084, 155.59303014873876, 98.237086397348321, 30.423238509029034, ECLIPSE_TOTAL },
+    { -6034.1441249681402, -6034.1507348786427, 157.69749074526771, 67.737390466063516, 0, ECLIPSE_PARTIAL },
+    { -5856.4160629364778, -5856.4237941040383, 121.48648796595808, 0, 0, ECLIPSE_PENUMBRAL },
+    { -5709.3130549135894, -5709.3050964064832, 116.74585400891374, 0, 0, ECLIPSE_PENUMBRAL },
+    { -5679.8872024223656, -5679.898497840918, 37.462244318085141, 0, 0, ECLIPSE_PENUMBRAL },
+    { -5531.7615843662543, -5531.752759074001, 134.69506761728553, 0, 0, ECLIPSE_PENUMBRAL },
+    { -5354.6712786045236, -5354.6687938443793, 155.4482453790115, 99.801967773164506, 34.350057338888291, ECLIPSE_TOTAL },
+    { -5177.7650756117046, -5177.7617201077765, 182.8968379527214, 107.87305860518245, 22.908303109870758, ECLIPSE_TOTAL },
+    { -4999.9674055807682, -4999.9700361990281, 156.6033027080266, 99.664551739479066, 32.171480364704621, ECLIPSE_TOTAL },
+    { -4823.6928330988267, -4823.6953875001018, 176.9233926373272, 108.72255070535175, 37.247286687852466, ECLIPSE_TOTAL },
+    { -4645.3947285396262, -4645.4030526160177, 117.41403717533103, 0, 0, ECLIPSE_PENUMBRAL },
+    { -4469.3243904059736, -4469.3318809146567, 127.06780345310108, 0, 0, ECLIPSE_PENUMBRAL },
+    { -4320.8321017876779, -4320.8239672757918, 147.37630735988205, 8.779013077437412, 0, ECLIPSE_PARTIAL },
+    { -4144.0441868246062, -4144.0381394139094, 131.66466534392384, 57.123539319363772, 0, ECLIPSE_PARTIAL },
+    { -3966.8523662694929, -3966.8499423738181, 184.20139053927414, 111.94420068441104, 39.814421863447933, ECLIPSE_TOTAL },
+    { -3789.3699887474804, -3789.3689041661783, 164.0823866134815, 107.45796647821408, 48.250426767663157, ECLIPSE_TOTAL },
+    { -3612.6969116405548, -3612.7001556815494, 170.1098506260314, 102.45449455385824, 21.741595303792565, ECLIPSE_TOTAL },
+    { -3434.9027092197271, -3434.9076356444239, 161.3270383642157, 88.099965301043994, 0, ECLIPSE_PARTIAL },
+    { -3258.2428295188802, -3258.2505608181223, 119.06723112966574, 0, 0, ECLIPSE_PENUMBRAL },
+    { -3110.3755583593215, -3110.3642440790481, 85.600174213141145, 0, 0, ECLIPSE_PENUMBRAL },
+    { -3080.7325895225658, -3080.7440116095881, 76.892556203420099, 0, 0, ECLIPSE_PENUMBRAL },
+    { -2933.0668174035659, -2933.0599609911615, 126.17254846663855, 33.197423101846653, 0, ECLIPSE_PARTIAL },
+    { -2756.2983028342032, -2756.2933069576293, 166.49381933606492, 90.386702396972396, 0, ECLIPSE_PARTIAL },
+    { -2578.5129871318063, -2578.510611627265, 167.38951648134389, 104.72263863812259, 37.434524039890675, ECLIPSE_TOTAL },
+    { -2401.9563832967583, -2401.9576189265827, 168.48751835721487, 109.22319773195341, 48.204588000589865, ECLIPSE_TOTAL },
+    { -2224.2281580172225, -2224.2313941141892, 177.51771878869476, 105.71212562590517, 23.886873788869707, ECLIPSE_TOTAL },
+    { -2047.3472649053326, -2047.353559779966, 130.91378441360575, 52.770776108518476, 0, ECLIPSE_PARTIAL },
+    { -1870.2098640166671, -1870.218981259783, 136.15039947693731, 0, 0, ECLIPSE_PENUMBRAL },
+    { -1721.9939048323351, -1721.9870352940095, 128.57963013526387, 37.554819587949169, 0, ECLIPSE_PARTIAL },
+    { -1545.838507661864, -1545.8300301225911, 124.32089759193332, 0, 0, ECLIPSE_PENUMBRAL },
+    { -1367.4947409525853, -1367.4927816862746, 172.70223791694661, 108.91385133065342, 43.313441822792811, ECLIPSE_TOTAL },
+    { -1191.3809923784211, -1191.3785027761373, 160.77314887917964, 101.98193879159589, 35.103730753617128, ECLIPSE_TOTAL },
+    { -1013.3014426868356, -1013.3054731717172, 177.28686203866346, 101.87001292812056, 0, ECLIPSE_PARTIAL },
+    { -836.7145213653655, -836.71718845168846, 154.41670738884568, 98.51319947752927, 31.161786831708014, ECLIPSE_TOTAL },
+    { -659.30910958638754, -659.31890788723479, 123.55354118627474, 0, 0, ECLIPSE_PENUMBRAL },
+    { -511.40956912504714, -511.39886303938061, 49.405391174768738, 0, 0, ECLIPSE_PENUMBRAL },
+    { -482.02646108841628, -482.03421072121398, 114.21844848239289, 0, 0, ECLIPSE_PENUMBRAL },
+    { -334.82832313874513, -334.82075513157156, 131.31796112036227, 0, 0, ECLIPSE_PENUMBRAL },
+    { -157.02399835341842, -157.01777465751493, 155.89630087071782, 71.904373476909313, 0, ECLIPSE_PARTIAL },
+    { 19.695139033193005, 19.697260865158405, 159.4337903546193, 101.99157427860257, 38.93541847709713, ECLIPSE_TOTAL },
+    { 197.08049386490541, 197.08073861793417, 187.55739926364186, 118.34164378738706, 53.556598430916438, ECLIPSE_TOTAL },
+    { 374.35066154693965, 374.34801088865555, 155.82560629076397, 98.445940817350674, 30.909103100038919, ECLIPSE_TOTAL },
+    { 551.12809175519885, 551.12218991752718, 162.89193817899104, 80.050608848478078, 0, ECLIPSE_PARTIAL },
+    { 728.94526322902539, 728.93751509763979, 122.11280263766639, 0, 0, ECLIPSE_PENUMBRAL },
+    { 875.99431723895214, 876.00266028597309, 108.78527477895659, 0, 0, ECLIPSE_PENUMBRAL },
+    { 905.40482277771991, 905.39412856787442, 65.129056120194946, 0, 0, ECLIPSE_PENUMBRAL },
+    { 1053.5655623670027, 1053.5745919033197, 132.68190479771874, 0, 0, ECLIPSE_PENUMBRAL },
+    { 1230.6503292274308, 1230.6532333850564, 153.59358018644343, 97.290339621467865, 26.375239843273448, ECLIPSE_TOTAL },
+    { 1407.5514733346076, 1407.5550738236498, 181.96126898839793, 106.12280518196712, 12.894187672554835, ECLIPSE_TOTAL },
+    { 1585.3569560330441, 1585.3547135127485, 158.16012342873364, 101.89154633908402, 38.07450627147773, ECLIPSE_TOTAL },
+    { 1761.6306146928766, 1761.6283393116325, 177.20731703489946, 109.65239089669922, 40.601725887590874, ECLIPSE_TOTAL },
+    { 1939.9215985293974, 1939.9135811803058, 123.16904272438478, 0, 0, ECLIPSE_PENUMBRAL },
+    { 2116.0099016284425, 2116.0027137925085, 130.22761801930756, 28.86115036708361, 0, ECLIPSE_PARTIAL },
+    { 2264.4834989316978, 2264.4918909049784, 144.22503146102827, 0, 0, ECLIPSE_PENUMBRAL },
+    { 2441.2795747775895, 2441.2860203734485, 127.59413562231202, 46.330554849955661, 0, ECLIPSE_PARTIAL },
+    { 2618.4707306275682, 2618.4733441893686, 183.07823798859317, 110.91836783565668, 37.254507011166424, ECLIPSE_TOTAL },
+    { 2795.9414631342534, 2795.9430327571658, 163.95905000437779, 106.4217117354201, 45.390302221712773, ECLIPSE_TOTAL },
+    { 2972.6466726110089, 2972.6435659153099, 169.79599794824026, 103.03272841309081, 25.39650982904277, ECLIPSE_TOTAL },
+    { 3150.3868900133243, 3150.3824961795467, 165.5704270494607, 94.396350329916459, 0, ECLIPSE_PARTIAL },
+    { 3327.1178563026992, 3327.1102316974634, 119.74044258669892, 0, 0, ECLIPSE_PENUMBRAL },
+    { 3474.8903756690479, 3474.9023085101203, 61.945735277040512, 0, 0, ECLIPSE_PENUMBRAL },
+    { 3504.5385827816608, 3504.5277206131923, 95.332710826005496, 0, 0, ECLIPSE_PENUMBRAL },
+    { 3652.3009618949627, 3652.3078700737101, 125.95779400031461, 31.225437175598927, 0, ECLIPSE_PARTIAL },
+    { 3828.9798901369254, 3828.985486046779, 161.47249495592405, 81.977483247355849, 0, ECLIPSE_PARTIAL },
+    { 4006.8431207407866, 4006.8455574429768, 167.9128909755309, 104.70110866586765, 36.698072233375569, ECLIPSE_TOTAL },
+    { 4183.3431836822847, 4183.3425070121166, 168.36387475501397, 109.94735471635067, 50.406425185647095, ECLIPSE_TOTAL },
+    { 4361.109061343438, 4361.1059035780472, 178.51051426427148, 106.4465015935275, 26.095132441623718, ECLIPSE_TOTAL },
+    { 4537.9667897986119, 4537.9609784489694, 135.31799992233573, 63.667265269177733, 0, ECLIPSE_PARTIAL },
+    { 4715.1157835405784, 4715.1067971629072, 138.34759872479481, 0, 0, ECLIPSE_PENUMBRAL },
+    { 4863.331765641512, 4863.3390205406959, 124.29945351585047, 16.129261528039933, 0, ECLIPSE_PARTIAL },
+    { 4892.6844126588931, 4892.6740903646905, 18.430221745147719, 0, 0, ECLIPSE_PENUMBRAL },
+    { 5039.4849634655757, 5039.4936499408277, 120.07207700582512, 0, 0, ECLIPSE_PENUMBRAL },
+    { 5217.8214888700941, 5217.8238303027847, 172.30081641653669, 107.71689044675441, 39.401852016162593, ECLIPSE_TOTAL },
+    { 5393.9522052932771, 5393.9549786334728, 159.3693706132035, 100.11200871762412, 30.023633214295842, ECLIPSE_TOTAL },
+    { 5572.0043554255772, 5572.0006750975981, 179.09589233291626, 104.83627003864967, 5.7709309445635881, ECLIPSE_TOTAL },
+    { 5748.6188148949113, 5748.6164770036712, 155.63743324870302, 100.21971745292831, 36.293363719378249, ECLIPSE_TOTAL },
+    { 5926.0010967819671, 5925.9916071263478, 128.0372573468776, 0, 0, ECLIPSE_PENUMBRAL },
+    { 6103.2956453991819, 6103.2882036582569, 119.96278274513315, 0, 0, ECLIPSE_PENUMBRAL },
+    { 6250.5232761709158, 6250.5308587678792, 130.06820769784099, 0, 0, ECLIPSE_PENUMBRAL },
+    { 6428.2578532475336, 6428.2647368460057, 150.8851934014092, 58.402800738622318, 0, ECLIPSE_PARTIAL },
+    { 6605.0605878387641, 6605.062746096185, 158.9417881306872, 101.70416285953252, 38.493330457858974, ECLIPSE_TOTAL },
+    { 6782.3479525502289, 6782.3489193164141, 187.25857667574019, 117.62242516415427, 51.856780402595177, ECLIPSE_TOTAL },
+    { 6959.7198772415823, 6959.7172491675665, 156.05512390284275, 98.66658166552952, 31.38004663400352, ECLIPSE_TOTAL },
+    { 7136.4020103096218, 7136.3968084981998, 167.20440604542091, 89.350131842074916, 0, ECLIPSE_PARTIAL },
+    { 7314.306872323843, 7314.2990993116, 122.62792436638847, 0, 0, ECLIPSE_PENUMBRAL },
+    { 7461.3006316328947, 7461.3093653629912, 99.657583330990747, 0, 0, ECLIPSE_PENUMBRAL },
+    { 7490.697899949726, 7490.6878060486133, 82.981729580060346, 0, 0, ECLIPSE_PENUMBRAL },
+    { 7638.8961270455529, 7638.9053254519449, 131.04898065314046, 0, 0, ECLIPSE_PENUMBRAL },
+    { 7815.9683431205376, 7815.9716971912458, 151.3627317432838, 94.075622489035595, 9.4374003064149292, ECLIPSE_TOTAL },
+    { 7992.8737637518434, 7992.8775542237872, 181.12995677503932, 104.6247113723075, 0, ECLIPSE_PARTIAL },
+    { 8170.67681972836, 8170.67500151268, 159.63871309322712, 103.90775967978698, 42.755696383173927, ECLIPSE_TOTAL },
+    { 8346.9602588554353, 8346.9582098363426, 177.25347093059099, 110.23513718231698, 42.833480487170164, ECLIPSE_TOTAL },
+    { 8525.2323893598405, 8525.2247205869335, 129.10334347427124, 0, 0, ECLIPSE_PENUMBRAL },
+    { 8701.3503846480235, 8701.3434505811547, 132.6169526213198, 39.373348496592371, 0, ECLIPSE_PARTIAL },
+    { 8849.7923925594914, 8849.8010972874799, 140.06227731195395, 0, 0, ECLIPSE_PENUMBRAL },
+    { 9026.6076040705557, 9026.6144145718026, 123.55093219637638, 32.521643600921379, 0, ECLIPSE_PARTIAL },
+    { 9203.7884237793096, 9203.7912803842391, 181.67316238294006, 109.51053349126596, 33.345088087662589, ECLIPSE_TOTAL },
+    { 9381.2565267028131, 9381.2585483912007, 163.65978310946957, 105.0396557613567, 41.485222283372423, ECLIPSE_TOTAL },
+    { 9557.9850911388603, 9557.9821758534526, 169.62354753821273, 103.89297551329946, 29.612266252952395, ECLIPSE_TOTAL },
+    { 9735.6799292880023, 9735.6760401044448, 169.19444892788306, 99.38282444680226, 0, ECLIPSE_PARTIAL },
+    { 9912.4750800801321, 9912.4675932828086, 120.81432958308142, 0, 0, ECLIPSE_PENUMBRAL },
+    { 10060.156671310982, 10060.16920176317, 13.695908099325607, 0, 0, ECLIPSE_PENUMBRAL },
+    { 10089.812030713845, 10089.801725114685, 109.66801702830708, 0, 0, ECLIPSE_PENUMBRAL },
+    { 10237.669160021331, 10237.676115406006, 125.77834408002673, 29.335334500501631, 0, ECLIPSE_PARTIAL },
+    { 10414.257925173899, 10414.26411705907, 155.75636481211404, 71.399467205774272, 0, ECLIPSE_PARTIAL },
+    { 10592.200691129719, 10592.203171122741, 168.46237875928637, 104.76909022414475, 36.192073758429615, ECLIPSE_TOTAL },
+    { 10768.640881538429, 10768.640783610594, 167.89238493132871, 110.07531469222158, 51.254547899588943, ECLIPSE_TOTAL },
+    { 10946.449387671879, 10946.446277066685, 179.31710643897532, 106.96694101468893, 27.354552526812768, ECLIPSE_TOTAL },
+    { 11123.278787868703, 11123.273479981346, 139.41267388334381, 72.521908181661274, 0, ECLIPSE_PARTIAL },
+    { 11300.445209271817, 11300.436326920712, 139.97363063666853, 0, 0, ECLIPSE_PENUMBRAL },
+    { 11448.653018829029, 11448.660690834196, 119.14514187243185, 0, 0, ECLIPSE_PENUMBRAL },
+    { 11477.99928812327, 11477.989329693235, 48.408764666528441, 0, 0, ECLIPSE_PENUMBRAL },
+    { 11624.814764557876, 11624.823610871132, 116.42485688760644, 0, 0, ECLIPSE_PENUMBRAL },
+    { 11803.132069148725, 11803.134839527132, 171.57444926997414, 105.96966836223146, 33.386555937468074, ECLIPSE_TOTAL },
+    { 11979.290719333418, 11979.293734854427, 158.0476218421245, 98.320006930298405, 24.297471278405283, ECLIPSE_TOTAL },
+    { 12157.304145042177, 12157.300872110567, 180.92119886990986, 107.8186239459319, 25.146177546994295, ECLIPSE_TOTAL },
+    { 12333.957338861399, 12333.95528692168, 156.61302071734099, 101.49318729861989, 39.731568476418033, ECLIPSE_TOTAL },
+    { 12511.305171811731, 12511.296053053116, 133.05707439430989, 0, 0, ECLIPSE_PENUMBRAL },
+    { 12688.623092081603, 12688.615915843051, 124.66780180111527, 15.092306544684106, 0, ECLIPSE_PARTIAL },
+    { 12835.87109644156, 12835.878728515439, 128.31057125120424, 0, 0, ECLIPSE_PENUMBRAL },
+    { 13013.542228744067, 13013.549741916764, 145.37951538339257, 39.425221694691572, 0, ECLIPSE_PARTIAL },
+    { 13190.423005888726, 13190.425228852127, 158.36759628611617, 101.300730840303, 37.706649226311129, ECLIPSE_TOTAL },
+    { 13367.617684331986, 13367.61935023148, 186.41697826562449, 116.02767624499393, 48.078794907778502, ECLIPSE_TOTAL },
+    { 13545.086497347034, 13545.083912020511, 156.35528659171541, 99.021665148320608, 32.21479657542659, ECLIPSE_TOTAL },
+    { 13721.677542558478, 13721.673031788936, 170.75217794321361, 96.562676910980372, 0, ECLIPSE_PARTIAL },
+    { 13899.667001435526, 13899.659209992378, 123.21536395887961, 0, 0, ECLIPSE_PENUMBRAL },
+    { 14046.604816907809, 14046.613956276811, 88.772254218638409, 0, 0, ECLIPSE_PENUMBRAL },
+    { 14075.992143493928, 14075.982646588029, 96.630031209206209, 0, 0, ECLIPSE_PENUMBRAL },
+    { 14224.229863834349, 14224.239196072687, 129.8056443996029, 0, 0, ECLIPSE_PENUMBRAL },
+    { 14401.283378871107, 14401.287207193578, 148.71571793511976, 90.033293376473011, 0, ECLIPSE_PARTIAL },
+    { 14578.201498223983, 14578.205426148821, 180.43318336713128, 103.4397836291464, 0, ECLIPSE_PARTIAL },
+    { 14755.991295518965, 14755.989946841877, 160.99061099637765, 105.65590526734013, 46.427812863694271, ECLIPSE_TOTAL },
+    { 14932.296266593987, 14932.294388411548, 177.11431966876262, 110.53549749223748, 44.253736842510989, ECLIPSE_TOTAL },
+    { 15110.536657914756, 15110.529390076481, 135.21816946551553, 30.221340945427073, 0, ECLIPSE_PARTIAL },
+    { 15286.697090293745, 15286.690359113269, 134.32797277884674, 45.747866273741238, 0, ECLIPSE_PARTIAL },
+    { 15435.094790308845, 15435.103859631923, 134.74799502437236, 0, 0, ECLIPSE_PENUMBRAL },
+    { 15611.940735957216, 15611.947870922359, 119.7006152200629, 6.161415377719095, 0, ECLIPSE_PARTIAL },
+    { 15789.101975394444, 15789.105114671842, 180.00350088390405, 107.71045642322861, 27.524855343945092, ECLIPSE_TOTAL },
+    { 15966.574646340559, 15966.577092114439, 163.21350141166477, 103.36595446264255, 36.392735146509949, ECLIPSE_TOTAL },
+    { 16143.32055106097, 16143.317857364014, 169.50179100429523, 104.84308753817459, 33.601818811730482, ECLIPSE_TOTAL },
+    { 16320.97561925582, 16320.97221304702, 172.3190939919732, 103.40380660301889, 17.639733979012817, ECLIPSE_TOTAL },
+    { 16497.828452899063, 16497.821136566941, 122.28922400419833, 0, 0, ECLIPSE_PENUMBRAL },
+    { 16675.088977136234, 16675.079211234257, 121.19390499021392, 0, 0, ECLIPSE_PENUMBRAL },
+    { 16823.035926780107, 16823.042939850351, 125.4427967252559, 26.678027175657917, 0, ECLIPSE_PARTIAL },
+    { 16999.538525181808, 16999.545283661999, 149.52391476428602, 58.103857310197782, 0, ECLIPSE_PARTIAL },
+    { 17177.556794173586, 17177.559327099494, 168.95857973140664, 104.79761099733878, 35.539431239012629, ECLIPSE_TOTAL },
+    { 17353.940413738412, 17353.940878087862, 167.05464766651858, 109.57591639860766, 50.739370154624339, ECLIPSE_TOTAL },
+    { 17531.78996725411, 17531.786899938037, 180.04531403799774, 107.45329681289149, 28.456540972692892, ECLIPSE_TOTAL },
+    { 17708.589198756647, 17708.584410584819, 143.15629377553705, 79.891077455249615, 0, ECLIPSE_PARTIAL },
+    { 17885.777583552848, 17885.768785716689, 141.15814715449233, 0, 0, ECLIPSE_PENUMBRAL },
+    { 18033.968104255557, 18033.976240531934, 112.65363509359304, 0, 0, ECLIPSE_PENUMBRAL },
+    { 18063.310475229719, 18063.300910334328, 66.411323859065305, 0, 0, ECLIPSE_PENUMBRAL },
+    { 18210.151583058188, 18210.16053427097, 113.58523344970308, 0, 0, ECLIPSE_PENUMBRAL },
+    { 18388.435004403658, 18388.438270531697, 170.38524771487573, 103.39220827416284, 22.574987866391893, ECLIPSE_TOTAL },
+    { 18564.636242053228, 18564.63944176893, 156.91357255243929, 96.795619229378644, 18.295894125185441, ECLIPSE_TOTAL },
+    { 18742.597011381415, 18742.594212535987, 182.72508153808303, 110.73584763013059, 35.172717618697789, ECLIPSE_TOTAL },
+    { 18919.301002186043, 18919.299192987906, 157.39727293490432, 102.42961677809944, 42.092006813327316, ECLIPSE_TOTAL },
+    { 19096.603928562159, 19096.595236669647, 138.3348904538434, 0, 0, ECLIPSE_PENUMBRAL },
+    { 19273.954862189439, 19273.947916543493, 128.6323810176691, 32.414998733438551, 0, ECLIPSE_PARTIAL },
+    { 19421.215276718358, 19421.222989797738, 126.04374831105815, 0, 0, ECLIPSE_PENUMBRAL },
+    { 19598.828650338619, 19598.83676793526, 139.36231365019921, 0, 0, ECLIPSE_PENUMBRAL },
+    { 19775.782643555325, 19775.784955137835, 157.71504965436179, 100.79004391474882, 36.579745307390112, ECLIPSE_TOTAL },
+    { 19952.890388529991, 19952.892722872002, 185.09462409390835, 113.64028992829844, 41.985982270853128, ECLIPSE_TOTAL },
+    { 20130.45054312106, 20130.448018368734, 156.72490674827714, 99.489100198843516, 33.325571247842163, ECLIPSE_TOTAL },
+    { 20306.956804041522, 20306.952954343757, 173.49644025263842, 102.01812032290036, 0, ECLIPSE_PARTIAL },
+    { 20485.025212377142, 20485.017410469511, 123.92098613345297, 0, 0, ECLIPSE_PENUMBRAL },
+    { 20631.908391042871, 20631.917937370996, 75.69142635242315, 0, 0, ECLIPSE_PENUMBRAL },
+    { 20661.288156037277, 20661.279247828264, 107.59179298969684, 0, 0, ECLIPSE_PENUMBRAL },
+    { 20809.565551254618, 20809.574992905, 128.83307963580592, 0, 0, ECLIPSE_PENUMBRAL },
+    { 20986.596425886219, 20986.600743030514, 145.63989816815592, 85.061355234647635, 0, ECLIPSE_PARTIAL },
+    { 21163.532470804246, 21163.536504071071, 179.78638470405713, 102.45677000581054, 0, ECLIPSE_PARTIAL },
+    { 21341.302589088169, 21341.301733764056, 162.1232869871892, 106.98344677628484, 48.957371067954227, ECLIPSE_TOTAL },
+    { 21517.637220631488, 21517.635470482488, 176.8235210646526, 110.65069969481556, 45.176674729445949, ECLIPSE_TOTAL },
+    { 21695.836303598004, 21695.829472473502, 141.20426127919927, 49.186248382029589, 0, ECLIPSE_PARTIAL },
+    { 21872.048393860856, 21872.041827878584, 135.56652944069356, 50.13618954049889, 0, ECLIPSE_PARTIAL },
+    { 22020.390480131777, 22020.399965320667, 128.03749558806885, 0, 0, ECLIPSE_PENUMBRAL },
+    { 22197.2788401406, 22197.286260105579, 116.13652595115127, 0, 0, ECLIPSE_PENUMBRAL },
+    { 22226.679000736505, 22226.668643777131, 23.134880775469355, 0, 0, ECLIPSE_PENUMBRAL },
+    { 22374.408228775894, 22374.411718728523, 177.89548898435896, 105.2247014149907, 16.381257078610361, ECLIPSE_TOTAL },
+    { 22551.897801519619, 22551.900622647732, 162.74054106557742, 101.58100139029557, 30.172449326491915, ECLIPSE_TOTAL },
+    { 22728.650002786966, 22728.647588274736, 169.48185701679904, 105.97062559652841, 37.698545269668102, ECLIPSE_TOTAL },
+    { 22906.275671294385, 22906.272707158834, 174.94264457694953, 106.53084608871723, 30.19583149405662, ECLIPSE_TOTAL },
+    { 23083.176779595127, 23083.169673913126, 124.23550255189184, 21.484480397484731, 0, ECLIPSE_PARTIAL },
+    { 23260.370292881311, 23260.361038324372, 130.56585402111523, 0, 0, ECLIPSE_PENUMBRAL },
+    { 23408.400943659908, 23408.408024842978, 124.95331999874907, 22.986892763874494, 0, ECLIPSE_PARTIAL },
+    { 23584.820019954142, 23584.82732978588, 142.60436385520734, 39.070607383036986, 0, ECLIPSE_PARTIAL },
+    { 23762.91236601413, 23762.914948933987, 169.43215414357837, 104.8447001259774, 34.914872552035376, ECLIPSE_TOTAL },
+    { 23939.240096594185, 23939.241121434963, 165.85768861026736, 108.46048272127518, 48.861312639783137, ECLIPSE_TOTAL },
+    { 24117.130427816366, 24117.127401043406, 180.69122631219216, 107.91127495496767, 29.447348652756773, ECLIPSE_TOTAL },
+    { 24293.899336054161, 24293.895069749346, 146.46186416968703, 85.956484540365636, 0, ECLIPSE_PARTIAL },
+    { 24471.112012893271, 24471.103285897567, 142.00226818153169, 0, 0, ECLIPSE_PENUMBRAL },
+    { 24619.279300305232, 24619.287924146611, 104.83573592151515, 0, 0, ECLIPSE_PENUMBRAL },
+    { 24648.619943561705, 24648.610785873527, 80.280946067359764, 0, 0, ECLIPSE_PENUMBRAL },
+    { 24795.493085865714, 24795.502105742082, 111.30425220733741, 0, 0, ECLIPSE_PENUMBRAL },
+    { 24973.732830822941, 24973.736631651525, 168.70984253240749, 99.919448104337789, 0, ECLIPSE_PARTIAL },
+    { 25149.986478255487, 25149.989823862816, 155.92241228499915, 95.475076853181235, 10.95324869529577, ECLIPSE_TOTAL },
+    { 25327.883118423932, 25327.880857428987, 184.39572870178381, 113.40659769019112, 42.498083021782804, ECLIPSE_TOTAL },
+    { 25504.649802213091, 25504.648190272714, 158.0240578003577, 103.10092615603935, 43.695967757084873, ECLIPSE_TOTAL },
+    { 25681.896986116401, 25681.888778960423, 143.78380554320756, 0, 0, ECLIPSE_PENUMBRAL },
+    { 25859.291150684236, 25859.284397476662, 131.91123497032095, 41.491687469242606, 0, ECLIPSE_PARTIAL },
+    { 26006.554249808454, 26006.562087235194, 123.07069576898357, 0, 0, ECLIPSE_PENUMBRAL },
+    { 26184.119186462271, 26184.127861237739, 133.10163667512825, 0, 0, ECLIPSE_PENUMBRAL },
+    { 26361.137377389663, 26361.139819620486, 156.92076358624035, 100.05985011637677, 34.767008273047395, ECLIPSE_TOTAL },
+    { 26538.166491390395, 26538.169458032116, 183.37116366892587, 110.55256513733184, 32.776465494534932, ECLIPSE_TOTAL },
+    { 26715.810133036703, 26715.807702901744, 157.20657075522467, 100.14423680200707, 34.90654469380388, ECLIPSE_TOTAL },
+    { 26892.240005010142, 26892.236782725406, 175.56203806016129, 106.10089574474841, 25.628656568296719, ECLIPSE_TOTAL },
+    { 27070.37883803415, 27070.371056410619, 125.05248479166767, 0, 0, ECLIPSE_PENUMBRAL },
+    { 27217.212031345665, 27217.22198111935, 59.202720318571664, 0, 0, ECLIPSE_PENUMBRAL },
+    { 27246.587617077825, 27246.5792727769, 116.4376659548725, 0, 0, ECLIPSE_PENUMBRAL },
+    { 27394.902565247357, 27394.912095800366, 128.05567527597304, 0, 0, ECLIPSE_PENUMBRAL },
+    { 27571.907481984388, 27571.912302690522, 142.06973562890198, 78.915142233890947, 0, ECLIPSE_PARTIAL },
+    { 27748.866823194072, 27748.870928129567, 179.22309003362898, 101.7204059715732, 0, ECLIPSE_PARTIAL },
+    { 27926.609966120923, 27926.609636078691, 162.99189691257197, 107.8433690345264, 50.383726914587896, ECLIPSE_TOTAL },
+    { 28102.98291107747, 28102.981247454696, 176.41540819517104, 110.61848460172769, 45.715688309865072, ECLIPSE_TOTAL },
+    { 28281.129992825361, 28281.123648434492, 147.13024619151838, 62.9912939722999, 0, ECLIPSE_PARTIAL },
+    { 28457.404943243415, 28457.398497705261, 136.3065123668639, 52.932849600620102, 0, ECLIPSE_PARTIAL },
+    { 28605.680323743229, 28605.690267079171, 119.71719876572024, 0, 0, ECLIPSE_PENUMBRAL },
+    { 28782.621584959783, 28782.629254245454, 112.89370714657707, 0, 0, ECLIPSE_PENUMBRAL },
+    { 28812.036676367185, 28812.026434249969, 33.865695810236502, 0, 0, ECLIPSE_PENUMBRAL },
+    { 28959.710610571583, 28959.714485301451, 175.42466424114536, 102.11987650691299, 0, ECLIPSE_PARTIAL },
+    { 29137.224993996057, 29137.228152015025, 162.25979241222376, 99.729980966658331, 22.113243394705933, ECLIPSE_TOTAL },
+    { 29313.975437564033, 29313.973339930377, 169.4694356439868, 107.09664798283484, 41.420573713257909, ECLIPSE_TOTAL },
+    { 29491.579456860934, 29491.576899788368, 177.17499835998751, 108.98983478313312, 37.253736158309039, ECLIPSE_TOTAL },
+    { 29668.520631145457, 29668.513771157155, 126.53050989814801, 34.310003725695424, 0, ECLIPSE_PARTIAL },
+    { 29845.657020197857, 29845.648237599893, 138.18492694816086, 0, 0, ECLIPSE_PENUMBRAL },
+    { 29993.761775353378, 29993.768957535125, 124.02027930569602, 15.420773277583066, 0, ECLIPSE_PARTIAL },
+    { 30170.106460521361, 30170.114272336716, 135.38147660612594, 0, 0, ECLIPSE_PENUMBRAL },
+    { 30348.264510761837, 30348.267170046638, 169.79833885532571, 104.76025415147888, 33.850829221482854, ECLIPSE_TOTAL },
+    { 30524.542481193206, 30524.544042164125, 164.33852689893683, 106.78185806551483, 45.617453012382612, ECLIPSE_TOTAL },
+    { 30702.468924959991, 30702.46595539472, 181.33102826017421, 108.45586287294282, 30.735943014733493, ECLIPSE_TOTAL },
+    { 30879.209723699405, 30879.205978952519, 149.34383467189036, 90.957143133273348, 0, ECLIPSE_PARTIAL },
+    { 31056.446420370725, 31056.437772019253, 142.78983636118937, 0, 0, ECLIPSE_PENUMBRAL },
+    { 31204.5849618512, 31204.594113275198, 94.900683909072541, 0, 0, ECLIPSE_PENUMBRAL },
+    { 31233.92713555511, 31233.918405523375, 92.06560108170379, 0, 0, ECLIPSE_PENUMBRAL },
+    { 31380.840446523052, 31380.849490146746, 109.78255996276857, 0, 0, ECLIPSE_PENUMBRAL },
+    { 31559.024502816043, 31559.028890145157, 166.39831766107818, 95.184612552111503, 0, ECLIPSE_PARTIAL },
+    { 31735.341972347851, 31735.345421867129, 155.1073889536201, 94.434470882406458, 0, ECLIPSE_PARTIAL },
+    { 31913.163611603486, 31913.161943290303, 185.81496839382453, 115.64326911466196, 47.873271438293159, ECLIPSE_TOTAL },
+    { 32090.003695622108, 32090.002237300596, 158.53390424366808, 103.57350033475086, 44.768917962501291, ECLIPSE_TOTAL },
+    { 32267.184437618158, 32267.176775853641, 149.27161505736876, 39.216106273233891, 0, ECLIPSE_PARTIAL },
+    { 32444.632349876945, 32444.625747873335, 134.58198211505078, 47.376087763987016, 0, ECLIPSE_PARTIAL },
+    { 32591.889095784984, 32591.897091133305, 119.43007181631401, 0, 0, ECLIPSE_PENUMBRAL },
+    { 32769.413782516138, 32769.422970630862, 126.65981391677633, 0, 0, ECLIPSE_PENUMBRAL },
+    { 32946.487716406329, 32946.490327101164, 155.97964757645968, 99.091915319440886, 32.110564741306007, ECLIPSE_TOTAL },
+    { 33123.44795187132, 33123.451496662616, 181.37290935090277, 106.95633487135638, 17.31467398814857, ECLIPSE_TOTAL },
+    { 33301.166078835944, 33301.163770158026, 157.77530025166925, 100.92418358428404, 36.738025329541415, ECLIPSE_TOTAL },
+    { 33477.527672710115, 33477.525041048008, 177.02201883599628, 109.07953686837573, 36.833350168308243, ECLIPSE_TOTAL },
+    { 33655.728995410711, 33655.721255435405, 126.4774587872671, 0, 0, ECLIPSE_PENUMBRAL },
+    { 33802.516949651799, 33802.527291011196, 35.324994474649429, 0, 0, ECLIPSE_PENUMBRAL },
+    { 33831.890724643221, 33831.882919750809, 123.70200099481735, 0, 0, ECLIPSE_PENUMBRAL },
+    { 33980.238790578078, 33980.248410552616, 127.14994409645442, 0, 0, ECLIPSE_PENUMBRAL },
+    { 34157.218094527794, 34157.223421191578, 138.03969562402926, 71.421200442127883, 0, ECLIPSE_PARTIAL },
+    { 34334.202587257205, 34334.206750306206, 178.6375976371346, 101.07815513794776, 0, ECLIPSE_PARTIAL },
+    { 34511.91597946141, 34511.916184087058, 163.55004957353231, 108.15722231345717, 50.611541644320823, ECLIPSE_TOTAL },
+    { 34688.330769053769, 34688.329176733561, 175.93297132174484, 110.53533229278401, 46.122962245135568, ECLIPSE_TOTAL },
+    { 34866.42088328622, 34866.415049744661, 152.66779656987637, 73.860500389127992, 0, ECLIPSE_PARTIAL },
+    { 35042.764934597399, 35042.758581713751, 136.74450777936727, 54.882983383722603, 0, ECLIPSE_PARTIAL },
+    { 35190.96330804324, 35190.973760119508, 109.0809351898497, 0, 0, ECLIPSE_PENUMBRAL },
+    { 35220.624286056285, 35220.611957794448, 13.866404254222289, 0, 0, ECLIPSE_PENUMBRAL },
+    { 35367.969764540714, 35367.977641791709, 110.16504317522049, 0, 0, ECLIPSE_PENUMBRAL },
+    { 35397.398847202727, 35397.38868362768, 39.670656777452677, 0, 0, ECLIPSE_PENUMBRAL },
+    { 35545.006579460329, 35545.010897355867, 172.38428123295307, 98.010132929775864, 0, ECLIPSE_PARTIAL },
+    { 35722.557822932693, 35722.561264348529, 161.88457635173108, 98.007084426353686, 9.9583704146789387, ECLIPSE_TOTAL },
+    { 35899.294861153103, 35899.293137633431, 169.46485779422801, 108.21358036017045, 44.847671257448383, ECLIPSE_TOTAL },
+    { 36076.889231592431, 36076.887024156393, 179.01475668302737, 110.82002503273543, 41.696558247786015, ECLIPSE_TOTAL },
+    { 36253.859386413256, 36253.852812503166, 129.18198456172831, 44.619262489140965, 0, ECLIPSE_PARTIAL },
+    { 36430.948596037233, 36430.940249513056, 144.49681721278466, 0, 0, ECLIPSE_PENUMBRAL },
+    { 36579.119415125118, 36579.126721511471, 122.74850691785105, 0, 0, ECLIPSE_PENUMBRAL },
+    { 36755.395987352473, 36755.4042705381, 127.65594316239003, 0, 0, ECLIPSE_PENUMBRAL },
+    { 36933.613360975047, 36933.616120940984, 170.05024808866438, 104.54167236050125, 32.300980652798899, ECLIPSE_TOTAL },
+    { 37109.847033201593, 37109.849112119882, 162.52308781666216, 104.56046083127148, 40.802153455442749, ECLIPSE_TOTAL },
+    { 37287.805402925995, 37287.802507591827, 181.95535358972847, 109.0799866989255, 32.276082633761689, ECLIPSE_TOTAL },
+    { 37464.521415755575, 37464.518182696178, 151.78829112381209, 95.005003876285627, 16.284742439165711, ECLIPSE_TOTAL },
+    { 37641.780194187115, 37641.771636916703, 143.60631914692931, 0, 0, ECLIPSE_PENUMBRAL },
+    { 37789.888487957425, 37789.898175323855, 82.67493016901426, 0, 0, ECLIPSE_PENUMBRAL },
+    { 37819.234538756129, 37819.226237558898, 102.02439202694222, 0, 0, ECLIPSE_PENUMBRAL },
+    { 37966.191396274298, 37966.200438443215, 108.68701158848125, 0, 0, ECLIPSE_PENUMBRAL },
+    { 38144.311500859985, 38144.31651096198, 163.37763452203944, 88.927660101908259, 0, ECLIPSE_PARTIAL },
+    { 38320.701488939092, 38320.705011463688, 154.43628212960903, 93.624435901874676, 0, ECLIPSE_PARTIAL },
+    { 38498.439363669604, 38498.438334216575, 186.87341982673388, 117.28479347366374, 51.494022121187299, ECLIPSE_TOTAL },
+    { 38675.361703715986, 38675.360364023902, 158.96027320472058, 103.91987727081869, 45.504346495145001, ECLIPSE_TOTAL },
+    { 38852.468002589703, 38852.460929794164, 154.53080545412377, 57.70593382534571, 0, ECLIPSE_PARTIAL },
+    { 39029.97818158882, 39029.971691755869, 136.71420689031947, 51.347877190564759, 0, ECLIPSE_PARTIAL },
+    { 39177.218883515372, 39177.227077772528, 114.91525355027989, 0, 0, ECLIPSE_PENUMBRAL },
+    { 39206.697170229098, 39206.685536420016, 13.174532430712134, 0, 0, ECLIPSE_PENUMBRAL },
+    { 39354.712823583257, 39354.722476627525, 120.16632504179142, 0, 0, ECLIPSE_PENUMBRAL },
+    { 39531.832777439064, 39531.835602035986, 154.8376829753397, 97.787497197277844, 28.057708766427822, ECLIPSE_TOTAL },
+    { 39708.734929526297, 39708.738996899963, 179.20537478174083, 102.99347929889336, 0, ECLIPSE_PARTIAL },
+    { 39886.515522541384, 39886.513389351931, 158.49305256851949, 101.92841448413674, 39.048929334967397, ECLIPSE_TOTAL },
+    { 40062.821496540491, 40062.819401430628, 177.9518824419938, 111.11104658106342, 43.170773852616549, ECLIPSE_TOTAL },
+    { 40241.073109843186, 40241.065456119912, 128.48455738567282, 0, 0, ECLIPSE_PENUMBRAL },
+    { 40417.198610442523, 40417.191309492177, 129.61429089365993, 25.934612203272991, 0, ECLIPSE_PARTIAL },
+    { 40565.573652233004, 40565.58336654539, 126.02562643995043, 0, 0, ECLIPSE_PENUMBRAL },
+    { 40742.528872308598, 40742.534702196906, 133.54167029145174, 62.17679804074578, 0, ECLIPSE_PARTIAL },
+    { 40919.539848875138, 40919.544055532511, 178.05133836984169, 100.54846878745593, 0, ECLIPSE_PARTIAL },
+    { 41097.219059833456, 41097.219824696193, 163.76501976745203, 107.88037653837819, 49.549938979907893, ECLIPSE_TOTAL },
+    { 41273.68193001367, 41273.680381307349, 175.37112920370419, 110.37618446338456, 46.332663522334769, ECLIPSE_TOTAL },
+    { 41451.708182434602, 41451.702892868816, 157.86746773228515, 82.979492650483735, 0, ECLIPSE_PARTIAL },
+    { 41628.127979245444, 41628.121693589834, 136.91828242270276, 56.164354661596008, 0, ECLIPSE_PARTIAL },
+    { 41776.242012550669, 41776.252999136916, 95.781564851640724, 0, 0, ECLIPSE_PENUMBRAL },
+    { 41805.89647349892, 41805.884665690144, 59.397428602678701, 0, 0, ECLIPSE_PENUMBRAL },
+    { 41953.32264460752, 41953.330694475793, 107.93337510258425, 0, 0, ECLIPSE_PENUMBRAL },
+    { 41982.764271985645, 41982.754159674572, 43.191728002857417, 0, 0, ECLIPSE_PENUMBRAL },
+    { 42130.299464075099, 42130.304250487134, 168.85618904780131, 92.936949311988428, 0, ECLIPSE_PARTIAL },
+    { 42307.894343311127, 42307.898033148093, 161.58533494861331, 96.373546569957398, 0, ECLIPSE_PARTIAL },
+    { 42484.610914367368, 42484.609595701048, 169.35615830880124, 109.13377109274734, 47.607160801417194, ECLIPSE_TOTAL },
+    { 42662.203463788952, 42662.201562424816, 180.57511558989063, 112.22234329674393, 44.743025490897708, ECLIPSE_TOTAL },
+    { 42839.192671598488, 42839.186427352681, 132.14820303430315, 53.804696142906323, 0, ECLIPSE_PARTIAL },
+    { 43016.246701184893, 43016.238737216969, 149.54750210512429, 25.231935378396884, 0, ECLIPSE_PARTIAL },
+    { 43164.47144169236, 43164.4789169387, 120.82595731539186, 0, 0, ECLIPSE_PENUMBRAL },
+    { 43340.691404608981, 43340.700105680167, 119.80698580155149, 0, 0, ECLIPSE_PENUMBRAL },
+    { 43518.956626801868, 43518.9595338285, 170.11926636623684, 104.04586691467557, 29.690039597335272, ECLIPSE_TOTAL },
+    { 43695.155987068545, 43695.158545147919, 160.49998359172605, 101.92810307547916, 34.247408474329859, ECLIPSE_TOTAL },
+    { 43873.137391231779, 43873.134611018824, 182.64512102119625, 109.90443547256291, 34.417772206943482, ECLIPSE_TOTAL },
+    { 44049.834582292278, 44049.831849755479, 153.83902663306799, 98.247776486095972, 30.031070545082912, ECLIPSE_TOTAL },
+    { 44227.111960525246, 44227.103519505239, 144.59652472345624, 0, 0, ECLIPSE_PENUMBRAL },
+    { 44375.18863885208, 44375.198881799472, 66.437392617808655, 0, 0, ECLIPSE_PENUMBRAL },
+    { 44404.541965360717, 44404.534095443531, 110.71315690933261, 0, 0, ECLIPSE_PENUMBRAL },
+    { 44551.545482546273, 44551.554500734339, 107.94896302744746, 0, 0, ECLIPSE_PENUMBRAL },
+    { 44729.594473269899, 44729.600136104891, 159.56956097565126, 80.686653998563997, 0, ECLIPSE_PARTIAL },
+    { 44906.065114625897, 44906.068677229014, 153.92066519125365, 93.083163393312134, 0, ECLIPSE_PARTIAL },
+    { 45083.710683331592, 45083.710335584292, 187.48237233725376, 118.20609595568385, 53.383833434781991, ECLIPSE_TOTAL },
+    { 45260.723757663953, 45260.722501176373, 159.32340065133758, 104.16364467178937, 45.971875040559098, ECLIPSE_TOTAL },
+    { 45437.747577752409, 45437.741139591904, 159.4852665590588, 71.29590667958837, 0, ECLIPSE_PARTIAL },
+    { 45615.328366141533, 45615.321950630881, 138.38182141073048, 53.937348975450732, 0, ECLIPSE_PARTIAL },
+    { 45762.543569691406, 45762.552002330216, 109.35417400149163, 0, 0, ECLIPSE_PENUMBRAL },
+    { 45791.998982216654, 45791.987867384843, 51.019335624296218, 0, 0, ECLIPSE_PENUMBRAL },
+    { 45940.017332003008, 45940.027392708333, 113.91958844207693, 0, 0, ECLIPSE_PENUMBRAL },
+    { 46117.173277103859, 46117.176353458148, 153.48708386183716, 96.115886023035273, 21.768436040729284, ECLIPSE_TOTAL },
+    { 46294.027422840685, 46294.031957196792, 176.94572249427438, 98.798090061172843, 0, ECLIPSE_PARTIAL },
+    { 46471.860466713144, 46471.858543257105, 159.28210892889183, 103.00990799150895, 41.415271300356835, ECLIPSE_TOTAL },
+    { 46648.121202806557, 46648.119593385803, 178.44779244682286, 112.42095873691142, 47.089565314818174, ECLIPSE_TOTAL },
+    { 46826.411885132373, 46826.404356050283, 130.95091651543044, 0, 0, ECLIPSE_PENUMBRAL },
+    { 47002.511329611356, 47002.504496878246, 134.44700497551821, 45.410950992372818, 0, ECLIPSE_PARTIAL },
+    { 47150.9058362875, 47150.915661701925, 124.46996776910964, 0, 0, ECLIPSE_PENUMBRAL },
+    { 47327.841190199557, 47327.847508946652, 128.66257768822834, 50.56331770028919, 0, ECLIPSE_PARTIAL },
+    { 47504.875229369391, 47504.879497955451, 177.29139697970822, 99.843533966923133, 0, ECLIPSE_PARTIAL },
+    { 47682.522872931833, 47682.524188789786, 163.64458570140414, 107.0158340362832, 47.134153906954452, ECLIPSE_TOTAL },
+    { 47859.033429446237, 47859.031925692121, 174.7712381958263, 110.22493215103168, 46.556598219322041, ECLIPSE_TOTAL },
+    { 48036.993565873388, 48036.988839192192, 162.59914478170685, 90.585653522866778, 0, ECLIPSE_PARTIAL },
+    { 48213.492462230817, 48213.486232392439, 136.97221974958666, 57.17368838028051, 0, ECLIPSE_PARTIAL },
+    { 48361.515443796139, 48361.526997535351, 78.035582339507528, 0, 0, ECLIPSE_PENUMBRAL },
+    { 48391.165151599482, 48391.153905003463, 82.933940673829056, 0, 0, ECLIPSE_PENUMBRAL },
+    { 48538.68004317108, 48538.688231488988, 106.25111242581625, 0, 0, ECLIPSE_PENUMBRAL },
+    { 48568.132061170698, 48568.121978890966, 45.316043446655385, 0, 0, ECLIPSE_PENUMBRAL },
+    { 48715.586506360269, 48715.591812108119, 164.57841306226328, 86.283900280832313, 0, ECLIPSE_PARTIAL },
+    { 48893.236355009554, 48893.240239979685, 161.47602236364037, 95.052408955525607, 0, ECLIPSE_PARTIAL },
+    { 49069.922027606161, 49069.92115970001, 169.11680472374428, 109.81118209543638, 49.700665553100407, ECLIPSE_TOTAL },
+    { 49247.522602450415, 49247.520958278867, 181.89070693566464, 113.27445550414268, 46.818803591304459, ECLIPSE_TOTAL },
+    { 49424.521324854308, 49424.515446169215, 135.26765646412969, 62.043685141252354, 0, ECLIPSE_PARTIAL },
+    { 49601.550642809249, 49601.543012647286, 153.62256494758185, 42.158888226840645, 0, ECLIPSE_PARTIAL },
+    { 49749.818505616349, 49749.826187670966, 118.27254543663003, 0, 0, ECLIPSE_PENUMBRAL },
+    { 49779.221656576214, 49779.21142510674, 27.889825553284027, 0, 0, ECLIPSE_PENUMBRAL },
+    { 49925.991448719433, 49926.000527983779, 111.72236498328857, 0, 0, ECLIPSE_PENUMBRAL },
+    { 50104.295150100232, 50104.298241449425, 170.00359954428859, 103.28156636911444, 25.755942497053184, ECLIPSE_TOTAL },
+    { 50280.468992651557, 50280.471995745291, 158.31857163459063, 98.941074045142159, 24.951819974812679, ECLIPSE_TOTAL },
+    { 50458.464885880312, 50458.462261354616, 183.38549596897792, 110.89357958058827, 36.971817097510211, ECLIPSE_TOTAL },
+    { 50635.151086636331, 50635.148826065386, 155.47784435504582, 100.72428716404829, 37.446207613684237, ECLIPSE_TOTAL },
+    { 50812.441587476707, 50812.43328770798, 145.77587344567291, 0, 0, ECLIPSE_PENUMBRAL },
+    { 50960.487488613777, 50960.498287762763, 42.523774935398251, 0, 0, ECLIPSE_PENUMBRAL },
+    { 50989.85031780853, 50989.842874482172, 118.29661433352157, 0, 0, ECLIPSE_PENUMBRAL },
+    { 51136.901261945692, 51136.910246234322, 107.35322577646002, 0, 0, ECLIPSE_PENUMBRAL },
+    { 51314.874841949277, 51314.881172569862, 154.92488288960885, 69.8193764698226, 0, ECLIPSE_PARTIAL },
+    { 51491.430623435328, 51491.434213340348, 153.46399379312061, 92.65800453023985, 0, ECLIPSE_PARTIAL },
+    { 51668.979086792686, 51668.979447970298, 187.5641633203486, 118.2790338259656, 53.411132963374257, ECLIPSE_TOTAL },
+    { 51846.088495613942, 51846.08729908595, 159.6422225155402, 104.35755834623706, 46.293549240217544, ECLIPSE_TOTAL },
+    { 52023.025373785989, 52023.019593608857, 163.92628384928685, 81.918486945214681, 0, ECLIPSE_PARTIAL },
+    { 52200.681147402771, 52200.67478378096, 139.75938906718511, 55.782990242005326, 0, ECLIPSE_PARTIAL },
+    { 52347.863929282423, 52347.872632601669, 102.6608308305731, 0, 0, ECLIPSE_PENUMBRAL },
+    { 52377.29849819692, 52377.28792850305, 70.83994380896911, 0, 0, ECLIPSE_PENUMBRAL },
+    { 52525.327220821157, 52525.337631716662, 108.0584505898878, 0, 0, ECLIPSE_PENUMBRAL },
+    { 52702.507576700948, 52702.510957930986, 151.80935991753358, 93.869658092153259, 7.4612562695983797, ECLIPSE_TOTAL },
+    { 52879.326815713954, 52879.331748215205, 174.76378888939507, 94.647632471169345, 0, ECLIPSE_PARTIAL },
+    { 53057.198501292733, 53057.196845412989, 160.16425706329755, 104.20431957521942, 43.915294840699062, ECLIPSE_TOTAL },
+    { 53233.428404217178, 53233.427213489696, 178.59348232916091, 113.14432933344506, 49.412056201254018, ECLIPSE_TOTAL },
+    { 53411.74331888905, 53411.735971743932, 134.05712305975612, 25.029302764451131, 0, ECLIPSE_PARTIAL },
+    { 53587.830451499642, 53587.824036167265, 138.26141879777424, 56.602723425021395, 0, ECLIPSE_PARTIAL },
+    { 53736.234945333708, 53736.244901340382, 122.39240563823842, 0, 0, ECLIPSE_PENUMBRAL },
+    { 53913.154425996763, 53913.161225745665, 123.30535159329884, 34.08242728037294, 0, ECLIPSE_PARTIAL },
+    { 53942.473407996717, 53942.462972950569, 16.739530942286365, 0, 0, ECLIPSE_PENUMBRAL },
+    { 54090.210266912072, 54090.214600350635, 176.44457658170722, 99.09375919145532, 0, ECLIPSE_PARTIAL },
+    { 54267.825718844593, 54267.827593844617, 163.16714249609504, 105.51970157248434, 43.064743825234473, ECLIPSE_TOTAL },
+    { 54444.385166552092, 54444.383709089423, 174.14012041816022, 110.08442924183328, 46.795196474413387, ECLIPSE_TOTAL },
+    { 54622.277305206699, 54622.273158950884, 166.85967070574407, 96.959781650220975, 0, ECLIPSE_PARTIAL },
+    { 54798.857939730857, 54798.851757364762, 136.93633938382845, 57.998413767199963, 0, ECLIPSE_PARTIAL },
+    { 54946.786512724917, 54946.798639504217, 52.538509845617227, 0, 0, ECLIPSE_PENUMBRAL },
+    { 54976.433299814118, 54976.422631628768, 100.42447904474102, 0, 0, ECLIPSE_PENUMBRAL },
+    { 55124.040229489503, 55124.048536436676, 104.90820306411479, 0, 0, ECLIPSE_PENUMBRAL },
+    { 55153.500660216429, 55153.490598227399, 46.885078120976686, 0, 0, ECLIPSE_PENUMBRAL },
+    { 55300.872111264434, 55300.877944827917, 159.72144429339096, 78.099107322050259, 0, ECLIPSE_PARTIAL },
+    { 55478.581558250073, 55478.585606853994, 161.48340104206, 93.930832810001448, 0, ECLIPSE_PARTIAL },
+    { 55655.229667594736, 55655.229282245113, 168.66686101304367, 110.12215103313792, 50.928250917932019, ECLIPSE_TOTAL },
+    { 55832.846461032095, 55832.845026347466, 183.00717351492494, 114.06186625594273, 48.228697618469596, ECLIPSE_TOTAL },
+    { 56009.845442851169, 56009.839965649284, 138.46803033782635, 69.531550495885313, 0, ECLIPSE_PARTIAL },
+    { 56186.860881750028, 56186.853531444889, 156.80931159120519, 51.857640710659325, 0, ECLIPSE_PARTIAL },
+    { 56335.158841493292, 56335.166784528046, 114.76750299800187, 0, 0, ECLIPSE_PENUMBRAL },
+    { 56364.551278955121, 56364.541318207426, 47.375257041421719, 0, 0, ECLIPSE_PENUMBRAL },
+    { 56511.298890732207, 56511.308287496162, 103.92884597007651, 0, 0, ECLIPSE_PENUMBRAL },
+    { 56540.901624379403, 56540.889507739092, 29.379666068125516, 0, 0, ECLIPSE_PENUMBRAL },
+    { 56689.627027640752, 56689.630359617353, 169.61678541032597, 102.06932717934251, 18.800544896512292, ECLIPSE_TOTAL },
+    { 56865.786888271876, 56865.790295934879, 156.05944556824397, 95.719099556445144, 6.564091463224031, ECLIPSE_TOTAL },
+    { 57043.786579156935, 57043.784164017394, 184.19462082674727, 112.06898840493523, 39.929091592202894, ECLIPSE_TOTAL },
+    { 57220.470840718532, 57220.469025209131, 156.78145797166508, 102.58157885691617, 42.253278032876551, ECLIPSE_TOTAL },
+    { 57397.766074023828, 57397.757969334685, 147.45639553642832, 8.5735904239118099, 0, ECLIPSE_PARTIAL },
+    { 57575.160807756161, 57575.153775705643, 124.88089759193826, 23.405231770011596, 0, ECLIPSE_PARTIAL },
+    { 57722.258120626735, 57722.267065460284, 106.78530375065748, 0, 0, ECLIPSE_PENUMBRAL },
+    { 57900.153238373154, 57900.160246574167, 149.37033622758463, 54.763539660489187, 0, ECLIPSE_PARTIAL },
+    { 58076.797795423692, 58076.801401272445, 153.05983572034165, 92.340196205768734, 0, ECLIPSE_PARTIAL },
+    { 58254.245439981692, 58254.246528787262, 187.0603535551345, 117.42081112170126, 51.382902439800091, ECLIPSE_TOTAL },
+    { 58431.455915819439, 58431.454755376384, 159.92472142330371, 104.50574479415081, 46.485009583993815, ECLIPSE_TOTAL },
+    { 58608.300141424719, 58608.295055911134, 167.91728227457497, 90.689933188841678, 0, ECLIPSE_PARTIAL },
+    { 58786.037643837175, 58786.031299052083, 140.75682310271077, 56.708661440061405, 0, ECLIPSE_PARTIAL },
+    { 58933.180246391028, 58933.189249272997, 94.549281959189102, 0, 0, ECLIPSE_PENUMBRAL },
+    { 58962.59567491772, 58962.585678842872, 86.077984501607716, 0, 0, ECLIPSE_PENUMBRAL },
+    { 59110.642527004391, 59110.653231718024, 102.75593826372642, 0, 0, ECLIPSE_PENUMBRAL },
+    { 59287.837734294932, 59287.84145430557, 149.83200109738391, 91.050454287906177, 0, ECLIPSE_PARTIAL },
+    { 59464.63274693954, 59464.638013408286, 172.71276185230818, 90.67839331983123, 0, ECLIPSE_PARTIAL },
+    { 59642.531932158934, 59642.530580483872, 161.04660386452451, 105.35390163946431, 46.182663351064548, ECLIPSE_TOTAL },
+    { 59818.741446907603, 59818.740625856706, 178.48977830610238, 113.47233346779831, 50.767998337978497, ECLIPSE_TOTAL },
+    { 59997.069064192598, 59997.061943525492, 137.55106442724355, 38.224001200287603, 0, ECLIPSE_PARTIAL },
+    { 60173.155302922554, 60173.149261688704, 141.31114539108239, 64.411906376481056, 0, ECLIPSE_PARTIAL },
+    { 60321.558419349312, 60321.568549955104, 119.29538104974199, 0, 0, ECLIPSE_PENUMBRAL },
+    { 60498.471047263905, 60498.478299813796, 117.70870738837402, 0, 0, ECLIPSE_PENUMBRAL },
+    { 60527.801548387193, 60527.791431580474, 44.136568356771022, 0, 0, ECLIPSE_PENUMBRAL },
+    { 60675.54157002407, 60675.546005252894, 175.32307014218532, 97.971074418746866, 0, ECLIPSE_PARTIAL },
+    { 60853.130591500267, 60853.13300630595, 162.39411037007812, 103.47448769432958, 37.109268291969784, ECLIPSE_TOTAL },
+    { 61029.734731851553, 61029.733346548375, 173.51562433352228, 110.01213676237967, 47.191677740192972, ECLIPSE_TOTAL },
+    { 61207.561529635772, 61207.557962989296, 170.56706225092057, 102.14633517083712, 9.8200240381993353, ECLIPSE_TOTAL },
+    { 61384.222644068708, 61384.216517730005, 136.96984905400313, 59.02536160487216, 0, ECLIPSE_PARTIAL },
+    { 61561.699869542274, 61561.689807540817, 114.86836420430336, 0, 0, ECLIPSE_PENUMBRAL },
+    { 61709.404004671356, 61709.412402909671, 104.05933578440454, 0, 0, ECLIPSE_PENUMBRAL },
+    { 61738.869931292946, 61738.859881179116, 47.976353115518577, 0, 0, ECLIPSE_PENUMBRAL },
+    { 61886.154361754154, 61886.16075021866, 154.03504937770776, 67.367726867669262, 0, ECLIPSE_PARTIAL },
+    { 62063.930754597779, 62063.934927323564, 161.65595253522042, 93.1290244840784, 0, ECLIPSE_PARTIAL },
+    { 62240.534318607548, 62240.534444109988, 167.95516837213654, 109.9785552645335, 51.156384372152388, ECLIPSE_TOTAL },
+    { 62418.175405553688, 62418.17412905737, 183.94806987431366, 114.6388092788402, 49.144837361527607, ECLIPSE_TOTAL },
+    { 62595.165561684866, 62595.160518759803, 141.64535066171084, 76.308461927692406, 0, ECLIPSE_PARTIAL },
+    { 62772.176842122331, 62772.169722393919, 159.29211524489801, 58.396596218808554, 0, ECLIPSE_PARTIAL },
+    { 62920.493990462812, 62920.50223458805, 110.35305661847815, 0, 0, ECLIPSE_PENUMBRAL },
+    { 62949.876011808061, 62949.866352097371, 61.946366541087627, 0, 0, ECLIPSE_PENUMBRAL },
+    { 63096.612441003046, 63096.622109316595, 96.351755203795619, 0, 0, ECLIPSE_PENUMBRAL },
+    { 63126.222505905782, 63126.210674703208, 48.396826049429365, 0, 0, ECLIPSE_PENUMBRAL },
+    { 63274.952398662921, 63274.956026430969, 168.90530233795289, 100.31364694645163, 0, ECLIPSE_PARTIAL },
+    { 63451.1104195035, 63451.11418630241, 153.8187053531874, 92.404257095768116, 0, ECLIPSE_PARTIAL },
+    { 63629.102916697411, 63629.100760598289, 185.02886631642468, 113.34217616356909, 42.998669177759439, ECLIPSE_TOTAL },
+    { 63805.794568096491, 63805.793164663075, 157.78692778490949, 103.9154959609732, 45.429660463705659, ECLIPSE_TOTAL },
+    { 63983.087070835849, 63983.079198172767, 149.42426331806928, 28.595783060300164, 0, ECLIPSE_PARTIAL },
+    { 64160.474145780179, 64160.467503676475, 130.57896008016542, 42.893843734636903, 0, ECLIPSE_PARTIAL },
+    { 64307.614435824027, 64307.623349652393, 105.9914978739107, 0, 0, ECLIPSE_PENUMBRAL },
+    { 64485.430573796722, 64485.43826021834, 142.83961417386308, 29.955463992082514, 0, ECLIPSE_PARTIAL },
+    { 64662.165122627055, 64662.168746214411, 152.63960821903311, 92.022740214597434, 0, ECLIPSE_PARTIAL },
+    { 64839.511759428737, 64839.513573886565, 185.96324343583547, 115.5934074986726, 46.997157750301994, ECLIPSE_TOTAL },
+    { 65016.82352938017, 65016.82240400061, 160.20164061861578, 104.67030382831581, 46.682118675671518, ECLIPSE_TOTAL },
+    { 65193.575715475876, 65193.57132275054, 171.22480919351801, 97.606060661491938, 0, ECLIPSE_PARTIAL },
+    { 65371.395478900929, 65371.389140560153, 141.58495277864859, 57.292833529645577, 0, ECLIPSE_PARTIAL },
+    { 65518.492733350722, 65518.502062085077, 84.580119026941247, 0, 0, ECLIPSE_PENUMBRAL },
+    { 65547.891347553988, 65547.881945948859, 98.632511420873925, 0, 0, ECLIPSE_PENUMBRAL },
+    { 65695.9628410601, 65695.973786171817, 98.108803782379255, 0, 0, ECLIPSE_PENUMBRAL },
+    { 65873.162453743294, 65873.166558194906, 147.41506721125916, 87.38724946975708, 0, ECLIPSE_PARTIAL },
+    { 66049.945746709229, 66049.951277980028, 170.90996256214567, 87.133728750050068, 0, ECLIPSE_PARTIAL },
+    { 66227.857946665215, 66227.856963305909, 161.92880422342569, 106.45041560637765, 48.225294848671183, ECLIPSE_TOTAL },
+    { 66404.062491224351, 66404.061968857059, 178.19554215646349, 113.49520860356279, 51.413155237678438, ECLIPSE_TOTAL },
+    { 66582.387497381933, 66582.38066347313, 141.52289326186292, 49.503676097374409, 0, ECLIPSE_PARTIAL },
+    { 66758.486167424955, 66758.48045340809, 143.69925483944826, 70.096670393832028, 0, ECLIPSE_PARTIAL },
+    { 66906.877326567715, 66906.887663937159, 115.26431515230797, 0, 0, ECLIPSE_PENUMBRAL },
+    { 67083.790320386062, 67083.798004376105, 111.79739348357543, 0, 0, ECLIPSE_PENUMBRAL },
+    { 67113.134259307626, 67113.124430709649, 58.341482172254473, 0, 0, ECLIPSE_PENUMBRAL },
+    { 67260.870047803037, 67260.874611516454, 173.97091251332313, 96.537200175225735, 0, ECLIPSE_PARTIAL },
+    { 67438.436191968387, 67438.43913976349, 161.32055779919028, 100.83786998293363, 28.059335541911423, ECLIPSE_TOTAL },
+    { 67615.082865112927, 67615.08156864511, 172.88377372082323, 109.97931335004978, 47.668489809148014, ECLIPSE_TOTAL },
+    { 67792.846609323373, 67792.843617355364, 173.75077019794844, 106.31417204509489, 30.078014064347371, ECLIPSE_TOTAL },
+    { 67969.585790294164, 67969.579733735663, 137.12590790586546, 60.345273963175714, 0, ECLIPSE_PARTIAL },
+    { 68146.96851499271, 68146.959054580831, 126.66272773873061, 0, 0, ECLIPSE_PENUMBRAL },
+    { 68294.76938708665, 68294.777864468866, 103.44230512040667, 0, 0, ECLIPSE_PENUMBRAL },
+    { 68324.238438489148, 68324.228401498476, 49.142591902054846, 0, 0, ECLIPSE_PENUMBRAL },
+    { 68471.435999122245, 68471.442942698108, 147.62173530296423, 53.111613375367597, 0, ECLIPSE_PARTIAL },
+    { 68649.282036213452, 68649.28631030058, 161.92488608183339, 92.525267056189477, 0, ECLIPSE_PARTIAL },
+    { 68825.837116598414, 68825.837769808422, 166.93303555017337, 109.30949329747818, 50.245129413669929, ECLIPSE_TOTAL },
+    { 69003.5075953263, 69003.50644245946, 184.7592602216173, 115.09187186951749, 49.78353486279957, ECLIPSE_TOTAL },
+    { 69180.482030706116, 69180.477451922212, 144.72292582970113, 82.386785672279075, 0, ECLIPSE_PARTIAL },
+    { 69357.49843043182, 69357.491491743349, 161.12993452465162, 62.910917610861361, 0, ECLIPSE_PARTIAL },
+    { 69505.822631022122, 69505.831227639996, 104.64285990572535, 0, 0, ECLIPSE_PENUMBRAL },
+    { 69535.196090860307, 69535.186761510122, 74.402876804815605, 0, 0, ECLIPSE_PENUMBRAL },
+    { 69681.932695316602, 69681.94258562426, 89.270378295332193, 0, 0, ECLIPSE_PENUMBRAL },
+    { 69711.549260490981, 69711.537671851154, 59.452920625917614, 0, 0, ECLIPSE_PENUMBRAL },
+    { 69860.270716901883, 69860.274700471433, 167.79237850103527, 97.834707973524928, 0, ECLIPSE_PARTIAL },
+    { 70036.439830004776, 70036.443908916874, 151.67456065770239, 89.130045182537287, 0, ECLIPSE_PARTIAL },
+    { 70214.411502473464, 70214.409678333061, 185.89364068815485, 114.71891762106679, 46.177871626568958, ECLIPSE_TOTAL },
+    { 70391.123035870201, 70391.122003920929, 158.54995457455516, 104.81140723801218, 47.452488101553172, ECLIPSE_TOTAL },
+    { 70568.401979246279, 70568.394399810888, 151.88034086488187, 41.692025314550847, 0, ECLIPSE_PARTIAL },
+    { 70745.791259279882, 70745.784976332317, 135.46516048489138, 54.436610714765266, 0, ECLIPSE_PARTIAL },
+    { 70892.969041086501, 70892.97794081246, 104.78609474957921, 0, 0, ECLIPSE_PENUMBRAL },
+    { 71070.708469774807, 71070.716819655427, 135.37980286055245, 0, 0, ECLIPSE_PENUMBRAL },
+    { 71247.532486650118, 71247.536129179498, 152.20930362702347, 91.709915151586756, 0, ECLIPSE_PARTIAL },
+    { 71424.777002300398, 71424.779549996951, 184.22689080820419, 112.70455790567212, 39.342404727358371, ECLIPSE_TOTAL },
+    { 71602.192159849787, 71602.191058570723, 160.46320725814439, 104.82647553202696, 46.833069595741108, ECLIPSE_TOTAL },
+    { 71778.85046136922, 71778.846775330385, 173.95570589695126, 103.17764556384645, 0, ECLIPSE_PARTIAL },
+    { 71956.754487355181, 71956.7481429748, 142.24964670022018, 57.551491915946826, 0, ECLIPSE_PARTIAL },
+    { 72103.802207693603, 72103.811880471447, 72.096887344960123, 0, 0, ECLIPSE_PENUMBRAL },
+    { 72133.186520372125, 72133.177725279238, 109.21122961677611, 0, 0, ECLIPSE_PENUMBRAL },
+    { 72281.287978638895, 72281.299112672757, 94.252676098840311, 0, 0, ECLIPSE_PENUMBRAL },
+    { 72458.484092345097, 72458.488604146856, 144.60866817855276, 82.880378620466217, 0, ECLIPSE_PARTIAL },
+    { 72635.263527632633, 72635.269277244035, 169.2601311870385, 83.881191835971549, 0, ECLIPSE_PARTIAL },
+    { 72813.180021812208, 72813.179437481653, 162.69413403002545, 107.31587576447055, 49.690423265565187, ECLIPSE_TOTAL },
+    { 72989.38940567465, 72989.389132552198, 177.77645658468828, 113.33708121324889, 51.653109490871429, ECLIPSE_TOTAL }
+};
+
+static const solar_eclipse_record_t SolarEclipseTable[] =
+{
+    { -109523.51804629645, -109523.50723258621, 8578.8892986080009, NAN, NAN, ECLIPSE_PARTIAL },
+    { -109346.800407096, -109346.79246177769, 7433.6085354164388, NAN, NAN, ECLIPSE_PARTIAL },
+    { -109317.46690706022, -109317.47630808329, 8777.8145908234546, NAN, NAN, ECLIPSE_PARTIAL },
+    { -109169.54372897261, -109169.53825377767, 4248.5448590240603, 25.855409271492988, -171.68855375543359, ECLIPSE_ANNULAR },
+    { -108992.10634801578, -108992.1030779358, 2898.8698454178184, -9.3493974453726878, 33.711598714398605, ECLIPSE_TOTAL },
+    { -108815.43217393248, -108815.43255526639, 310.16079607391418, -21.236300829418905, 159.5720004288637, ECLIPSE_ANNULAR },
+    { -108637.5956362561, -108637.59806320007, 2023.3298629303888, 38.435670664287954, -140.381077380557, ECLIPSE_TOTAL },
+    { -108461.01938357657, -108461.0247318742, 4684.5963546223302, -67.943442013685953, 22.151178315336779, ECLIPSE_TOTAL },
+    { -108283.3823876479, -108283.39132944807, 7155.2139811253346, NAN, NAN, ECLIPSE_PARTIAL },
+    { -108135.85533501983, -108135.84628301491, 8349.6869994306362, NAN, NAN, ECLIPSE_PARTIAL },
+    { -108106.39715479725, -108106.40646941744, 8717.1282924933766, NAN, NAN, ECLIPSE_PARTIAL },
+    { -107958.96414049057, -107958.95655391215, 6093.8983196352165, -49.011388129318398, 3.2719457925498432, ECLIPSE_ANNULAR },
+    { -107781.27320404215, -107781.26818586186, 4287.0061417581446, 19.695354309254501, 104.94450283266224, ECLIPSE_ANNULAR },
+    { -107604.67133396599, -107604.67018435257, 968.29670759011924, 12.195562265182465, -117.03386224888874, ECLIPSE_TOTAL },
+    { -107426.9420544415, -107426.94226824834, 169.3487319439991, -20.373334067809989, -25.039181109851029, ECLIPSE_ANNULAR },
+    { -107250.09638755652, -107250.10066987964, 3820.4138363194543, 51.550730544121009, 15.178184221078068, ECLIPSE_TOTAL },
+    { -107072.8938212746, -107072.89999021462, 4720.8452666678568, -56.982626019178987, -72.608792954460455, ECLIPSE_ANNULAR },
+    { -106924.75035816684, -106924.74142775648, 8073.4106965503061, NAN, NAN, ECLIPSE_PARTIAL },
+    { -106895.38817349644, -106895.39709222423, 8324.7192412311651, NAN, NAN, ECLIPSE_PARTIAL },
+    { -106748.54924941517, -106748.53818025604, 9344.7926078574928, NAN, NAN, ECLIPSE_PARTIAL },
+    { -106718.89329675316, -106718.90461406714, 9026.7136776061016, NAN, NAN, ECLIPSE_PARTIAL },
+    { -106570.21869181542, -106570.21417477279, 3747.2910825385779, -30.41435720277553, 98.245710631694863, ECLIPSE_ANNULAR },
+    { -106394.12972118816, -106394.12483460132, 4269.8835495695457, 39.217647927451736, 68.382660930565578, ECLIPSE_TOTAL },
+    { -106215.98587804189, -106215.98703077411, 892.20272528722921, 3.4092638795548176, -5.965084624264648, ECLIPSE_ANNULAR },
+    { -106039.47706829858, -106039.47757783928, 456.26426611274513, 3.7743517359384864, 169.72818697986708, ECLIPSE_TOTAL },
+    { -105861.98769756634, -105861.99479381676, 5429.9542709388552, 42.544512477467251, -31.252718508291025, ECLIPSE_ANNULAR },
+    { -105684.77410844795, -105684.77979697626, 5117.5571354203239, -36.42325362045387, -105.01337991375613, ECLIPSE_TOTAL },
+    { -105537.57714629172, -105537.5669679023, 8794.8119639105444, NAN, NAN, ECLIPSE_PARTIAL },
+    { -105507.9255581748, -105507.93733484432, 9620.1778480870526, NAN, NAN, ECLIPSE_PARTIAL },
+    { -105359.70142099306, -105359.69292618305, 6952.1350721790941, NAN, NAN, ECLIPSE_PARTIAL },
+    { -105183.08895471619, -105183.08436274886, 4081.0987386526062, -60.599658492688995, 49.149737294373381, ECLIPSE_TOTAL },
+    { -105005.56188056199, -105005.55903082415, 2193.4423880663676, 42.837215849851624, -152.7717494844029, ECLIPSE_ANNULAR },
+    { -104828.44084155784, -104828.44109311317, 225.13408713335849, -21.443965477525765, 159.01077837742847, ECLIPSE_TOTAL },
+    { -104651.52733623094, -104651.53078209113, 2685.8290522962043, -1.3099159337591428, -171.20278741300081, ECLIPSE_ANNULAR },
+    { -104473.82508447704, -104473.83035250143, 4627.9524096965079, 23.191770204948352, -64.811768668618697, ECLIPSE_TOTAL },
+    { -104326.73296850827, -104326.72257172354, 9476.6552196472894, NAN, NAN, ECLIPSE_PARTIAL },
+    { -104297.29680303689, -104297.30558602484, 7402.0928003040599, NAN, NAN, ECLIPSE_PARTIAL },
+    { -104149.13336978554, -104149.1218112198, 9324.3743643439229, NAN, NAN, ECLIPSE_PARTIAL },
+    { -104119.42838856499, -104119.4394843959, 9426.9207290875347, NAN, NAN, ECLIPSE_PARTIAL },
+    { -103972.10465965924, -103972.09969483677, 4536.293628497041, 59.387560214118977, 17.879313841730927, ECLIPSE_TOTAL },
+    { -103795.12955430131, -103795.12301369596, 5054.9033177090605, -62.353500874820256, 15.60076937057454, ECLIPSE_ANNULAR },
+    { -103617.39682999725, -103617.39689466216, 58.099243539377333, 11.765680265640016, 142.60797342968729, ECLIPSE_TOTAL },
+    { -103441.07857844517, -103441.07804134888, 428.90978331335356, -12.432226975518436, 23.459688264276906, ECLIPSE_ANNULAR },
+    { -103262.80363964995, -103262.80926915741, 4885.968623074793, -39.511542533024574, -52.16945567686335, ECLIPSE_TOTAL },
+    { -103086.7393193012, -103086.74419164548, 4194.8789216439372, 34.739044627999462, -81.10598289183929, ECLIPSE_TOTAL },
+    { -102938.19738803954, -102938.18636074872, 8752.1328024311388, NAN, NAN, ECLIPSE_PARTIAL },
+    { -102908.48949859079, -102908.50138279449, 9953.587265381253, NAN, NAN, ECLIPSE_PARTIAL },
+    { -102761.47947143755, -102761.47113410557, 7816.4495104075068, NAN, NAN, ECLIPSE_PARTIAL },
+    { -102732.13384468843, -102732.14294225785, 8479.9298253155648, NAN, NAN, ECLIPSE_PARTIAL },
+    { -102584.21884239683, -102584.21322761117, 4372.3171614051389, 30.527072673135141, 68.562854439819773, ECLIPSE_ANNULAR },
+    { -102406.79563012798, -102406.79185722985, 3335.9450077975471, -16.68566242072826, -81.10557824348956, ECLIPSE_TOTAL },
+    { -102230.08823848068, -102230.08853149087, 239.48240502128363, -17.39226043599065, 36.042730405132772, ECLIPSE_ANNULAR },
+    { -102052.30494297488, -102052.30680643771, 1544.5484425331886, 31.212898475262904, 114.78789680219828, ECLIPSE_ANNULAR },
+    { -101875.65784962692, -101875.66312314414, 4636.6718853359389, -64.049879097099591, -102.38506898740292, ECLIPSE_TOTAL },
+    { -101698.11190013317, -101698.12023445693, 6629.7041722865006, NAN, NAN, ECLIPSE_PARTIAL },
+    { -101550.48708493209, -101550.47799013056, 8385.2923913825125, NAN, NAN, ECLIPSE_PARTIAL },
+    { -101521.02754755843, -101521.03682153186, 8692.8984474698645, NAN, NAN, ECLIPSE_PARTIAL },
+    { -101373.68848617659, -101373.68033448349, 6604.7940724796208, NAN, NAN, ECLIPSE_PARTIAL },
+    { -101195.91652300024, -101195.91142487823, 4344.1776232827769, 19.525501608404504, -25.451115340154274, ECLIPSE_ANNULAR },
+    { -101019.37311377906, -101019.37142718946, 1430.6018437463731, 9.6710765814121995, 136.08368409341062, ECLIPSE_TOTAL },
+    { -100841.60522144024, -100841.60531942858, 77.378425421943334, -21.99511747388453, -145.26888912564408, ECLIPSE_ANNULAR },
+    { -100664.78088687034, -100664.78468412923, 3397.3611944843301, 50.878466598283516, -92.961529028403362, ECLIPSE_TOTAL },
+    { -100487.57196788816, -100487.57795588771, 4577.6346571930444, -59.822113662379863, 175.00531418973401, ECLIPSE_ANNULAR },
+    { -100339.41808910252, -100339.40883574232, 8372.9649759562908, NAN, NAN, ECLIPSE_PARTIAL },
+    { -100310.06632092092, -100310.07486566526, 7958.7948648887432, NAN, NAN, ECLIPSE_PARTIAL },
+    { -100163.23376215053, -100163.22247775056, 9591.6377670687198, NAN, NAN, ECLIPSE_PARTIAL },
+    { -100133.57027929298, -100133.5813395984, 8836.1884172202117, NAN, NAN, ECLIPSE_PARTIAL },
+    { -99984.894939113772, -99984.890079555655, 4023.9557788187612, -29.164844848247121, -18.395467126636266, ECLIPSE_ANNULAR },
+    { -99808.802683814327, -99808.797494900384, 4554.9253797405936, 38.063634796268737, -48.910021770870799, ECLIPSE_TOTAL },
+    { -99630.674178828995, -99630.675004416786, 637.99139011237037, 5.7078568161510406, -118.03625964698389, ECLIPSE_ANNULAR },
+    { -99454.147543334097, -99454.147681655071, 123.89878468542582, 2.2591131983247044, 51.440198694566902, ECLIPSE_TOTAL },
+    { -99276.674460604758, -99276.681269508306, 5216.3232936465156, 42.856505194695742, -144.72251641879927, ECLIPSE_ANNULAR },
+    { -99099.453525944395, -99099.458840775391, 4758.2803079085506, -34.989181007794762, 139.63453104962477, ECLIPSE_TOTAL },
+    { -98952.226342775597, -98952.21617599274, 8821.7951517139536, NAN, NAN, ECLIPSE_PARTIAL },
+    { -98922.594670516191, -98922.606206619384, 9454.7068138931645, NAN, NAN, ECLIPSE_PARTIAL },
+    { -98774.418405239296, -98774.409247536445, 7477.2556256935522, NAN, NAN, ECLIPSE_PARTIAL },
+    { -98744.913460345211, -98744.924635497024, 9837.6100645781244, NAN, NAN, ECLIPSE_PARTIAL },
+    { -98597.723236422302, -98597.718627152834, 4103.0971051414726, -57.745339090510811, -77.500388259339488, ECLIPSE_TOTAL },
+    { -98420.29584763106, -98420.292254451313, 2762.4796015461889, 46.367659152235987, 115.92351308846074, ECLIPSE_ANNULAR },
+    { -98243.070816212246, -98243.071044040727, 203.61186219409697, -20.638903350432447, 26.935266636314793, ECLIPSE_TOTAL },
+    { -98066.256630869495, -98066.259358611453, 2128.5491492086471, 3.804810738683527, 90.707116786665992, ECLIPSE_ANNULAR },
+    { -97888.462189742932, -97888.467467944763, 4617.471430959009, 22.788841399939766, 162.1251683961255, ECLIPSE_TOTAL },
+    { -97712.006569402016, -97712.014732183641, 6885.8292808983615, NAN, NAN, ECLIPSE_PARTIAL },
+    { -97563.804165637717, -97563.79239800325, 9458.3986699220459, NAN, NAN, ECLIPSE_PARTIAL },
+    { -97534.081228056733, -97534.092373747058, 9414.1557892005676, NAN, NAN, ECLIPSE_PARTIAL },
+    { -97386.78423560581, -97386.778865274537, 4918.9186489928898, 67.856359659047584, -99.497926820126438, ECLIPSE_TOTAL },
+    { -97209.812088229664, -97209.805321250984, 5227.2933048497616, -68.888814467621117, -101.06864029627422, ECLIPSE_ANNULAR },
+    { -97032.072621950123, -97032.072286632741, 300.51263328450551, 18.417182713312805, 24.584381566948537, ECLIPSE_TOTAL },
+    { -96855.755285226885, -96855.754502132462, 626.58231238272447, -18.142313762062553, -93.795624951657089, ECLIPSE_ANNULAR },
+    { -96677.486632754561, -96677.491929445707, 4569.1605459655329, -32.155730669774329, -171.06031568368934, ECLIPSE_TOTAL },
+    { -96501.404771705653, -96501.409368792563, 3963.5829404198898, 28.3387053218784, 155.19682695989246, ECLIPSE_TOTAL },
+    { -96352.882130151964, -96352.870847749582, 8961.3692957794701, NAN, NAN, ECLIPSE_PARTIAL },
+    { -96323.184111362629, -96323.195739012241, 9672.8442681851957, NAN, NAN, ECLIPSE_PARTIAL },
+    { -96176.154366534785, -96176.145666490207, 8168.111379430994, NAN, NAN, ECLIPSE_PARTIAL },
+    { -96146.795709993603, -96146.804541509147, 8217.7266478251531, NAN, NAN, ECLIPSE_PARTIAL },
+    { -95998.897889128973, -95998.892096923257, 4527.2436300594827, 35.953647122418353, -50.17724334662848, ECLIPSE_ANNULAR },
+    { -95821.481997977986, -95821.477748452366, 3746.3526018684929, -24.296188482813861, 162.50566124949137, ECLIPSE_TOTAL },
+    { -95644.74805831023, -95644.748223041242, 135.28722083119612, -12.755512944956903, -86.722398331968265, ECLIPSE_ANNULAR },
+    { -95467.012411514399, -95467.013728230479, 1084.9738420553497, 23.758676079258311, 8.4076331995189548, ECLIPSE_ANNULAR },
+    { -95290.299515964725, -95290.304685261173, 4561.0287351910747, -59.211077902235139, 130.92525391849392, ECLIPSE_TOTAL },
+    { -95112.838794141135, -95112.846536342477, 6123.829242690038, 79.89442172669078, 44.40949979959737, ECLIPSE_ANNULAR },
+    { -94965.118846571509, -94965.109706126008, 8422.1776833603526, NAN, NAN, ECLIPSE_PARTIAL },
+    { -94935.660954087012, -94935.670168379613, 8646.5275596721804, NAN, NAN, ECLIPSE_PARTIAL },
+    { -94788.412222310086, -94788.403519369909, 7113.3030589105265, NAN, NAN, ECLIPSE_PARTIAL },
+    { -94610.558403643809, -94610.553241835441, 4387.1054825870278, 19.882917406920335, -156.46444620842587, ECLIPSE_ANNULAR },
+    { -94434.076731204215, -94434.074491567124, 1913.0267029353638, 6.0294066146754561, 29.374904001730151, ECLIPSE_TOTAL },
+    { -94256.265177021472, -94256.265194531821, 13.789810859889625, -23.027816100313366, 93.544568823353586, ECLIPSE_ANNULAR },
+    { -94079.469010455316, -94079.472290402395, 2942.0933854466971, 48.998848479100232, 160.15666478125354, ECLIPSE_TOTAL },
+    { -93902.244772186925, -93902.250627914473, 4474.1251657584044, -62.583576843117662, 62.17432812640584, ECLIPSE_ANNULAR },
+    { -93754.09285175761, -93754.083222715606, 8723.5794128647394, NAN, NAN, ECLIPSE_PARTIAL },
+    { -93724.749574562986, -93724.757707206649, 7554.6692408545332, NAN, NAN, ECLIPSE_PARTIAL },
+    { -93577.910262251185, -93577.898824630043, 9784.6869085274939, NAN, NAN, ECLIPSE_PARTIAL },
+    { -93548.24019960947, -93548.251056872978, 8693.0018753863897, NAN, NAN, ECLIPSE_PARTIAL },
+    { -93399.577882076657, -93399.572625089204, 4346.0333974955583, -29.011133910492106, -132.70953919106597, ECLIPSE_ANNULAR },
+    { -93223.469786508664, -93223.464341752129, 4800.7097334054697, 37.06993051748475, -169.07922731561129, ECLIPSE_TOTAL },
+    { -93045.368017511733, -93045.368465267689, 345.59744914419247, 7.7068731596717717, 132.06807134708248, ECLIPSE_ANNULAR },
+    { -92868.813475081144, -92868.813279423935, 175.31796776324387, 0.3240722102760622, -68.588811502589806, ECLIPSE_TOTAL },
+    { -92691.366501502242, -92691.372966641604, 4960.8825016624878, 43.505310639587911, 104.5868172823111, ECLIPSE_ANNULAR },
+    { -92514.12933198153, -92514.134301187922, 4428.4695754510321, -34.89114566494036, 23.030312811722126, ECLIPSE_TOTAL },
+    { -92366.877318640327, -92366.867149265498, 8866.5266025753081, NAN, NAN, ECLIPSE_PARTIAL },
+    { -92337.267781044226, -92337.279033209939, 9254.4383092461267, NAN, NAN, ECLIPSE_PARTIAL },
+    { -92189.133819798066, -92189.124023043012, 7983.2969193870376, NAN, NAN, ECLIPSE_PARTIAL },
+    { -92159.608584249698, -92159.619460102607, 9487.5501621387521, NAN, NAN, ECLIPSE_PARTIAL },
+    { -92012.359395280146, -92012.354750242666, 4143.1318164022077, -54.340310365167355, 154.76480481139447, ECLIPSE_TOTAL },
+    { -91835.027142191771, -91835.022835555079, 3309.1162276724071, 48.733375691283371, 24.491148318419505, ECLIPSE_ANNULAR },
+    { -91657.701988101297, -91657.702181613378, 172.73885777991538, -19.03385255798861, -104.89942854461705, ECLIPSE_TOTAL },
+    { -91480.984499623723, -91480.986516326026, 1576.3774463800296, 7.8619005915417244, -7.2260992876640984, ECLIPSE_ANNULAR },
+    { -91303.099741700426, -91303.105028364036, 4606.7274702137411, 23.044885618831152, 29.245849692913964, ECLIPSE_TOTAL },
+    { -91126.715500503356, -91126.723039708348, 6367.4216390353358, NAN, NAN, ECLIPSE_PARTIAL },
+    { -90978.471447893666, -90978.45950838452, 9563.3286311415595, NAN, NAN, ECLIPSE_PARTIAL },
+    { -90948.734040501309, -90948.745234688889, 9404.5691636112115, NAN, NAN, ECLIPSE_PARTIAL },
+    { -90801.467464815403, -90801.461658224784, 5331.7709072101597, 77.003687338781191, 144.68111130832139, ECLIPSE_TOTAL },
+    { -90624.48878361666, -90624.481846626135, 5357.117260986598, -74.790754531311308, 142.95981936733978, ECLIPSE_ANNULAR },
+    { -90446.753266732005, -90446.752489519262, 694.64777802098672, 24.93444301739752, -91.17453695014288, ECLIPSE_TOTAL },
+    { -90270.425774221236, -90270.42479813422, 782.58659171793738, -23.132821858329134, 147.37164835603474, ECLIPSE_ANNULAR },
+    { -90092.175884141645, -90092.180795454376, 4209.4986874228989, -24.846035030443542, 72.943615858464625, ECLIPSE_TOTAL },
+    { -89916.063702452462, -89916.068077282558, 3777.208630609482, 22.76183127387521, 29.661338689362651, ECLIPSE_TOTAL },
+    { -89767.574741493896, -89767.563142484549, 9224.7705399237166, NAN, NAN, ECLIPSE_PARTIAL },
+    { -89737.887297356006, -89737.898596640633, 9331.7279613345909, NAN, NAN, ECLIPSE_PARTIAL },
+    { -89590.82458456108, -89590.815553705936, 8484.7026148439672, NAN, NAN, ECLIPSE_PARTIAL },
+    { -89561.451308663352, -89561.459922574897, 8001.8630339403371, NAN, NAN, ECLIPSE_PARTIAL },
+    { -89413.582664030269, -89413.576640957646, 4727.0042018801068, 42.23027663901324, -167.46772480775294, ECLIPSE_ANNULAR },
+    { -89236.164635445355, -89236.159942455415, 4123.5262728499947, -32.038493424003775, 44.327000401332214, ECLIPSE_TOTAL },
+    { -89059.411670634872, -89059.411667772307, 2.3712552892201169, -7.4847483645323614, 151.36456288910773, ECLIPSE_ANNULAR },
+    { -88881.717040481148, -88881.717837006072, 652.45135876021038, 16.224763329886262, -99.567239852675868, ECLIPSE_ANNULAR },
+    { -88704.943441779644, -88704.948487857633, 4466.6107030629173, -53.856977068829124, 2.8817381803501121, ECLIPSE_TOTAL },
+    { -88527.56459025394, -88527.571742228698, 5625.9776716110737, 71.727530445645627, -113.12457728782647, ECLIPSE_ANNULAR },
+    { -88379.749727371032, -88379.740547095949, 8451.2500097309276, NAN, NAN, ECLIPSE_PARTIAL },
+    { -88350.295880472186, -88350.30503022956, 8591.9287419933225, NAN, NAN, ECLIPSE_PARTIAL },
+    { -88203.135804428937, -88203.126560480334, 7623.1117328951295, NAN, NAN, ECLIPSE_PARTIAL },
+    { -88025.199536274929, -88025.194321308911, 4420.4283619118751, 20.812465386999964, 72.167072960018572, ECLIPSE_ANNULAR },
+    { -87848.779930864403, -87848.777143571759, 2397.1511986366527, 1.4344264143473264, -78.102200289808408, ECLIPSE_TOTAL },
+    { -87670.923527416438, -87670.923484478873, 33.722526067361159, -23.285169339489652, -28.104336232876904, ECLIPSE_ANNULAR },
+    { -87494.157538133484, -87494.160298991323, 2482.1417880939312, 46.049788349924867, 52.672434052640533, ECLIPSE_TOTAL },
+    { -87316.915178177514, -87316.920922069403, 4387.9485552446586, -64.670244442713837, -49.446558255380239, ECLIPSE_ANNULAR },
+    { -87168.771755708673, -87168.761724209529, 9100.4186052078221, NAN, NAN, ECLIPSE_PARTIAL },
+    { -87139.43497792368, -87139.442684329071, 7136.8662802554381, NAN, NAN, ECLIPSE_PARTIAL },
+    { -86962.90562803112, -86962.916313565962, 8578.0281883457355, NAN, NAN, ECLIPSE_PARTIAL },
+    { -86814.268074105115, -86814.262359647968, 4717.5030788953072, -30.291196796405238, 115.55466202617362, ECLIPSE_ANNULAR },
+    { -86638.13026722167, -86638.12461929534, 5000.5492489299286, 36.235641088629563, 67.590560228028494, ECLIPSE_TOTAL },
+    { -86460.06970866723, -86460.069704703026, 3.056938856846048, 9.0608236406838856, 25.242305593923902, ECLIPSE_ANNULAR },
+    { -86283.473400751478, -86283.472922858025, 428.35695447776573, -1.9532866679611824, 169.10086790413976, ECLIPSE_TOTAL },
+    { -86106.06522414081, -86106.071276016868, 4652.5788843902747, 44.277629463580084, -2.6656816550036524, ECLIPSE_ANNULAR },
+    { -85928.7997092484, -85928.804378670407, 4143.617535537659, -35.958465487070683, -95.488426592919524, ECLIPSE_TOTAL },
+    { -85781.531963287896, -85781.521762393488, 8943.2233616016783, NAN, NAN, ECLIPSE_PARTIAL },
+    { -85751.94615497136, -85751.957069433789, 9009.4235051342057, NAN, NAN, ECLIPSE_PARTIAL },
+    { -85603.847866465207, -85603.837452593318, 8472.3430658353082, NAN, NAN, ECLIPSE_PARTIAL },
+    { -85574.300089141252, -85574.310686853918, 9166.7996987547267, NAN, NAN, ECLIPSE_PARTIAL },
+    { -85426.997991510434, -85426.993288434212, 4204.7743678794068, -50.708142203475653, 26.487371258063433, ECLIPSE_TOTAL },
+    { -85249.757050372325, -85249.752047893446, 3843.7333361873648, 50.199456966996408, -67.013796908397211, ECLIPSE_ANNULAR },
+    { -85072.335328024201, -85072.335468720936, 125.47538079419081, -16.783989962871892, 123.7851279721649, ECLIPSE_TOTAL },
+    { -84895.709861864321, -84895.711186298606, 1037.5197620425672, 10.823342683585022, -105.53331410057312, ECLIPSE_ANNULAR },
+    { -84717.738143614173, -84717.743434298987, 4593.5131774736892, 23.925282917580134, -103.31635911925083, ECLIPSE_TOTAL },
+    { -84541.422976698668, -84541.429894894012, 5851.6551683427897, -43.006768776864156, 137.35028138267123, ECLIPSE_TOTAL },
+    { -84393.135853029482, -84393.12377415935, 9644.0180259671524, NAN, NAN, ECLIPSE_PARTIAL },
+    { -84363.386848261754, -84363.398089811555, 9398.4965680727892, NAN, NAN, ECLIPSE_PARTIAL },
+    { -84216.153106176454, -84216.146844425573, 5764.4185046257953, 87.290772011063339, 26.067955076702617, ECLIPSE_TOTAL },
+    { -84039.160628055921, -84039.153567715068, 5452.0625767047723, -79.843377407466988, 32.130151303782441, ECLIPSE_ANNULAR },
+    { -83861.438609534627, -83861.437349361557, 1123.1354110222348, 31.208879669684567, 155.49230220014044, ECLIPSE_TOTAL },
+    { -83685.090011330016, -83685.08889563597, 896.3805256814386, -27.231699952591477, 27.042807485352796, ECLIPSE_ANNULAR },
+    { -83506.870462637409, -83506.874942441762, 3814.3047936727417, -17.769626497292748, -40.477428447283451, ECLIPSE_TOTAL },
+    { -83330.717289059656, -83330.721483459842, 3626.525888027697, 17.982669174736838, -97.385854040120876, ECLIPSE_TOTAL },
+    { -83182.273061871674, -83182.261105070284, 9525.8943608404788, NAN, NAN, ECLIPSE_PARTIAL },
+    { -83152.595480815653, -83152.606405691331, 8956.3935257562116, NAN, NAN, ECLIPSE_PARTIAL },
+    { -83005.489754746974, -83005.48042767396, 8763.6032358264347, NAN, NAN, ECLIPSE_PARTIAL },
+    { -82976.101805611077, -82976.110240294976, 7823.0475699301924, NAN, NAN, ECLIPSE_PARTIAL },
+    { -82828.272174808022, -82828.265877301528, 4964.0784678826176, 49.233786674844396, 76.132277576144475, ECLIPSE_ANNULAR },
+    { -82650.843761482203, -82650.838655731743, 4469.797292969668, -39.860841055282485, -75.548938079394276, ECLIPSE_TOTAL },
+    { -82474.079861291058, -82474.079644505386, 179.76375568403881, -1.6731223927778431, 30.678552748444417, ECLIPSE_ANNULAR },
+    { -82296.417943100416, -82296.41825467028, 253.70972325670365, 8.7416316499014997, 150.80255538097956, ECLIPSE_ANNULAR },
+    { -82119.592758788116, -82119.597633668731, 4327.3996309425256, -47.912734434611338, -124.83691933325177, ECLIPSE_TOTAL },
+    { -81942.285246560976, -81942.29184854732, 5166.7370505405734, 61.367893409368826, 132.08130428880185, ECLIPSE_ANNULAR },
+    { -81794.382575458614, -81794.373338155099, 8495.1583040980313, NAN, NAN, ECLIPSE_PARTIAL },
+    { -81764.935310198562, -81764.94436665086, 8504.9790507536127, NAN, NAN, ECLIPSE_PARTIAL },
+    { -81617.85728374825, -81617.847524490673, 8119.6419211480152, NAN, NAN, ECLIPSE_PARTIAL },
+    { -81588.263540000771, -81588.275676985329, 9801.9530004291973, NAN, NAN, ECLIPSE_PARTIAL },
+    { -81439.841639142658, -81439.836366097035, 4457.4062903044496, 22.455373116578794, -58.957900340026185, ECLIPSE_ANNULAR },
+    { -81263.482890281855, -81263.479558232968, 2884.8091812338362, -4.1054246359355844, 173.630476463756, ECLIPSE_TOTAL },
+    { -81085.580908979959, -81085.580819824347, 69.852659606646711, -22.693913268278006, -150.12269020003725, ECLIPSE_ANNULAR },
+    { -80908.848509585499, -80908.850729051584, 1999.2842893194506, 41.855548596043597, -55.069848038895316, ECLIPSE_TOTAL },
+    { -80731.581813171477, -80731.587479732189, 4329.7704889624247, -65.831772683023289, -160.72903034845461, ECLIPSE_ANNULAR },
+    { -80583.456564351654, -80583.446088651835, 9517.9086786391326, NAN, NAN, ECLIPSE_PARTIAL },
+    { -80554.123709187566, -80554.130964000535, 6694.8128623994262, NAN, NAN, ECLIPSE_PARTIAL },
+    { -80377.56650918728, -80377.577056549548, 8492.2150497320581, NAN, NAN, ECLIPSE_PARTIAL },
+    { -80228.964035092547, -80228.957818039795, 5126.0137306642882, -33.250775065392546, 5.8199442634625171, ECLIPSE_ANNULAR },
+    { -80052.784660319725, -80052.778856249526, 5158.6479890217151, 35.611895150321786, -58.621252422809221, ECLIPSE_TOTAL },
+    { -79874.777178462551, -79874.776670044783, 391.82790356812541, 9.7035967167762625, -79.341594288715683, ECLIPSE_ANNULAR },
+    { -79698.128488393413, -79698.127768561957, 645.37933338384903, -4.3126840762493428, 45.001175711867518, ECLIPSE_TOTAL },
+    { -79520.768745448964, -79520.774333536436, 4305.5426545723103, 45.145381563734475, -107.28767405989458, ECLIPSE_ANNULAR },
+    { -79343.465520752681, -79343.469929160041, 3896.2872241010937, -37.832167566039097, 144.55393104739693, ECLIPSE_TOTAL },
+    { -79196.19047475062, -79196.180212243635, 9052.9858619291244, NAN, NAN, ECLIPSE_PARTIAL },
+    { -79166.629294358572, -79166.639823333768, 8723.2306831660571, NAN, NAN, ECLIPSE_PARTIAL },
+    { -79018.558108423254, -79018.547121805241, 8926.0725143213567, NAN, NAN, ECLIPSE_PARTIAL },
+    { -78988.986641805343, -78988.996994731395, 8885.6989366053858, NAN, NAN, ECLIPSE_PARTIAL },
+    { -78841.63981783179, -78841.635028001401, 4293.8886629255239, -47.148494190101971, -101.63253295021553, ECLIPSE_TOTAL },
+    { -78664.483437061761, -78664.477778229295, 4350.4291821519755, 50.914357692218246, -159.87674151288255, ECLIPSE_ANNULAR },
+    { -78486.971689205166, -78486.97175155516, 55.561798347562998, -14.064717299331843, -6.7123064506221795, ECLIPSE_TOTAL },
+    { -78310.431655183231, -78310.432317139013, 519.9537847872889, 12.700077998867458, 155.22359734300812, ECLIPSE_ANNULAR },
+    { -78132.37981517725, -78132.385083939633, 4558.630696218951, 25.174052367001963, 125.38153324740165, ECLIPSE_TOTAL },
+    { -77956.127996465977, -77956.134306088308, 5346.3778467134607, -34.621253868025406, 30.774128307361337, ECLIPSE_TOTAL },
+    { -77807.798602154769, -77807.786406938016, 9709.7891749722239, NAN, NAN, ECLIPSE_PARTIAL },
+    { -77778.041946227953, -77778.05321498643, 9378.7492985215522, NAN, NAN, ECLIPSE_PARTIAL },
+    { -77630.840492249816, -77630.833762255992, 6211.5841183600141, 78.652149041227176, 104.77512052264547, ECLIPSE_TOTAL },
+    { -77601.539310600638, -77601.549819067659, 9762.8191660066932, NAN, NAN, ECLIPSE_PARTIAL },
+    { -77453.829479796259, -77453.822325574598, 5526.5443964515771, -83.306462774214609, -62.840109653429352, ECLIPSE_ANNULAR },
+    { -77276.127108608358, -77276.125338555314, 1573.03920002619, 37.016485763618348, 44.288459464892554, ECLIPSE_TOTAL },
+    { -77099.749130627271, -77099.747917621426, 976.77941496625749, -30.337835682751631, -94.398677707862987, ECLIPSE_ANNULAR },
+    { -76921.570997253322, -76921.574991593487, 3378.0114889089682, -10.960774092964268, -151.11388738627284, ECLIPSE_TOTAL },
+    { -76745.364967376096, -76745.369028990506, 3516.8738639404528, 14.141267891093776, 133.83605778015075, ECLIPSE_TOTAL },
+    { -76596.978746759996, -76596.966378916011, 9877.0224936906743, NAN, NAN, ECLIPSE_PARTIAL },
+    { -76567.310718268156, -76567.321202195249, 8530.5848692440013, NAN, NAN, ECLIPSE_PARTIAL },
+    { -76420.149325494611, -76420.139740347397, 9000.7483582056248, NAN, NAN, ECLIPSE_PARTIAL },
+    { -76390.746467007732, -76390.754767510603, 7688.0008482479188, NAN, NAN, ECLIPSE_PARTIAL },
+    { -76242.968185311183, -76242.961554393056, 5252.281286310933, 57.136734496424047, -39.59291459694834, ECLIPSE_ANNULAR },
+    { -76065.517620846076, -76065.512149209258, 4771.0382335347167, -47.525064499643577, 162.37703911038065, ECLIPSE_TOTAL },
+    { -75888.752100642392, -75888.751629243896, 392.77002724271523, 4.5190168164879916, -88.808970070126705, ECLIPSE_ANNULAR },
+    { -75711.115420408838, -75711.115279326099, 114.2069787645392, 1.3607595368041683, 39.809919967274936, ECLIPSE_ANNULAR },
+    { -75534.245202032369, -75534.249879737428, 4162.8928972290432, -41.730130486998597, 107.76152169558901, ECLIPSE_TOTAL },
+    { -75357.002612932207, -75357.008688465343, 4731.7059897956824, 51.751757797456122, 23.004274769449751, ECLIPSE_ANNULAR },
+    { -75209.017151309963, -75209.007842732113, 8550.7221573464121, NAN, NAN, ECLIPSE_PARTIAL },
+    { -75179.578570122714, -75179.587510483034, 8391.9265095372921, NAN, NAN, ECLIPSE_PARTIAL },
+    { -75032.576543692456, -75032.566294717602, 8602.593905357, NAN, NAN, ECLIPSE_PARTIAL },
+    { -75002.982131975223, -75002.993709137503, 9329.2526850179129, NAN, NAN, ECLIPSE_PARTIAL },
+    { -74854.484961521157, -74854.479623761436, 4499.2755797394502, 24.788846537594154, 170.22334197285758, ECLIPSE_ANNULAR },
+    { -74678.183297286276, -74678.179444096502, 3357.3777533236466, -10.360085520019307, 63.720117930190483, ECLIPSE_TOTAL },
+    { -74500.239682384694, -74500.239537767207, 113.03892476023655, -21.111408154390244, 88.158975718184422, ECLIPSE_ANNULAR },
+    { -74323.53795698563, -74323.539649790095, 1527.3468247510764, 36.832496212588488, -164.64561201000157, ECLIPSE_TOTAL },
+    { -74146.247701908229, -74146.253295917297, 4276.3101622008708, -65.532606465651824, 88.43055064126645, ECLIPSE_ANNULAR },
+    { -73968.813902036374, -73968.820694507056, 6243.5486354961231, 76.981884266611061, 133.55658193803504, ECLIPSE_TOTAL },
+    { -73792.224289432415, -73792.234719149608, 8424.7413213101263, NAN, NAN, ECLIPSE_PARTIAL },
+    { -73643.666039029602, -73643.659271342651, 5573.7670552634527, -38.569197541343549, -101.66984863728037, ECLIPSE_ANNULAR },
+    { -73467.433227215151, -73467.427311107371, 5276.9060134797601, 35.174926860315729, 172.45534778079571, ECLIPSE_TOTAL },
+    { -73289.49182973725, -73289.490749759832, 832.01294846203689, 9.335701647572213, 178.74821304646503, ECLIPSE_ANNULAR },
+    { -73112.777416381548, -73112.776507918476, 814.63909384167755, -6.7001329097170235, -81.33762916161254, ECLIPSE_TOTAL },
+    { -72935.478093777856, -72935.483157580718, 3911.1547550765422, 45.752983306680193, 151.17450617548801, ECLIPSE_ANNULAR },
+    { -72758.126397403903, -72758.130587708627, 3689.479271810475, -40.297745221476028, 23.133091301135551, ECLIPSE_TOTAL },
+    { -72610.853604183867, -72610.843244475589, 9201.547240397982, NAN, NAN, ECLIPSE_PARTIAL },
+    { -72581.317488671673, -72581.327581829275, 8392.9340337418307, NAN, NAN, ECLIPSE_PARTIAL },
+    { -72433.265101250829, -72433.253579987693, 9349.7570120792861, NAN, NAN, ECLIPSE_PARTIAL },
+    { -72403.66851023816, -72403.678651741997, 8642.0163961894468, NAN, NAN, ECLIPSE_PARTIAL },
+    { -72256.28643216312, -72256.281513171372, 4423.2691743451442, -44.000650705642514, 131.39342474026941, ECLIPSE_TOTAL },
+    { -72079.20609724916, -72079.199822941955, 4828.3765256038478, 51.280228789094899, 105.57469467865431, ECLIPSE_ANNULAR },
+    { -71901.611887392908, -71901.61183889024, 43.197405665180582, -11.067072483073318, -136.05333467083341, ECLIPSE_TOTAL },
+    { -71725.149059689487, -71725.149097371977, 29.691243497076169, 13.572851845947548, 54.554698191571788, ECLIPSE_ANNULAR },
+    { -71547.024808111208, -71547.030029408576, 4502.4973236785454, 26.785678151115164, -4.5796005265008262, ECLIPSE_TOTAL },
+    { -71370.829434017302, -71370.83515838148, 4860.5355328210917, -29.322862922334391, -77.134776322580535, ECLIPSE_TOTAL },
+    { -71222.460011953473, -71222.447721242876, 9763.0898216114729, NAN, NAN, ECLIPSE_PARTIAL },
+    { -71192.698925507793, -71192.710204867908, 9348.7255944565095, NAN, NAN, ECLIPSE_PARTIAL },
+    { -71045.529581060429, -71045.522370195831, 6673.4360862935737, NAN, NAN, ECLIPSE_PARTIAL },
+    { -71016.229942113292, -71016.239965780944, 9292.3433431884896, NAN, NAN, ECLIPSE_PARTIAL },
+    { -70868.49476155304, -70868.487548234873, 5576.2994335867952, -83.043166721184207, -144.45541622240461, ECLIPSE_ANNULAR },
+    { -70690.818564957735, -70690.816259429266, 2043.0604261591018, 42.222416168765406, -64.653486242328754, ECLIPSE_TOTAL },
+    { -70514.404154809352, -70514.402876916152, 1031.6106144226669, -32.358250909070854, 143.29061124028618, ECLIPSE_ANNULAR },
+    { -70336.275185516162, -70336.278660343378, 2918.9262453978367, -4.6979874514769016, 100.26974412831794, ECLIPSE_TOTAL },
+    { -70160.00830323741, -70160.012264985504, 3435.9119402016613, 11.195780044664364, 3.8003178111458737, ECLIPSE_TOTAL },
+    { -69982.029669050884, -69982.039670725004, 8078.7860967424267, NAN, NAN, ECLIPSE_PARTIAL },
+    { -69834.804540324811, -69834.794725093816, 9206.8054314202764, NAN, NAN, ECLIPSE_PARTIAL },
+    { -69805.387485507774, -69805.395678293004, 7578.9075325447548, NAN, NAN, ECLIPSE_PARTIAL },
+    { -69657.668474103804, -69657.661472766646, 5574.6478236827988, 65.749125735923201, -157.3578417733421, ECLIPSE_ANNULAR },
+    { -69480.187144151787, -69480.181344921075, 5035.3906037580646, -55.03059028985934, 38.400828977845578, ECLIPSE_TOTAL },
+    { -69303.43025289198, -69303.429468680391, 656.60381547825011, 11.102938470482473, 153.66515655066351, ECLIPSE_ANNULAR },
+    { -69125.807699050943, -69125.807155632545, 437.36739695760747, -5.7243118203300476, -72.939192288103811, ECLIPSE_ANNULAR },
+    { -68948.903601882848, -68948.908029930157, 3949.3159074112887, -35.170807007075481, -18.09264020826382, ECLIPSE_TOTAL },
+    { -68771.713841596473, -68771.719442329122, 4342.6882544764248, 43.040098813757155, -86.003625756505699, ECLIPSE_ANNULAR },
+    { -68623.656055886779, -68623.646640774023, 8638.266886746258, NAN, NAN, ECLIPSE_PARTIAL },
+    { -68594.227552664175, -68594.23633903412, 8237.6530699622654, NAN, NAN, ECLIPSE_PARTIAL },
+    { -68447.291208902738, -68447.280513577745, 9054.0397331232543, NAN, NAN, ECLIPSE_PARTIAL },
+    { -68417.694193344549, -68417.705255166467, 8898.0018840528228, NAN, NAN, ECLIPSE_PARTIAL },
+    { -68269.131345356276, -68269.125920017803, 4559.9092804357388, 27.931029819445467, 40.301049136330505, ECLIPSE_ANNULAR },
+    { -68092.882342717407, -68092.877979897603, 3824.6793008913301, -17.377827134095973, -47.460289664739179, ECLIPSE_TOTAL },
+    { -67914.899400229187, -67914.899196392027, 158.97446563843567, -18.650275488854131, -33.549952470562914, ECLIPSE_ANNULAR },
+    { -67738.227594809432, -67738.228758771322, 1051.5069031097601, 30.969940164909559, 84.601556911412445, ECLIPSE_TOTAL },
+    { -67560.912921890544, -67560.918448165685, 4227.5851916748798, -63.765921152189584, -23.678314931413979, ECLIPSE_ANNULAR },
+    { -67383.505350534542, -67383.511671393775, 5784.9192969992828, 88.207745821909057, -161.96730307117494, ECLIPSE_TOTAL },
+    { -67206.879329389951, -67206.889660777277, 8373.9645247619992, NAN, NAN, ECLIPSE_PARTIAL },
+    { -67058.372878217328, -67058.365524912879, 6050.2041511888183, -47.857188615686766, 153.3655249098922, ECLIPSE_ANNULAR },
+    { -66882.077148683718, -66882.071154443969, 5363.8523190907745, 34.974496045220739, 41.384039345893484, ECLIPSE_TOTAL },
+    { -66704.211030488455, -66704.20933966813, 1302.5378821279257, 7.9605829343706809, 78.371532079928159, ECLIPSE_ANNULAR },
+    { -66527.421883323259, -66527.420824294648, 949.69198949537747, -8.8618261553135991, 150.78085793008449, ECLIPSE_TOTAL },
+    { -66350.192608435289, -66350.197095361509, 3474.8315278486161, 45.833834877376916, 52.310307604393415, ECLIPSE_ANNULAR },
+    { -66172.782550612188, -66172.786565744595, 3522.5274507519989, -43.117665339592854, -99.508502406644084, ECLIPSE_TOTAL },
+    { -66025.521134450013, -66025.510645056813, 9385.9673933113936, NAN, NAN, ECLIPSE_PARTIAL },
+    { -65996.009697158472, -65996.019315736834, 8027.1441496045754, NAN, NAN, ECLIPSE_PARTIAL },
+    { -65847.96755524668, -65847.955549886188, 9733.2668589097993, NAN, NAN, ECLIPSE_PARTIAL },
+    { -65818.345925689413, -65818.355889383238, 8434.9344824978507, NAN, NAN, ECLIPSE_PARTIAL },
+    { -65670.937422124116, -65670.932337205479, 4587.6972608284314, -41.417231448997732, 5.5955960125419928, ECLIPSE_TOTAL },
+    { -65493.923322819137, -65493.916491883596, 5264.1247323040216, 51.626062677386145, 8.5701731442525215, ECLIPSE_ANNULAR },
+    { -65316.256848513389, -65316.256649780385, 176.90347495444593, -7.9909300336647382, 96.176573235491958, ECLIPSE_TOTAL },
+    { -65139.861707480813, -65139.861164034846, 429.70098542820517, 13.588747902956179, -47.845147072978023, ECLIPSE_ANNULAR },
+    { -64961.674751117083, -64961.679886031547, 4413.4266832261264, 28.60909301309362, -132.47803656148847, ECLIPSE_ANNULAR },
+    { -64785.526224252309, -64785.531398720115, 4403.8247355135209, -26.093559741092864, 173.45076788739857, ECLIPSE_TOTAL },
+    { -64637.123116487252, -64637.110726336439, 9825.8575103276944, NAN, NAN, ECLIPSE_PARTIAL },
+    { -64607.361411990991, -64607.372656285763, 9281.9711771804286, NAN, NAN, ECLIPSE_PARTIAL },
+    { -64460.218358773258, -64460.21067273309, 7132.2819374023638, NAN, NAN, ECLIPSE_PARTIAL },
+    { -64430.916924462937, -64430.926485505937, 8846.7890466872414, NAN, NAN, ECLIPSE_PARTIAL },
+    { -64283.159018744729, -64283.151758427251, 5619.9988793831817, -79.861094113053582, 115.4947024008178, ECLIPSE_ANNULAR },
+    { -64105.512054718762, -64105.509197567873, 2524.7593670259521, 46.624665677315193, -171.51948721016126, ECLIPSE_TOTAL },
+    { -63929.056265056686, -63929.054944450763, 1069.1085844945694, -33.247875452538274, 20.305689843820232, ECLIPSE_ANNULAR },
+    { -63750.983655370976, -63750.986570268113, 2432.2753042992749, 0.9930369543427624, -6.1086027865459869, ECLIPSE_TOTAL },
+    { -63574.647533215422, -63574.651427301025, 3383.3258458807968, 9.2193452261883895, -127.46741413307298, ECLIPSE_TOTAL },
+    { -63396.754856909305, -63396.764311959523, 7581.8135482291855, NAN, NAN, ECLIPSE_PARTIAL },
+    { -63249.453854667867, -63249.443850985605, 9368.3152834265857, NAN, NAN, ECLIPSE_PARTIAL },
+    { -63220.023564087918, -63220.031687983865, 7508.3138475016885, NAN, NAN, ECLIPSE_PARTIAL },
+    { -63072.374367245924, -63072.36694841391, 5941.0605754720355, 74.77681426585967, 73.351313363460179, ECLIPSE_ANNULAR },
+    { -62894.851668622039, -62894.845587199117, 5257.1641955608529, -62.213875827817979, -87.603132058970061, ECLIPSE_TOTAL },
+    { -62718.112299779801, -62718.111165233902, 954.6497575350345, 17.847154886925427, 37.621819092235228, ECLIPSE_TOTAL },
+    { -62540.495234747708, -62540.494335721974, 719.49404771488435, -12.450008992675077, 172.8833989924411, ECLIPSE_ANNULAR },
+    { -62363.566085780119, -62363.570229598401, 3702.9283643199028, -28.496756406796777, -142.64727133370513, ECLIPSE_TOTAL },
+    { -62186.420382691562, -62186.425547894178, 3988.6129736440407, 35.001897951307804, 164.26663647728844, ECLIPSE_ANNULAR },
+    { -62038.298148006157, -62038.288602481625, 8746.9555098644669, NAN, NAN, ECLIPSE_PARTIAL },
+    { -62008.881028626638, -62008.889632726379, 8052.9033466377223, NAN, NAN, ECLIPSE_PARTIAL },
+    { -61862.001459186213, -61861.990357468785, 9475.8663509319304, NAN, NAN, ECLIPSE_PARTIAL },
+    { -61832.400143329549, -61832.410731743403, 8505.4022231364252, NAN, NAN, ECLIPSE_PARTIAL },
+    { -61683.781850709951, -61683.776305260886, 4647.1002985216337, 31.911087222798457, -88.430328271938777, ECLIPSE_ANNULAR },
+    { -61507.576933305223, -61507.572099799814, 4261.4579145015468, -24.835177272351803, -160.99805764781365, ECLIPSE_TOTAL },
+    { -61329.562309646346, -61329.56202034864, 225.13514569734809, -15.273365086709763, -154.57135236004368, ECLIPSE_ANNULAR },
+    { -61152.915107552413, -61152.915761538883, 591.34228893870522, 24.576037664029595, -27.956279286543307, ECLIPSE_TOTAL },
+    { -60975.579712793537, -60975.585154118278, 4166.2573888043189, -60.593897334286218, -137.50961051956952, ECLIPSE_ANNULAR },
+    { -60798.19673647781, -60798.202586668071, 5329.346113559498, 77.601960637707762, 92.549727200128956, ECLIPSE_TOTAL },
+    { -60621.534290593692, -60621.544518203744, 8319.3990993104489, NAN, NAN, ECLIPSE_PARTIAL },
+    { -60473.085043417363, -60473.077063981007, 6559.4867955401478, NAN, NAN, ECLIPSE_PARTIAL },
+    { -60296.716541538735, -60296.710502196605, 5420.0167506433791, 34.943489039904058, -91.704172813642629, ECLIPSE_TOTAL },
+    { -60118.935573339746, -60118.933223844906, 1810.2434931333066, 5.3735773144725698, -20.355817892509066, ECLIPSE_ANNULAR },
+    { -59942.06208221789, -59942.06090893806, 1052.0529628615097, -10.664752224194443, 21.460162695701342, ECLIPSE_TOTAL },
+    { -59764.911348189387, -59764.915214554399, 3002.8175303119647, 45.114613753872057, -44.549188830394883, ECLIPSE_ANNULAR },
+    { -59587.433804163607, -59587.437689164683, 3396.6632465778675, -46.075691524572306, 136.74128234761861, ECLIPSE_TOTAL },
+    { -59440.194091086443, -59440.183432164245, 9614.7073041097265, NAN, NAN, ECLIPSE_PARTIAL },
+    { -59410.706978047623, -59410.716072213232, 7616.2177758839443, NAN, NAN, ECLIPSE_PARTIAL },
+    { -59233.018095638501, -59233.027923661706, 8270.1960420510841, NAN, NAN, ECLIPSE_PARTIAL },
+    { -59085.593747872706, -59085.588451658499, 4795.5970000776479, -39.704663096986586, -118.43034213671444, ECLIPSE_TOTAL },
+    { -58908.634826926602, -58908.627499020236, 5656.623694483912, 52.431211674200597, -90.697346175428834, ECLIPSE_ANNULAR },
+    { -58730.907285503185, -58730.906890308943, 351.61622816335432, -5.0449880037721497, -29.670883540906463, ECLIPSE_TOTAL },
+    { -58554.567815829643, -58554.566751340048, 844.85788683264707, 12.841623092046396, -152.77902248776829, ECLIPSE_ANNULAR },
+    { -58376.329180934488, -58376.334195005991, 4295.4405916032429, 30.67290096079001, 101.59600569467648, ECLIPSE_ANNULAR },
+    { -58200.219020014098, -58200.223673251334, 3970.2903143132039, -24.35148727334775, 62.813990652402723, ECLIPSE_TOTAL },
+    { -58051.786984083403, -58051.77449847704, 9891.297142004285, NAN, NAN, ECLIPSE_PARTIAL },
+    { -58022.027447417029, -58022.038626995163, 9193.21594436958, NAN, NAN, ECLIPSE_PARTIAL },
+    { -57874.907093465255, -57874.89893481676, 7591.3973865610897, NAN, NAN, ECLIPSE_PARTIAL },
+    { -57845.601500167417, -57845.610610292948, 8415.1917009792924, NAN, NAN, ECLIPSE_PARTIAL },
+    { -57697.822485614379, -57697.815187707834, 5659.7262058322685, -75.800200185330638, 0.84201326515130859, ECLIPSE_ANNULAR },
+    { -57520.20701673007, -57520.203596421969, 3014.050706198856, 50.08642156255506, 83.470990923829376, ECLIPSE_TOTAL },
+    { -57343.706338279029, -57343.704988740777, 1096.0106575821842, -33.01701012403209, -103.32897042648685, ECLIPSE_ANNULAR },
+    { -57165.693864544613, -57165.696202253181, 1938.1016891830395, 5.8540404235409662, -111.15054294638898, ECLIPSE_TOTAL },
+    { -56989.285135384474, -56989.28897077241, 3339.035122462376, 8.0574691205961564, 100.8244769112834, ECLIPSE_TOTAL },
+    { -56811.481543646514, -56811.490426983983, 7074.8929130017668, NAN, NAN, ECLIPSE_PARTIAL },
+    { -56664.099010429774, -56664.088846404091, 9499.6823365206219, NAN, NAN, ECLIPSE_PARTIAL },
+    { -56634.657206309406, -56634.665279225337, 7456.0078986498975, NAN, NAN, ECLIPSE_PARTIAL },
+    { -56487.084635350082, -56487.076764969781, 6342.1424272666727, 73.473751634732253, -110.45475216023735, ECLIPSE_ANNULAR },
+    { -56309.511642219426, -56309.505320635166, 5440.0689661143206, -69.020477685072308, 144.58681179729541, ECLIPSE_TOTAL },
+    { -56132.799542075583, -56132.798007812467, 1297.5711747569287, 24.749087858660964, -76.326882878021223, ECLIPSE_TOTAL },
+    { -55955.177152930468, -55955.175954898252, 953.61969635768787, -18.648055834923071, 57.176028366676462, ECLIPSE_ANNULAR },
+    { -55778.234688504417, -55778.238494460355, 3406.5495745762291, -21.627970092788011, 94.941843634512509, ECLIPSE_TOTAL },
+    { -55601.119635055744, -55601.124430470154, 3689.7554772081289, 27.81286125467814, 52.648944715867685, ECLIPSE_ANNULAR },
+    { -55452.945888452705, -55452.936169070832, 8895.7688087642, NAN, NAN, ECLIPSE_PARTIAL },
+    { -55423.540616290673, -55423.548996304497, 7824.7429408278449, NAN, NAN, ECLIPSE_PARTIAL },
+    { -55276.706784606133, -55276.695318373335, 9864.1428559781289, NAN, NAN, ECLIPSE_PARTIAL },
+    { -55247.09975676849, -55247.109918116555, 8154.1067859916238, NAN, NAN, ECLIPSE_PARTIAL },
+    { -55098.437231368902, -55098.431527973378, 4765.4211470127784, 36.712939784670176, 144.20084517760327, ECLIPSE_ANNULAR },
+    { -54922.268401568894, -54922.263123202109, 4678.2773560848218, -32.794297272403341, 83.457276465394401, ECLIPSE_TOTAL },
+    { -54744.229487401266, -54744.229076911026, 318.80323791776436, -11.061080967960672, 85.430007800875558, ECLIPSE_ANNULAR },
+    { -54567.601095050224, -54567.601252341374, 142.29900273238286, 17.728195021025684, -141.91679519128064, ECLIPSE_TOTAL },
+    { -54390.248170298859, -54390.253509733157, 4092.6244897236852, -56.402515725550131, 106.75958003534834, ECLIPSE_ANNULAR },
+    { -54212.887721244093, -54212.89310516783, 4880.4614806928394, 68.105167930710365, -19.611410644376122, ECLIPSE_TOTAL },
+    { -54036.189408779705, -54036.199528171732, 8260.7982250343885, NAN, NAN, ECLIPSE_PARTIAL },
+    { -53887.800134688892, -53887.791513860204, 7081.2428282584897, NAN, NAN, ECLIPSE_PARTIAL },
+    { -53711.352568520902, -53711.346508330433, 5452.8532413363964, 35.136951235412909, 133.74878426046536, ECLIPSE_TOTAL },
+    { -53533.66429479573, -53533.661252589634, 2345.0723578297584, 1.5639013380363946, -118.05145486199952, ECLIPSE_ANNULAR },
+    { -53356.698497986181, -53356.69724455593, 1123.6146240077264, -11.994109677221724, -109.11088504251916, ECLIPSE_TOTAL },
+    { -53179.633343391892, -53179.636556944017, 2503.4264971428029, 43.393608326433629, -140.22384934278085, ECLIPSE_ANNULAR },
+    { -53002.081407361307, -53002.085198061155, 3303.2293581778636, -48.856496124136569, 12.563529832781455, ECLIPSE_TOTAL },
+    { -52825.407057593155, -52825.41560079161, 7179.006222520964, NAN, NAN, ECLIPSE_PARTIAL },
+    { -52647.685902991601, -52647.695632418872, 8142.4080922099229, NAN, NAN, ECLIPSE_PARTIAL },
+    { -52500.254632212949, -52500.249088508222, 5038.5229436540221, -39.018470730011991, 119.08631645853148, ECLIPSE_TOTAL },
+    { -52323.340978738677, -52323.333210748329, 6008.0075219746132, 54.333376287164285, 168.98346750757037, ECLIPSE_ANNULAR },
+    { -52145.563145444023, -52145.562510225558, 564.89188897387589, -2.3754381308690808, -153.54663558726998, ECLIPSE_TOTAL },
+    { -51969.267858342726, -51969.266329149308, 1218.4895123445281, 11.571044743898547, 99.856843027609159, ECLIPSE_ANNULAR },
+    { -51790.99107504671, -51790.995907605473, 4125.726092416292, 32.699112225412648, -21.036872934213363, ECLIPSE_ANNULAR },
+    { -51614.905658590891, -51614.909842189394, 3579.184934457297, -23.966887406936792, -49.930934037346049, ECLIPSE_TOTAL },
+    { -51466.454827637375, -51466.442224083505, 9982.3766491735551, NAN, NAN, ECLIPSE_PARTIAL },
+    { -51436.700564292958, -51436.711621096176, 9056.7245953545789, NAN, NAN, ECLIPSE_PARTIAL },
+    { -51289.593891826626, -51289.585279834799, 8034.1747678738811, NAN, NAN, ECLIPSE_PARTIAL },
+    { -51260.281393579848, -51260.290085793255, 8017.7762946656158, NAN, NAN, ECLIPSE_PARTIAL },
+    { -51112.487943951193, -51112.480592608874, 5715.8116238298071, -71.74170167684106, -117.61569220798742, ECLIPSE_ANNULAR },
+    { -50934.902084861118, -50934.898103842992, 3498.7460131114149, 52.463252347422468, -20.455668893511699, ECLIPSE_TOTAL },
+    { -50758.355638454559, -50758.354262966364, 1121.0895464063994, -31.772310990356075, 132.56256908950547, ECLIPSE_ANNULAR },
+    { -50580.407439011069, -50580.409166914069, 1423.5508218107623, 9.9657664241153565, 145.67143953296579, ECLIPSE_ANNULAR },
+    { -50403.920192105885, -50403.923988624207, 3312.7003409091121, 7.8426203110120722, -31.70980430732908, ECLIPSE_TOTAL },
+    { -50226.212051602932, -50226.220317475942, 6540.3011543207413, NAN, NAN, ECLIPSE_PARTIAL },
+    { -50078.739422737599, -50078.729133036337, 9595.1847560629903, NAN, NAN, ECLIPSE_PARTIAL },
+    { -50049.288243153816, -50049.296285650256, 7425.0509635358212, NAN, NAN, ECLIPSE_PARTIAL },
+    { -49901.799199041685, -49901.790845986645, 6777.2049343805384, NAN, NAN, ECLIPSE_PARTIAL },
+    { -49724.166639716183, -49724.160125146351, 5580.4337311878953, -75.30678555492679, 15.352585609911898, ECLIPSE_ANNULAR },
+    { -49547.49004336026, -49547.488079345596, 1669.7901129187674, 31.592814269327974, 171.41363692630551, ECLIPSE_TOTAL },
+    { -49369.854945615494, -49369.853490766305, 1151.9974022640054, -24.28401530941526, -59.401267731556914, ECLIPSE_ANNULAR },
+    { -49192.906999540413, -49192.910435991806, 3080.3363400484964, -14.852288241326864, -25.918517927241361, ECLIPSE_TOTAL },
+    { -49015.81376762384, -49015.818238437947, 3428.9599277110033, 21.316950562625724, -60.320256465061448, ECLIPSE_ANNULAR },
+    { -48867.598970017418, -48867.589036703772, 9081.7836957951913, NAN, NAN, ECLIPSE_PARTIAL },
+    { -48838.205726507906, -48838.21384352797, 7557.4248688521529, NAN, NAN, ECLIPSE_PARTIAL },
+    { -48661.792400529972, -48661.802186670378, 7848.6294461047382, NAN, NAN, ECLIPSE_PARTIAL },
+    { -48513.098086439568, -48513.092180806023, 4919.8424459772386, 42.331126468010027, 18.254212859848735, ECLIPSE_ANNULAR },
+    { -48336.954694987238, -48336.949014179016, 5059.3718364610422, -41.013830974311013, -34.961430595665604, ECLIPSE_TOTAL },
+    { -48158.901928420171, -48158.901349707936, 448.55523234721488, -6.0925827107699178, -33.186595376540886, ECLIPSE_ANNULAR },
+    { -47982.283313206019, -47982.283006391503, 277.62162382806292, 10.681548580207565, 102.17479772313814, ECLIPSE_TOTAL },
+    { -47804.920328325941, -47804.925527478888, 3989.8500630657331, -51.356059807976798, -9.8502186224968113, ECLIPSE_ANNULAR },
+    { -47627.577381523719, -47627.582309780068, 4444.3308470917646, 59.166024107434723, -133.21270576470073, ECLIPSE_TOTAL },
+    { -47450.846297539611, -47450.856287649476, 8184.6010763411668, NAN, NAN, ECLIPSE_PARTIAL },
+    { -47302.518134288628, -47302.508854606123, 7616.8525240234203, NAN, NAN, ECLIPSE_PARTIAL },
+    { -47273.02871557758, -47273.03955800135, 9600.3447459364888, NAN, NAN, ECLIPSE_PARTIAL },
+    { -47125.986619739466, -47125.980549901258, 5474.5699744279364, 35.723135705044086, -1.6430643698089966, ECLIPSE_TOTAL },
+    { -46948.395699615023, -46948.391943680654, 2897.2420542758946, -3.4382088492954042, 144.57798322223664, ECLIPSE_ANNULAR },
+    { -46771.33176749041, -46771.33046099847, 1170.6633686747689, -12.718048868205969, 119.2779136801351, ECLIPSE_TOTAL },
+    { -46594.358104045605, -46594.360635295969, 1978.326994269125, 40.508839057165559, 124.61910211145499, ECLIPSE_ANNULAR },
+    { -46416.72538626934, -46416.729117568786, 3240.8357201342637, -51.205877883796575, -111.92306441746138, ECLIPSE_TOTAL },
+    { -46240.110476523281, -46240.11843398503, 6708.7548025187298, NAN, NAN, ECLIPSE_PARTIAL },
+    { -46062.34903342848, -46062.358704048951, 8052.5183801545199, NAN, NAN, ECLIPSE_PARTIAL },
+    { -45914.921511868706, -45914.915669750299, 5330.6202854121293, -39.854727596117456, -1.0623181357085016, ECLIPSE_TOTAL },
+    { -45738.039925606972, -45738.03178854764, 6306.3463276379189, 58.602283369051754, 71.734934860571457, ECLIPSE_ANNULAR },
+    { -45560.224566026147, -45560.223643943864, 819.51256141168972, -0.18374011305944224, 84.657773765539275, ECLIPSE_TOTAL },
+    { -45383.961099855238, -45383.959166719877, 1546.6895977524271, 9.9492065884034471, -10.23700676963324, ECLIPSE_ANNULAR },
+    { -45205.658091884128, -45205.662702322661, 3922.0899719028353, 34.815436165497182, -141.21993364302404, ECLIPSE_ANNULAR },
+    { -45029.586657935237, -45029.59041626133, 3224.3911268612219, -24.59137589401038, -164.57546075579728, ECLIPSE_TOTAL },
+    { -44851.378856105766, -44851.389745632805, 8885.1967405825235, NAN, NAN, ECLIPSE_PARTIAL },
+    { -44704.279289238373, -44704.270235383978, 8467.8337079948124, NAN, NAN, ECLIPSE_PARTIAL },
+    { -44674.957517323302, -44674.965815738877, 7644.832794546006, NAN, NAN, ECLIPSE_PARTIAL },
+    { -44527.154246511549, -44527.146834723222, 5781.1982758700051, -67.899125255750818, 122.0393170098387, ECLIPSE_ANNULAR },
+    { -44349.59632781375, -44349.591794664579, 3973.5415396934964, 53.806544669186344, -124.14947667133541, ECLIPSE_TOTAL },
+    { -44173.005720653309, -44173.004305171111, 1158.3562878329496, -29.734541838672826, 8.35213430547293, ECLIPSE_ANNULAR },
+    { -43995.120281121388, -43995.121403683668, 919.3638338956199, 13.03317945358593, 42.793722986491161, ECLIPSE_ANNULAR },
+    { -43818.555264088689, -43818.559015661624, 3281.622838878533, 8.3396537840804807, -164.21575045883242, ECLIPSE_TOTAL },
+    { -43640.942951470926, -43640.950581895217, 6001.8474662377075, -46.466481625882672, -33.576662099532285, ECLIPSE_ANNULAR },
+    { -43493.377004951013, -43493.366607668126, 9672.0367523086443, NAN, NAN, ECLIPSE_PARTIAL },
+    { -43463.918649037798, -43463.926664010462, 7398.0050044430127, NAN, NAN, ECLIPSE_PARTIAL },
+    { -43316.516223907667, -43316.507373270215, 7233.9699084135391, NAN, NAN, ECLIPSE_PARTIAL },
+    { -43138.817954649159, -43138.811281437986, 5690.4348037282634, -81.150075763922274, -114.10411046966965, ECLIPSE_ANNULAR },
+    { -42962.185028344546, -42962.182591356148, 2083.23678082673, 38.390367794959502, 61.500765874703745, ECLIPSE_TOTAL },
+    { -42784.527304622992, -42784.525647627677, 1305.7029419665951, -29.123338414001214, -177.12753524045277, ECLIPSE_ANNULAR },
+    { -42607.584209577391, -42607.587231752877, 2712.419734045005, -8.1447618974608922, -144.72527356526439, ECLIPSE_TOTAL },
+    { -42430.501602218792, -42430.505804269713, 3214.2256835939088, 15.651137087121214, -175.06166845812413, ECLIPSE_ANNULAR },
+    { -42282.258251275867, -42282.248056506876, 9312.2126603859815, NAN, NAN, ECLIPSE_PARTIAL },
+    { -42252.876286800689, -42252.884100479539, 7250.4387922505057, NAN, NAN, ECLIPSE_PARTIAL },
+    { -42076.477771169899, -42076.487237296897, 7591.0816443389622, NAN, NAN, ECLIPSE_PARTIAL },
+    { -41927.76561929928, -41927.759455960964, 5119.9884999420692, 48.839761666729146, -106.19303127499438, ECLIPSE_ANNULAR },
+    { -41751.636316194476, -41751.630268515153, 5409.5737890062892, -49.488976916430637, -156.56423661585811, ECLIPSE_TOTAL },
+    { -41573.579830567862, -41573.579034499497, 615.91884470968, -0.50041474563142785, -150.27270482213112, ECLIPSE_ANNULAR },
+    { -41396.961930052246, -41396.961189292, 670.16830852161297, 3.5101394526615515, -15.434024642880615, ECLIPSE_TOTAL },
+    { -41219.596505577116, -41219.601523146746, 3855.6001518380799, -45.697805000802468, -126.64961033987733, ECLIPSE_ANNULAR },
+    { -41042.264509495806, -41042.269003591151, 4031.2786781510531, 50.656460753937615, 111.82468130017266, ECLIPSE_TOTAL },
+    { -40865.504783518903, -40865.514627209355, 8093.0424942706022, NAN, NAN, ECLIPSE_PARTIAL },
+    { -40717.2380482136, -40717.228103496134, 8157.9068775142414, NAN, NAN, ECLIPSE_PARTIAL },
+    { -40687.735077509809, -40687.745535938768, 9169.5221193336565, NAN, NAN, ECLIPSE_PARTIAL },
+    { -40540.618978962113, -40540.612909858311, 5485.4051318709262, 36.681196356059601, -137.7323280183985, ECLIPSE_TOTAL },
+    { -40363.128975456886, -40363.124494702191, 3459.8275662147289, -9.603260466804393, 47.10652694631171, ECLIPSE_ANNULAR },
+    { -40185.963291683845, -40185.961948240554, 1203.0228230586761, -12.702012244556437, -12.923696966757916, ECLIPSE_TOTAL },
+    { -40009.084409713316, -40009.086243072328, 1437.7627868614829, 36.499157254615447, 29.127693027254729, ECLIPSE_ANNULAR },
+    { -39831.367027505446, -39831.370724697161, 3200.8371921583098, -52.804504762563944, 123.71346784242724, ECLIPSE_TOTAL },
+    { -39654.814727293633, -39654.822089686022, 6226.5671581190127, 74.390469720660718, 163.1160302936637, ECLIPSE_ANNULAR },
+    { -39477.009902982631, -39477.019536264881, 7983.5883188137441, NAN, NAN, ECLIPSE_PARTIAL },
+    { -39329.592345125515, -39329.586174429678, 5652.5202108877047, -42.456243590524252, -119.5797556911217, ECLIPSE_TOTAL },
+    { -39152.732848840278, -39152.724403404834, 6559.4958204717886, NAN, NAN, ECLIPSE_PARTIAL },
+    { -38974.892347930108, -38974.891086535972, 1120.2768130980598, 1.3037298180160009, -34.741277825886712, ECLIPSE_TOTAL },
+    { -38798.64736083593, -38798.645087690515, 1826.241162050268, 8.1285990283274856, -123.11880533164197, ECLIPSE_ANNULAR },
+    { -38620.33290611401, -38620.33723054242, 3664.7238125136641, 36.712406625009464, 102.2362460318256, ECLIPSE_TOTAL },
+    { -38444.2607846217, -38444.264176758006, 2918.5875186399162, -26.094328571605143, 78.402860967734796, ECLIPSE_TOTAL },
+    { -38266.065522415091, -38266.076175318834, 8656.1431443261481, NAN, NAN, ECLIPSE_PARTIAL },
+    { -38118.961006060359, -38118.951542320683, 8871.4995323389903, NAN, NAN, ECLIPSE_PARTIAL },
+    { -38089.627777277412, -38089.635727311223, 7316.5796309276366, NAN, NAN, ECLIPSE_PARTIAL },
+    { -37941.824178626608, -37941.816675728114, 5875.0055520308806, -64.58513979404367, 2.9956878054839109, ECLIPSE_ANNULAR },
+    { -37764.290055982579, -37764.284978733507, 4439.1263229240985, 54.386624499345103, 132.00615738808901, ECLIPSE_TOTAL },
+    { -37587.657063117746, -37587.655592656993, 1208.6495827008689, -27.048884321022257, -115.87834756666106, ECLIPSE_ANNULAR },
+    { -37409.834449987065, -37409.8349546178, 410.94863584249651, 15.229148651992295, -59.179681401407606, ECLIPSE_ANNULAR },
+    { -37233.190881041082, -37233.194580771451, 3245.1309734619263, 9.5216126161235852, 63.471663371558805, ECLIPSE_TOTAL },
+    { -37055.675284181372, -37055.682255476699, 5453.4955725072432, -35.764402214570396, -130.26375886645525, ECLIPSE_ANNULAR },
+    { -36908.01132151718, -36908.000843038899, 9723.1418162731607, NAN, NAN, ECLIPSE_PARTIAL },
+    { -36878.54853461212, -36878.556527677509, 7377.9427332257374, NAN, NAN, ECLIPSE_PARTIAL },
+    { -36731.235469895248, -36731.226113077515, 7708.4783079033732, NAN, NAN, ECLIPSE_PARTIAL },
+    { -36553.466453153364, -36553.459651420075, 5774.3511147263271, -86.505943022086015, 122.56792814342373, ECLIPSE_ANNULAR },
+    { -36376.88176412609, -36376.878840633486, 2513.2653027479378, 44.819049661049604, -46.607580281059015, ECLIPSE_TOTAL },
+    { -36199.195969109322, -36199.1941507925, 1426.3134210002611, -33.081997272321551, 64.670140910374812, ECLIPSE_ANNULAR },
+    { -36022.265213063372, -36022.26778865925, 2314.3504599459461, -1.7065036074112425, 98.282601646822059, ECLIPSE_TOTAL },
+    { -35845.184151694404, -35845.188134418466, 3039.7812755808577, 10.839217916477022, 68.743948742040232, ECLIPSE_ANNULAR },
+    { -35696.92324339856, -35696.91274753405, 9580.1206716816923, NAN, NAN, ECLIPSE_PARTIAL },
+    { -35667.551700159514, -35667.559175695074, 6910.664996333051, NAN, NAN, ECLIPSE_PARTIAL },
+    { -35491.156857620823, -35491.166052065848, 7376.1589515310334, NAN, NAN, ECLIPSE_PARTIAL },
+    { -35342.43984387254, -35342.433369543302, 5363.4169614314578, 56.194784859240833, 130.2038219123273, ECLIPSE_ANNULAR },
+    { -35166.31172577299, -35166.30536201597, 5714.3831653681391, -57.894427429298368, 77.240082718876991, ECLIPSE_TOTAL },
+    { -34988.263976906353, -34988.262908548946, 825.19059069146033, 5.6199028984846713, 94.555393254889168, ECLIPSE_ANNULAR },
+    { -34811.636738359637, -34811.635597185988, 1031.9538715239125, -3.6723940586038699, -134.62629525163112, ECLIPSE_TOTAL },
+    { -34634.277832271182, -34634.282617780162, 3682.5968489646916, -39.545647750460247, 117.25184357425414, ECLIPSE_ANNULAR },
+    { -34456.9488092467, -34456.952895090639, 3645.1966967637736, 42.509332985549534, -4.4029848841643968, ECLIPSE_TOTAL },
+    { -34280.168200996362, -34280.177851649969, 7961.6237659702238, NAN, NAN, ECLIPSE_PARTIAL },
+    { -34131.95864082245, -34131.948036825117, 8693.5121416921738, NAN, NAN, ECLIPSE_PARTIAL },
+    { -34102.438987564157, -34102.449078769918, 8762.2922264835506, NAN, NAN, ECLIPSE_PARTIAL },
+    { -33955.251817201381, -33955.245742959414, 5500.9534415184298, 38.263054647758949, 86.262680227532769, ECLIPSE_TOTAL },
+    { -33777.8627913198, -33777.857589446074, 4021.5431170615852, -16.851148332433336, -51.060070202051335, ECLIPSE_ANNULAR },
+    { -33600.594538111101, -33600.593162674719, 1230.6775287088808, -11.846376962289847, -145.28537031331146, ECLIPSE_TOTAL },
+    { -33423.811149743822, -33423.812282260034, 891.32152200876556, 31.489644635433393, -67.305641566394812, ECLIPSE_ANNULAR },
+    { -33246.006815943503, -33246.010502625373, 3181.4267633113823, -53.44670642092936, -0.67998468384155331, ECLIPSE_TOTAL },
+    { -33069.521749486528, -33069.528489706507, 5717.4465472529537, 82.918124762117813, 122.72175631508668, ECLIPSE_TOTAL },
+    { -32891.667268315665, -32891.676898964084, 7946.7872183914596, NAN, NAN, ECLIPSE_PARTIAL },
+    { -32744.268646485427, -32744.262104912927, 6015.9453997312257, -48.099729396122143, 125.03323148567915, ECLIPSE_TOTAL },
+    { -32567.419087501639, -32567.410400826691, 6761.5830872981878, NAN, NAN, ECLIPSE_PARTIAL },
+    { -32389.565735235126, -32389.564090759228, 1459.1529525256649, 1.9713948881138299, -152.06862387290059, ECLIPSE_TOTAL },
+    { -32213.326547106542, -32213.323999567761, 2055.1159281983246, 6.2407391446982112, 121.21023117603488, ECLIPSE_ANNULAR },
+    { -32035.013504151601, -32035.017498562189, 3371.4448227881112, 38.397648808393278, -11.440811018468381, ECLIPSE_TOTAL },
+    { -31858.929907030823, -31858.932975385262, 2647.5727007582436, -28.10900749868145, -40.207353164856215, ECLIPSE_TOTAL },
+    { -31680.758011155052, -31680.768379609399, 8389.7254052049793, NAN, NAN, ECLIPSE_PARTIAL },
+    { -31533.640149713727, -31533.630298118409, 9254.0729205977495, NAN, NAN, ECLIPSE_PARTIAL },
+    { -31504.293727601587, -31504.301363354392, 7021.1475408737042, NAN, NAN, ECLIPSE_PARTIAL },
+    { -31356.498298727445, -31356.490670572221, 6000.3839643813753, -62.047967544543219, -113.72277800894332, ECLIPSE_ANNULAR },
+    { -31178.981491572948, -31178.975895907075, 4879.932689327391, 54.439467736815615, 26.893970951322444, ECLIPSE_TOTAL },
+    { -31002.31152860275, -31002.309971965911, 1285.6429507613475, -23.998270410393786, 120.56698101212248, ECLIPSE_ANNULAR },
+    { -30824.546824699784, -30824.546730761733, 76.097368604415266, 16.417612352956354, -161.56669628122435, ECLIPSE_ANNULAR },
+    { -30647.829261226023, -30647.832883327566, 3186.1713283089271, 11.174202321116782, -67.824861586135469, ECLIPSE_TOTAL },
+    { -30470.405832825934, -30470.412152381399, 4920.1335964584832, -29.072617367380513, 132.23777280728359, ECLIPSE_ANNULAR },
+    { -30322.644885116049, -30322.634333012782, 9767.7920759817498, NAN, NAN, ECLIPSE_PARTIAL },
+    { -30293.1804322481, -30293.188389229101, 7345.2389718789436, NAN, NAN, ECLIPSE_PARTIAL },
+    { -30145.956633684626, -30145.946766050205, 8198.2029879120437, NAN, NAN, ECLIPSE_PARTIAL },
+    { -30116.374812475875, -30116.386800939643, 9634.3728990011095, NAN, NAN, ECLIPSE_PARTIAL },
+    { -29968.112728359341, -29968.105824711529, 5836.1869917163303, -88.040687206912409, 121.87912289963899, ECLIPSE_ANNULAR },
+    { -29791.581260253693, -29791.577827362948, 2968.3885147962555, 50.824426519924359, -152.16093510752916, ECLIPSE_TOTAL },
+    { -29613.8613713468, -29613.859429324777, 1517.1914177633209, -36.001611949741672, -53.874387243087142, ECLIPSE_ANNULAR },
+    { -29436.949897496237, -29436.951994750227, 1886.5193782037441, 4.3675056117921391, -16.842035216297091, ECLIPSE_TOTAL },
+    { -29259.86107247401, -29259.864888539279, 2907.9998662696898, 6.9977037876938262, -49.046566774028292, ECLIPSE_ANNULAR },
+    { -29082.232404121656, -29082.239500902422, 6533.5387374997808, NAN, NAN, ECLIPSE_PARTIAL },
+    { -28905.829564942444, -28905.838537746771, 7204.5486189358489, NAN, NAN, ECLIPSE_PARTIAL },
+    { -28757.121231211699, -28757.114388631213, 5654.0357661027456, 64.448023665371238, 5.4981401607935823, ECLIPSE_ANNULAR },
+    { -28580.981579946325, -28580.974942585872, 5980.1959381616634, -66.024950793422263, -56.0054133311057, ECLIPSE_TOTAL },
+    { -28402.955722891937, -28402.954312690777, 1087.6804667184626, 12.246224608018629, -18.123065959987112, ECLIPSE_ANNULAR },
+    { -28226.306611099553, -28226.305112248701, 1354.3604083257067, -10.712006247031695, 104.41110142675899, ECLIPSE_TOTAL },
+    { -28048.964046381108, -28048.968550520123, 3471.6627809091665, -33.048823009004686, 2.1956318872133638, ECLIPSE_ANNULAR },
+    { -27871.629888410316, -27871.633594097468, 3287.9502629377798, 34.70777728058421, -121.8898171891274, ECLIPSE_TOTAL },
+    { -27694.834642245845, -27694.844070810228, 7804.2380805168305, NAN, NAN, ECLIPSE_PARTIAL },
+    { -27546.678912067906, -27546.66766313004, 9217.5450507722926, NAN, NAN, ECLIPSE_PARTIAL },
+    { -27517.140803438899, -27517.150539545346, 8374.409473815831, NAN, NAN, ECLIPSE_PARTIAL },
+    { -27369.88514080918, -27369.879055034758, 5521.4999619379078, 40.444316122975827, -49.697379916948535, ECLIPSE_TOTAL },
+    { -27192.596945100955, -27192.59102615658, 4582.6909496784447, -25.261971607392969, -150.17205518397492, ECLIPSE_ANNULAR },
+    { -27015.225640144748, -27015.224235905629, 1255.2326532268435, -10.168747175336398, 82.148601871982009, ECLIPSE_TOTAL },
+    { -26838.536855796294, -26838.537296803122, 348.35910368535849, 25.653723381670908, -165.22640044432364, ECLIPSE_ANNULAR },
+    { -26660.646941616491, -26660.65061930925, 3163.208724976002, -52.847582241171104, -124.90667032227108, ECLIPSE_ANNULAR },
+    { -26484.227490637317, -26484.233617325834, 5211.8012942289333, 78.168678690090971, 73.595559985918513, ECLIPSE_TOTAL },
+    { -26306.3237126614, -26306.333351147183, 7920.3450404950872, NAN, NAN, ECLIPSE_PARTIAL },
+    { -26158.948273402562, -26158.941335421714, 6405.1789867725174, NAN, NAN, ECLIPSE_PARTIAL },
+    { -26129.637131755462, -26129.647486866077, 9639.080973758606, NAN, NAN, ECLIPSE_PARTIAL },
+    { -25982.100065548053, -25982.09118708218, 6926.1247471296911, NAN, NAN, ECLIPSE_PARTIAL },
+    { -25804.244593079064, -25804.242519421816, 1837.9109901586319, 1.6299674312037331, 92.547486079759835, ECLIPSE_TOTAL },
+    { -25627.999032765594, -25627.996268463568, 2239.0065886171196, 4.4541137512127618, 2.9526305934252832, ECLIPSE_ANNULAR },
+    { -25449.70209335347, -25449.705688380258, 3021.0675959927344, 39.448102557003963, -121.34138750701655, ECLIPSE_TOTAL },
+    { -25273.591642871022, -25273.594449459961, 2428.5526011419647, -30.571076407412558, -161.2555588243963, ECLIPSE_TOTAL },
+    { -25095.458130100556, -25095.468146573017, 8068.6623462509679, NAN, NAN, ECLIPSE_PARTIAL },
+    { -24948.314731998147, -24948.304526240761, 9603.1137123825429, NAN, NAN, ECLIPSE_PARTIAL },
+    { -24918.953894888899, -24918.961260291977, 6767.7177175346451, NAN, NAN, ECLIPSE_PARTIAL },
+    { -24771.177168883274, -24771.169372244436, 6164.9757935180278, -60.693776526771316, 133.92701645168222, ECLIPSE_ANNULAR },
+    { -24593.670069790525, -24593.663981812337, 5295.6941793889318, 54.434758972813249, -79.691597208477219, ECLIPSE_TOTAL },
+    { -24416.969135243042, -24416.967457506158, 1392.8899292806191, -20.782133222470428, -2.2306549284688231, ECLIPSE_ANNULAR },
+    { -24239.258000279875, -24239.257316796542, 550.89846631200999, 16.828796270756737, 95.686709324364955, ECLIPSE_ANNULAR },
+    { -24062.469461124645, -24062.472985546665, 3109.6903647817908, 13.295052432992948, 161.57629204921147, ECLIPSE_TOTAL },
+    { -23885.134558116788, -23885.140230982906, 4397.9570111742451, -24.568111549507531, 34.373707356471471, ECLIPSE_ANNULAR },
+    { -23737.277329990276, -23737.266712701356, 9805.8808366494141, NAN, NAN, ECLIPSE_PARTIAL },
+    { -23707.813964202331, -23707.821871318534, 7300.2197259939976, NAN, NAN, ECLIPSE_PARTIAL },
+    { -23560.67702878733, -23560.666665380551, 8686.6680949420424, NAN, NAN, ECLIPSE_PARTIAL },
+    { -23531.102047921158, -23531.113389554568, 9097.5762645599534, NAN, NAN, ECLIPSE_PARTIAL },
+    { -23382.756909197349, -23382.749925504966, 5880.3467903171004, -83.522621100083597, 8.1417939585272396, ECLIPSE_ANNULAR },
+    { -23206.281237561972, -23206.277290018999, 3434.0540888587361, 56.099673703049525, 104.55812799062267, ECLIPSE_TOTAL },
+    { -23028.523896099447, -23028.52185990705, 1584.9504025976953, -37.774466124940773, -172.79766981812793, ECLIPSE_ANNULAR },
+    { -22851.636442672036, -22851.638042256494, 1440.3664631141792, 9.8816270161595945, -130.65602333451506, ECLIPSE_TOTAL },
+    { -22674.533747173711, -22674.537431691137, 2804.8913355870322, 4.0820356824821991, -168.02149070262999, ECLIPSE_ANNULAR },
+    { -22496.916587356453, -22496.923275303889, 6130.3269907234326, -52.822118119349796, -22.141711914303045, ECLIPSE_TOTAL },
+    { -22320.496290284107, -22320.505083534215, 7070.4172019861653, NAN, NAN, ECLIPSE_PARTIAL },
+    { -22171.808556449872, -22171.801296316258, 5984.8304818756969, 73.109278327844422, -129.04484960227734, ECLIPSE_ANNULAR },
+    { -21995.645387605007, -21995.638519892138, 6206.2809564902227, -72.741314314357993, 155.52361219152144, ECLIPSE_TOTAL },
+    { -21817.653401394917, -21817.651592669336, 1393.3817521036017, 19.200500152292904, -128.70382399395311, ECLIPSE_ANNULAR },
+    { -21640.971106324028, -21640.969293027701, 1636.8585817046526, -17.512935630280239, -18.291716694591059, ECLIPSE_TOTAL },
+    { -21463.656672093879, -21463.66082668952, 3208.0435838298176, -26.181055755810448, -111.02862912505296, ECLIPSE_ANNULAR },
+    { -21286.306224409916, -21286.309589547982, 2969.4593290565822, 27.351204917808637, 118.98593299361812, ECLIPSE_TOTAL },
+    { -21109.50655242342, -21109.515703423927, 7599.0694180812552, NAN, NAN, ECLIPSE_PARTIAL },
+    { -20961.396980333608, -20961.385113527002, 9718.1949655760036, NAN, NAN, ECLIPSE_PARTIAL },
+    { -20931.83799455746, -20931.847407525511, 8023.2272709326498, NAN, NAN, ECLIPSE_PARTIAL },
+    { -20784.521170307278, -20784.515045727214, 5567.0022250808161, 43.533512693030843, 174.98552861580615, ECLIPSE_TOTAL },
+    { -20607.328503970042, -20607.321897982896, 5123.0249138055542, -34.748231096897193, 108.41077394059276, ECLIPSE_ANNULAR },
+    { -20429.857816956424, -20429.856374636034, 1287.8207336580481, -7.640142904925229, -50.284975700789118, ECLIPSE_TOTAL },
+    { -20253.261741505106, -20253.26149602743, 194.64940515453139, 19.068233942947646, 95.512169910342863, ECLIPSE_ANNULAR },
+    { -20075.286673486717, -20075.29035039767, 3151.9262363416142, -51.12193401225538, 110.10801638798804, ECLIPSE_ANNULAR },
+    { -19898.933469559805, -19898.938974595778, 4695.6796649095859, 70.045301461208624, -17.355877843938927, ECLIPSE_TOTAL },
+    { -19720.978946672138, -19720.988605539507, 7906.0079216204276, NAN, NAN, ECLIPSE_PARTIAL },
+    { -19573.631993591018, -19573.624625772816, 6827.7348908207514, NAN, NAN, ECLIPSE_PARTIAL },
+    { -19544.32896144002, -19544.338819445456, 9163.7462085477218, NAN, NAN, ECLIPSE_PARTIAL },
+    { -19396.774641568969, -19396.765630164806, 7045.0702682669971, NAN, NAN, ECLIPSE_PARTIAL },
+    { -19218.927625685123, -19218.925088425327, 2245.747364477289, 0.2293191760012141, -21.503102463645327, ECLIPSE_TOTAL },
+    { -19042.665583102895, -19042.662651568724, 2383.8522672276063, 2.9167266053078476, -117.55441804078464, ECLIPSE_ANNULAR },
+    { -18864.395281805508, -18864.398439279612, 2641.2637422872372, 39.864927573358976, 131.03590992357493, ECLIPSE_ANNULAR },
+    { -18688.247818746604, -18688.250408439926, 2246.9728039325441, -33.136918266981858, 76.073477023157579, ECLIPSE_TOTAL },
+    { -18510.164638552335, -18510.174244480688, 7702.3783921485237, NAN, NAN, ECLIPSE_PARTIAL },
+    { -18333.608752800319, -18333.615889703509, 6553.4301539909184, NAN, NAN, ECLIPSE_PARTIAL },
+    { -18185.86062486915, -18185.852620134607, 6366.566304202117, NAN, NAN, ECLIPSE_PARTIAL },
+    { -18008.354564130033, -18008.348022188835, 5675.5657948864282, 54.77110908059435, 172.03477495347565, ECLIPSE_TOTAL },
+    { -17831.631143267248, -17831.629299620789, 1539.0787040424166, -17.649226867189817, -123.70173887819028, ECLIPSE_ANNULAR },
+    { -17653.96511544707, -17653.963882005195, 989.55179717630654, 16.448178833550486, -8.6492973194849014, ECLIPSE_ANNULAR },
+    { -17477.113489452291, -17477.116880184392, 3000.938879408402, 15.671022766811022, 32.49022206263129, ECLIPSE_TOTAL },
+    { -17299.860435174876, -17299.865478942327, 3896.1463900427389, -21.742586602626968, -64.242183709071355, ECLIPSE_ANNULAR },
+    { -17122.450812869301, -17122.458645392569, 7231.6175146806845, NAN, NAN, ECLIPSE_PARTIAL },
+    { -16975.396690108468, -16975.385847192429, 9172.7944242455724, NAN, NAN, ECLIPSE_PARTIAL },
+    { -16945.825948172307, -16945.83665486945, 8577.29970020771, NAN, NAN, ECLIPSE_PARTIAL },
+    { -16797.401438663113, -16797.394377268312, 5924.1744414112818, -79.088314932213336, -121.60476263373876, ECLIPSE_ANNULAR },
+    { -16620.981756242832, -16620.977290048202, 3909.1607232477527, 60.432847466577641, 4.0179440566203084, ECLIPSE_TOTAL },
+    { -16443.184758055246, -16443.182648362534, 1637.0928628262031, -38.35956698500793, 68.029442635230225, ECLIPSE_ANNULAR },
+    { -16266.324815107475, -16266.325899921028, 977.81288625589946, 14.734410094160319, 116.86724830196368, ECLIPSE_TOTAL },
+    { -16089.202935303929, -16089.206518257355, 2726.4801107197404, 2.1324689722865493, 72.022362570240261, ECLIPSE_ANNULAR },
+    { -15911.60440889261, -15911.610657096791, 5701.2149983621684, -40.80942217640397, -140.87481336910969, ECLIPSE_TOTAL },
+    { -15735.157505865252, -15735.166160779143, 6972.5265001593643, NAN, NAN, ECLIPSE_PARTIAL },
+    { -15586.503866649073, -15586.496124032374, 6369.8493261956119, NAN, NAN, ECLIPSE_PARTIAL },
+    { -15410.302832132324, -15410.295781223973, 6387.8583161114911, NAN, NAN, ECLIPSE_PARTIAL },
+    { -15232.358198918877, -15232.355925903912, 1749.6683671023338, 26.46207089207098, 123.38997121416983, ECLIPSE_ANNULAR },
+    { -15055.630274145029, -15055.628191399674, 1877.8094501976714, -23.959156992275794, -142.50189485315013, ECLIPSE_TOTAL },
+    { -14878.354341730701, -14878.358094658461, 2903.8270190824783, -19.15633119445117, 137.4183496631012, ECLIPSE_ANNULAR },
+    { -14700.978178231228, -14700.981241478972, 2688.4666509939289, 20.463464208390356, -1.5592863928739007, ECLIPSE_TOTAL },
+    { -14524.181970874719, -14524.190809887568, 7363.3161721904153, NAN, NAN, ECLIPSE_PARTIAL },
+    { -14346.532554975623, -14346.541662347283, 7694.8408707885283, NAN, NAN, ECLIPSE_PARTIAL },
+    { -14199.159137732613, -14199.15295713675, 5627.9473641865761, 47.309875688348562, 39.91989782034949, ECLIPSE_TOTAL },
+    { -14022.058035517623, -14022.050768984182, 5645.7879159281501, -45.742019401243411, 3.9137012770460728, ECLIPSE_ANNULAR },
+    { -13844.492750204423, -13844.491247492133, 1340.0476069607196, -4.2615748216691163, 177.93866521276371, ECLIPSE_TOTAL },
+    { -13667.983119328925, -13667.982220640823, 715.36262679222534, 12.034400325162629, -5.8637749760101485, ECLIPSE_ANNULAR },
+    { -13489.928795749536, -13489.932456264185, 3126.9229111069999, -48.242673304149896, -15.172575103850363, ECLIPSE_ANNULAR },
+    { -13313.636618379882, -13313.641524214894, 4195.453771257733, 61.743003286600192, -119.66716454131077, ECLIPSE_TOTAL },
+    { -13135.6359897613, -13135.645657324778, 7882.1951873927965, NAN, NAN, ECLIPSE_PARTIAL },
+    { -12988.317477346991, -12988.309668259533, 7262.5911485173356, NAN, NAN, ECLIPSE_PARTIAL },
+    { -12959.019907250051, -12959.029273511653, 8692.6091598644725, NAN, NAN, ECLIPSE_PARTIAL },
+    { -12811.44520001059, -12811.436092889697, 7135.4966313447076, NAN, NAN, ECLIPSE_PARTIAL },
+    { -12633.615877095724, -12633.612832367571, 2690.6284323120112, -2.4230524582952566, -133.9869673677307, ECLIPSE_TOTAL },
+    { -12457.326027090698, -12457.322980438463, 2486.9078511126158, 1.6723495758484468, 119.66636896860604, ECLIPSE_ANNULAR },
+    { -12279.095221855672, -12279.097882954731, 2215.2028274332552, 39.235366126790588, 26.27043435183997, ECLIPSE_ANNULAR },
+    { -12102.897990912677, -12102.900414257843, 2108.1537958293216, -35.650904389811416, -48.306259379573362, ECLIPSE_TOTAL },
+    { -11924.877773542861, -11924.886908139933, 7289.1852680070906, NAN, NAN, ECLIPSE_PARTIAL },
+    { -11748.257725449854, -11748.264682195826, 6384.4555805489499, NAN, NAN, ECLIPSE_PARTIAL },
+    { -11600.549513164809, -11600.541254369575, 6611.0465108296266, NAN, NAN, ECLIPSE_PARTIAL },
+    { -11423.035626455345, -11423.028662471059, 6025.0413589655482, 56.138479884759313, 63.748539306474584, ECLIPSE_TOTAL },
+    { -11246.29724497723, -11246.295195291037, 1721.0194390899121, -14.747295158080835, 116.12864758044734, ECLIPSE_ANNULAR },
+    { -11068.669096398418, -11068.667344060741, 1399.6038987203426, 15.558359566091857, -114.32633022026155, ECLIPSE_ANNULAR },
+    { -10891.761746014443, -10891.764964662874, 2857.4473823311355, 18.199890899356809, -94.851447433214986, ECLIPSE_TOTAL },
+    { -10714.582003676547, -10714.586452393682, 3425.883602962766, -20.328877600639018, -164.21720109118147, ECLIPSE_ANNULAR },
+    { -10537.090943024339, -10537.098678057459, 7140.9111627667562, NAN, NAN, ECLIPSE_PARTIAL },
+    { -10390.114155554824, -10390.102861456311, 9645.8101167404475, NAN, NAN, ECLIPSE_PARTIAL },
+    { -10360.545790300243, -10360.555882023487, 8079.1719375205621, NAN, NAN, ECLIPSE_PARTIAL },
+    { -10212.046479811113, -10212.039342107619, 5968.1286304482755, -74.903988277362515, 106.9934230327074, ECLIPSE_ANNULAR },
+    { -10035.681031822563, -10035.676059766445, 4379.3005034015305, 63.477764913060426, -94.357110081378238, ECLIPSE_TOTAL },
+    { -9857.844959644648, -9857.8427871700551, 1681.3614690735224, -37.803866362627019, -51.3981797779565, ECLIPSE_ANNULAR },
+    { -9681.0143708043161, -9681.0149292623137, 503.88366490805618, 18.810658847541866, 5.4923928923992378, ECLIPSE_TOTAL },
+    { -9503.8695928217021, -9503.8730948349694, 2665.3498748709658, 1.1313331420844028, -48.662447255849145, ECLIPSE_ANNULAR },
+    { -9326.29431050114, -9326.3001005968599, 5258.7743413887274, -32.167462712536647, 103.61206753233068, ECLIPSE_TOTAL },
+    { -9149.8156312110787, -9149.8241656177506, 6892.2619128454908, NAN, NAN, ECLIPSE_PARTIAL },
+    { -9001.2044687414527, -9001.1962044616703, 6787.4286205067301, NAN, NAN, ECLIPSE_PARTIAL },
+    { -8824.9546456797652, -8824.9474527531947, 6531.0224066142946, NAN, NAN, ECLIPSE_PARTIAL },
+    { -8647.0692488562036, -8647.0664545054096, 2150.0886990122576, 33.909231922072493, 18.097326014387676, ECLIPSE_ANNULAR },
+    { -8470.2845894251732, -8470.2822776452995, 2081.4751936104203, -29.961907832211676, 92.150669210078888, ECLIPSE_TOTAL },
+    { -8293.0582206189574, -8293.0615078076044, 2549.4310900576602, -11.97885418026987, 28.110439971672836, ECLIPSE_ANNULAR },
+    { -8115.6449728795124, -8115.647780752749, 2451.3579084143926, 14.164164048397835, -123.68652640782699, ECLIPSE_TOTAL },
+    { -7938.8640060980142, -7938.8724689122737, 7071.80448648114, NAN, NAN, ECLIPSE_PARTIAL },
+    { -7761.2213371733133, -7761.2301843722671, 7413.722428867909, NAN, NAN, ECLIPSE_PARTIAL },
+    { -7613.8015404472344, -7613.7952655003819, 5724.6417621773398, 52.074752908382138, -94.540277839359533, ECLIPSE_TOTAL },
+    { -7436.783944058946, -7436.7760584430471, 6139.1818955276758, -59.457849770390482, -108.56282141317054, ECLIPSE_ANNULAR },
+    { -7259.1309160761493, -7259.1293275171747, 1414.6015855753101, -0.13503948806397789, 46.971113964290623, ECLIPSE_TOTAL },
+    { -7082.7013954121148, -7082.6998725463482, 1217.0235278747748, 4.6191290586064051, -109.05977535287875, ECLIPSE_ANNULAR },
+    { -6904.5733270309438, -6904.5769565773053, 3089.3111961609043, -44.469137192395571, -140.9063276155743, ECLIPSE_ANNULAR },
+    { -6728.3384837931626, -6728.3427977938027, 3698.4283481160473, 53.327938733300286, 133.94082633789819, ECLIPSE_TOTAL },
+    { -6550.293979231601, -6550.303651535075, 7856.2032091953515, NAN, NAN, ECLIPSE_PARTIAL },
+    { -6403.0053488454969, -6402.9970813402015, 7714.9575986390109, NAN, NAN, ECLIPSE_PARTIAL },
+    { -6373.7102860639834, -6373.7191630763537, 8223.0260708834794, NAN, NAN, ECLIPSE_PARTIAL },
+    { -6226.1119362220061, -6226.1027690874807, 7198.4836760754488, NAN, NAN, ECLIPSE_PARTIAL },
+    { -6048.3068634856299, -6048.3032912548078, 3150.9775023167049, -6.1996668275933713, 114.02750126416569, ECLIPSE_TOTAL },
+    { -5871.9816000697519, -5871.9784787813651, 2557.1894914456529, 0.85802170424042512, -4.8964746657534874, ECLIPSE_ANNULAR },
+    { -5693.7996394543361, -5693.8017661858521, 1761.4943946493736, 37.529062894303884, -76.912826268976559, ECLIPSE_ANNULAR },
+    { -5517.5435392758172, -5517.5458344639874, 2001.5543769174303, -37.820441380122865, -173.80758770897151, ECLIPSE_TOTAL },
+    { -5339.5959504100811, -5339.6045648267245, 6840.8373623107054, NAN, NAN, ECLIPSE_PARTIAL },
+    { -5162.9021422375481, -5162.9089566715957, 6250.3576006995318, -68.498111418178027, -143.14962876895146, ECLIPSE_TOTAL },
+    { -5015.2438626622898, -5015.2353048292298, 6898.3495648167336, NAN, NAN, ECLIPSE_PARTIAL },
+    { -4837.7115496888773, -4837.7042115517015, 6330.1641263598112, 59.843679465565472, -37.932748619332756, ECLIPSE_TOTAL },
+    { -4660.9679515030375, -4660.9656516221385, 1942.6155225834077, -12.290986816112699, -2.4676742125991389, ECLIPSE_TOTAL },
+    { -4483.36880293179, -4483.3665747559517, 1772.272767045813, 14.302311125182142, 138.16897702418092, ECLIPSE_ANNULAR },
+    { -4306.4146615357458, -4306.4176669317048, 2676.0340944803584, 20.751774629069818, 139.80432794932636, ECLIPSE_TOTAL },
+    { -4129.2987334132886, -4129.3026272500028, 2991.0408959204938, -20.055543320845846, 94.205159905663734, ECLIPSE_ANNULAR },
+    { -3951.7366290474934, -3951.7442250867298, 7009.4582899496863, NAN, NAN, ECLIPSE_PARTIAL },
+    { -3775.2602600743439, -3775.2697713130929, 7613.2759095495921, NAN, NAN, ECLIPSE_PARTIAL },
+    { -3626.6939324517139, -3626.6867027725448, 6027.0653794352929, -71.023080629843406, -22.791241265351424, ECLIPSE_ANNULAR },
+    { -3450.3785878682506, -3450.3731256247625, 4841.236326057272, 65.139183965161195, 168.63642176406142, ECLIPSE_TOTAL },
+    { -3272.5066346734875, -3272.5043887172792, 1734.6076186200737, -36.326957188921185, -170.61896816613029, ECLIPSE_ANNULAR },
+    { -3095.7037314955987, -3095.7037643370204, 29.662373864744509, 21.97003261507238, -105.34601928521657, ECLIPSE_TOTAL },
+    { -2918.534457917734, -2918.5378916126388, 2615.4023023633658, 1.0434955095573282, -169.90195564224433, ECLIPSE_ANNULAR },
+    { -2740.9870956069039, -2740.9924002042512, 4795.0521556169324, -25.201918303749412, -9.6252973298628461, ECLIPSE_TOTAL },
+    { -2564.4697418760552, -2564.4781830082693, 6836.8533087086253, NAN, NAN, ECLIPSE_PARTIAL },
+    { -2415.9116767210212, -2415.9028402520198, 7248.4839855392283, NAN, NAN, ECLIPSE_PARTIAL },
+    { -2239.6007871663278, -2239.5934927878125, 6635.823578508307, NAN, NAN, ECLIPSE_PARTIAL },
+    { -2061.7866022387807, -2061.7832287043461, 2595.9950730000478, 41.495491961185799, -84.280326235233758, ECLIPSE_ANNULAR },
+    { -1884.9333161540771, -1884.9308222715642, 2242.1756448158039, -35.321405172363455, -34.336306319855339, ECLIPSE_TOTAL },
+    { -1707.7658811695512, -1707.7686618185173, 2162.3547048568921, -4.8967399115442607, -79.581368175831443, ECLIPSE_ANNULAR },
+    { -1530.3077618530954, -1530.310349167298, 2247.2660895053818, 8.441565564768311, 113.04746375817274, ECLIPSE_TOTAL },
+    { -1353.5490188803146, -1353.55707425728, 6752.1601008436473, NAN, NAN, ECLIPSE_PARTIAL },
+    { -1175.9061748894896, -1175.9147910855258, 7164.4007944448958, NAN, NAN, ECLIPSE_PARTIAL },
+    { -1028.4478433030843, -1028.4414402483062, 5852.997849960303, 57.704276346889102, 130.65078809158376, ECLIPSE_TOTAL },
+    { -851.50535763482458, -851.49690054975576, 6598.3571207671139, NAN, NAN, ECLIPSE_PARTIAL },
+    { -673.7732350022294, -673.77152566713357, 1519.8404718847978, 4.6790167763683881, -82.850533047070428, ECLIPSE_TOTAL },
+    { -497.41406636049231, -497.41197071332505, 1681.4425911549097, -2.9353412967682386, 145.24481264602352, ECLIPSE_ANNULAR },
+    { -319.22264478194757, -319.22620515336746, 3018.8730360117393, -39.861251447841241, 93.74156165737287, ECLIPSE_ANNULAR },
+    { -143.03537105624221, -143.03913406744257, 3233.7151794744786, 45.122968870685341, 24.185665605328623, ECLIPSE_TOTAL },
+    { 35.044462056570453, 35.034813404513557, 7806.8533954964514, NAN, NAN, ECLIPSE_PARTIAL },
+    { 182.30588052096132, 182.31461248434536, 8173.9955941432372, NAN, NAN, ECLIPSE_PARTIAL },
+    { 211.60118377002456, 211.5927850292135, 7763.9447874288908, NAN, NAN, ECLIPSE_PARTIAL },
+    { 359.22382415193601, 359.23302967439281, 7245.3573776031262, NAN, NAN, ECLIPSE_PARTIAL },
+    { 536.99886125039279, 537.00298881298988, 3633.2917716381635, -11.220159381282903, 2.5983462441482317, ECLIPSE_TOTAL },
+    { 713.36670221250188, 713.36986859983028, 2603.5404460735431, 0.59417333441390585, -130.86814586981589, ECLIPSE_ANNULAR },
+    { 891.49107425431703, 891.48952643953544, 1275.2759599515928, 34.585618817753037, -178.77731575356853, ECLIPSE_ANNULAR },
+    { 1067.8159358765458, 1067.8137277568865, 1930.1098583660955, -39.491252271235567, 59.403778169749046, ECLIPSE_TOTAL },
+    { 1245.6809781205056, 1245.6729338940477, 6356.5800724342425, 65.863558032268514, -25.853843269113554, ECLIPSE_ANNULAR },
+    { 1422.4580288223972, 1422.451319166541, 6150.8371853912713, -72.623222836230212, 87.853150815236063, ECLIPSE_TOTAL },
+    { 1570.0568854807491, 1570.0657824158186, 7225.3797602655013, NAN, NAN, ECLIPSE_PARTIAL },
+    { 1747.6172861094819, 1747.6249561639167, 6595.753721024681, NAN, NAN, ECLIPSE_PARTIAL },
+    { 1924.3559941239714, 1924.3585958676547, 2211.1627825802775, -10.529319088369009, -119.15342758890145, ECLIPSE_TOTAL },
+    { 2101.9365395807995, 2101.9391940453529, 2102.8683040403371, 12.840566907202247, 28.530789465496241, ECLIPSE_ANNULAR },
+    { 2278.9277117478332, 2278.9249618585459, 2455.4506411759999, 23.188967243556217, 16.567418330969019, ECLIPSE_TOTAL },
+    { 2455.9901192239654, 2455.9867322715709, 2596.2796284670153, -20.692496252862277, -9.2774880810912066, ECLIPSE_ANNULAR },
+    { 2633.6133109906714, 2633.605885066755, 6846.9992205150202, NAN, NAN, ECLIPSE_PARTIAL },
+    { 2810.0312140408073, 2810.0222429500805, 7183.4653014706255, NAN, NAN, ECLIPSE_PARTIAL },
+    { 2958.6564023785008, 2958.6637383321354, 6099.3080047181156, -67.578003683932209, -151.05885394513703, ECLIPSE_ANNULAR },
+    { 3134.9257759346306, 3134.9317121486961, 5294.5209972244356, 65.615663042482069, 72.039865566170178, ECLIPSE_TOTAL },
+    { 3312.8305921277097, 3312.8329192299243, 1794.3167439969736, -34.036640490509576, 70.030215690074897, ECLIPSE_ANNULAR },
+    { 3489.6077203452965, 3489.6082077931324, 440.65937340488415, 24.181221527864331, 143.98089855311198, ECLIPSE_TOTAL },
+    { 3666.8001045977799, 3666.7967509247219, 2557.8371436940679, 1.6777473178211555, 69.088511367161232, ECLIPSE_ANNULAR },
+    { 3844.3201530286619, 3844.3153361584718, 4333.7147891402974, -19.801226858353029, -122.02390336080154, ECLIPSE_TOTAL },
+    { 4020.8773004819323, 4020.8689532874628, 6783.7360680563806, NAN, NAN, ECLIPSE_PARTIAL },
+    { 4169.3772993982939, 4169.3867324635303, 7731.3308649527462, NAN, NAN, ECLIPSE_PARTIAL },
+    { 4198.8712339932117, 4198.8604482154897, 9519.8998032444906, NAN, NAN, ECLIPSE_PARTIAL },
+    { 4345.7571068024226, 4345.7644759173245, 6715.9824388083889, NAN, NAN, ECLIPSE_PARTIAL },
+    { 4523.4915234753998, 4523.4955161748894, 3074.2548940876441, 49.044660857645646, 176.10286164356253, ECLIPSE_ANNULAR },
+    { 4700.4226295260451, 4700.4252672581097, 2368.0331730410862, -39.920316139183058, -161.46465955577156, ECLIPSE_TOTAL },
+    { 4877.5202405045802, 4877.5180320148347, 1722.6606655492033, 2.1795023368653306, 175.29174019180692, ECLIPSE_ANNULAR },
+    { 5055.0351331805205, 5055.0327152264699, 2090.014109459456, 3.5207662536504607, -11.844028794169162, ECLIPSE_TOTAL },
+    { 5231.7604120618053, 5231.7528209022039, 6382.7200463378977, NAN, NAN, ECLIPSE_PARTIAL },
+    { 5409.4148123385812, 5409.4063809117943, 6961.1736425286381, NAN, NAN, ECLIPSE_PARTIAL },
+    { 5556.9005457153489, 5556.9071226119158, 6024.7855077209042, 64.336472849694587, -6.5711170761916264, ECLIPSE_TOTAL },
+    { 5733.7791535661108, 5733.7881223323157, 7013.3240387864407, NAN, NAN, ECLIPSE_PARTIAL },
+    { 5911.5799302392161, 5911.5817981776554, 1658.2052064381205, 10.070533858074747, 148.66606240438495, ECLIPSE_TOTAL },
+    { 6087.8776043119142, 6087.8802347789961, 2119.0409142180024, -10.637999909959449, 37.619248332234278, ECLIPSE_ANNULAR },
+    { 6266.1243458795816, 6266.120882279828, 2925.3299802373544, -34.728868712824365, -31.329336746000415, ECLIPSE_ANNULAR },
+    { 6442.2713773014993, 6442.2681379179066, 2790.0374664951446, 37.008289713277676, -87.795274872242544, ECLIPSE_TOTAL },
+    { 6620.3791126461774, 6620.3695186159221, 7732.727387004019, NAN, NAN, ECLIPSE_PARTIAL },
+    { 6767.6169453913444, 6767.6261424553404, 8633.70432231821, NAN, NAN, ECLIPSE_PARTIAL },
+    { 6796.9154765499306, 6796.9075367804417, 7323.5465077200051, NAN, NAN, ECLIPSE_PARTIAL },
+    { 6944.5617590368238, 6944.570983715581, 7278.2012761616697, NAN, NAN, ECLIPSE_PARTIAL },
+    { 7122.3033165543193, 7122.3080081163816, 4120.291951289767, -17.346972833112151, -109.13573219287875, ECLIPSE_TOTAL },
+    { 7298.717881503896, 7298.7210724421748, 2632.9670431803524, 0.96484945073347228, 102.09574010419243, ECLIPSE_ANNULAR },
+    { 7476.7792312611837, 7476.7782851437005, 775.39297643782004, 30.558190817299682, 79.508992376452909, ECLIPSE_ANNULAR },
+    { 7653.1785664168237, 7653.1764208786599, 1879.4812747793944, -40.379500044160608, -68.099867747453573, ECLIPSE_TOTAL },
+    { 7830.9537116648553, 7830.9462826144227, 5841.6911068043964, 80.816523622405057, -67.608947314419581, ECLIPSE_ANNULAR },
+    { 8007.8219574661107, 8007.8153207041478, 6080.3876291011229, -76.719806203207611, -46.926290653683168, ECLIPSE_TOTAL },
+    { 8155.3533122425615, 8155.3625814041588, 7587.0829400136108, NAN, NAN, ECLIPSE_PARTIAL },
+    { 8332.9508608192118, 8332.958819984462, 6821.533532445841, NAN, NAN, ECLIPSE_PARTIAL },
+    { 8509.6757667492657, 8509.6787093611001, 2516.3719872912889, -9.5574669318561831, 125.6196884705229, ECLIPSE_TOTAL },
+    { 8687.2470869439076, 8687.2501152051755, 2389.8500625432252, 11.330277898031554, -83.285899537071714, ECLIPSE_ANNULAR },
+    { 8864.2648747666408, 8864.2624260596895, 2192.1777763891591, 25.321785926297149, -104.30133592318975, ECLIPSE_TOTAL },
+    { 9041.2846574579144, 9041.2817266666334, 2242.8979570272795, -21.996337117959712, -114.69538587852864, ECLIPSE_ANNULAR },
+    { 9218.9572173611141, 9218.950006033012, 6640.4753350661476, NAN, NAN, ECLIPSE_PARTIAL },
+    { 9395.3296835422389, 9395.3211993924815, 6798.8319444827757, NAN, NAN, ECLIPSE_PARTIAL },
+    { 9544.0012462948307, 9544.0087325248696, 6209.9059598746835, -64.720967213666484, 86.169999729941026, ECLIPSE_ANNULAR },
+    { 9720.2341623681423, 9720.2405384137855, 5721.3979286469312, 65.186742306284231, -25.553597664481117, ECLIPSE_TOTAL },
+    { 9898.1644388719997, 9898.1668765235609, 1877.4242157391323, -31.257253964213202, -48.665321815615712, ECLIPSE_ANNULAR },
+    { 10074.920628625847, 10074.921624606319, 901.17530995284449, 25.457681022030407, 33.040111548797313, ECLIPSE_TOTAL },
+    { 10252.134141051958, 10252.130877432306, 2493.7966139790501, 3.0117187807197179, -51.747019856171221, ECLIPSE_ANNULAR },
+    { 10429.626537271108, 10429.622218279896, 3867.4355953502036, -15.634159804609032, 126.55529023425862, ECLIPSE_TOTAL },
+    { 10606.225742314185, 10606.21748510965, 6736.2078564106168, NAN, NAN, ECLIPSE_PARTIAL },
+    { 10754.660491755374, 10754.670561516257, 8250.5753413955845, NAN, NAN, ECLIPSE_PARTIAL },
+    { 10784.160853667961, 10784.150496576873, 9056.2139386847066, NAN, NAN, ECLIPSE_PARTIAL },
+    { 10931.119853528369, 10931.127262004798, 6762.9541847715973, NAN, NAN, ECLIPSE_PARTIAL },
+    { 11108.765286730362, 11108.769934767151, 3583.076125159133, 56.465966536398327, 79.896534342763687, ECLIPSE_ANNULAR },
+    { 11285.782607325917, 11285.78535488602, 2463.1031582693117, -43.579167018653301, 71.10705150440964, ECLIPSE_TOTAL },
+    { 11462.804074000507, 11462.80246240327, 1261.4242037170493, 8.8817670570628735, 71.558572723835709, ECLIPSE_ANNULAR },
+    { 11640.382037768682, 11640.379752107341, 1966.6469486371325, -0.59898129867625627, -137.77893712217536, ECLIPSE_TOTAL },
+    { 11817.066843247179, 11817.059748180813, 5984.5011807459969, -51.389760497779648, -7.1589126512020869, ECLIPSE_ANNULAR },
+    { 11994.739946507812, 11994.73166628049, 6791.8880874854767, NAN, NAN, ECLIPSE_PARTIAL },
+    { 12142.24449299972, 12142.251279512249, 6231.1010559141587, 71.229698753113993, -155.26350821143663, ECLIPSE_TOTAL },
+    { 12319.069699642436, 12319.07911913104, 7383.0133980095452, NAN, NAN, ECLIPSE_PARTIAL },
+    { 12496.927126037288, 12496.929202816871, 1840.5309766815642, 16.009668716398387, 22.099938692598471, ECLIPSE_TOTAL },
+    { 12673.176592056439, 12673.179689938806, 2505.4848347544671, -18.20019003868202, -72.74347045584426, ECLIPSE_ANNULAR },
+    { 12851.465245671343, 12851.461928119657, 2790.5102645952297, -29.083936913828062, -155.08309350520676, ECLIPSE_ANNULAR },
+    { 13027.583308779153, 13027.580549980477, 2381.30616728836, 29.127841000987189, 157.91126880456127, ECLIPSE_TOTAL },
+    { 13205.708257779799, 13205.698764017912, 7621.7137687383965, NAN, NAN, ECLIPSE_PARTIAL },
+    { 13352.928732929471, 13352.93838780913, 9086.0625303848847, NAN, NAN, ECLIPSE_PARTIAL },
+    { 13382.233145327427, 13382.225639791064, 6907.3613145628988, NAN, NAN, ECLIPSE_PARTIAL },
+    { 13529.89926513108, 13529.9085120739, 7315.7752948431335, NAN, NAN, ECLIPSE_PARTIAL },
+    { 13707.605736649437, 13707.611008028574, 4617.8461545882219, -24.716827066729998, 138.92449432144542, ECLIPSE_TOTAL },
+    { 13884.070736807225, 13884.073941402874, 2653.6060126792972, 2.0416327970710255, -25.607696811663402, ECLIPSE_ANNULAR },
+    { 14062.064354671447, 14062.064037548116, 258.49403934958883, 25.467916108599535, -22.056772114239649, ECLIPSE_ANNULAR },
+    { 14238.543355183228, 14238.541255465674, 1843.1228749622628, -40.328770279680263, 163.79201136671821, ECLIPSE_TOTAL },
+    { 14416.223592819471, 14416.216811598659, 5306.5556726516952, 78.951892247340908, -102.47497650112852, ECLIPSE_ANNULAR },
+    { 14593.189188099768, 14593.182594566611, 6036.9469571675991, -80.784959465627253, 171.92533016740654, ECLIPSE_TOTAL },
+    { 14740.64471218902, 14740.654390451926, 7988.2756042191886, NAN, NAN, ECLIPSE_PARTIAL },
+    { 14918.28918187831, 14918.2973869614, 7006.9120115129781, NAN, NAN, ECLIPSE_PARTIAL },
+    { 15094.990785081749, 15094.994111630935, 2862.6243988487181, -9.5959583699335518, 12.033556798665686, ECLIPSE_TOTAL },
+    { 15272.563067776249, 15272.566414297075, 2631.1499466756622, 9.8863651908925405, 162.66370016037479, ECLIPSE_ANNULAR },
+    { 15449.597062626824, 15449.594957728461, 1888.7720931753693, 26.983973312423512, 137.13024595574825, ECLIPSE_TOTAL },
+    { 15626.585860960173, 15626.583324077843, 1938.8621852003325, -23.797581284393221, 137.60836418200282, ECLIPSE_ANNULAR },
+    { 15804.296522033397, 15804.2895566267, 6402.7624387381384, NAN, NAN, ECLIPSE_PARTIAL },
+    { 15980.633766279469, 15980.625727014783, 6449.4277927981329, NAN, NAN, ECLIPSE_PARTIAL },
+    { 16129.342240752274, 16129.349904774483, 6344.3060319085544, -62.271196882340476, -26.957270222071685, ECLIPSE_ANNULAR },
+    { 16305.546085510381, 16305.552872260852, 6125.9042593306258, 64.314106003531862, -121.00737140470341, ECLIPSE_TOTAL },
+    { 16483.494195297953, 16483.496779471679, 1988.810233314862, -28.215984775856928, -166.39959746673327, ECLIPSE_ANNULAR },
+    { 16660.235839191304, 16660.237324015496, 1344.5231168635926, 25.864963908840426, -78.699412094126501, ECLIPSE_TOTAL },
+    { 16837.465436902912, 16837.462294712208, 2406.5688593985269, 4.8281012773438841, -171.59795515837055, ECLIPSE_ANNULAR },
+    { 17014.934583470265, 17014.930749093404, 3417.586047724652, -12.785775072444791, 15.023062321083813, ECLIPSE_TOTAL },
+    { 17191.572385172869, 17191.564243077886, 6669.7259683615621, NAN, NAN, ECLIPSE_PARTIAL },
+    { 17339.941867707897, 17339.952576516978, 8774.9291112187784, NAN, NAN, ECLIPSE_PARTIAL },
+    { 17369.45121315273, 17369.441287004269, 8601.4065553912387, NAN, NAN, ECLIPSE_PARTIAL },
+    { 17516.485120555164, 17516.492551858719, 6795.1885377106764, NAN, NAN, ECLIPSE_PARTIAL },
+    { 17694.035024355737, 17694.040359349085, 4119.9038285386723, 63.620690395207994, -11.699151092224653, ECLIPSE_ANNULAR },
+    { 17871.146194737754, 17871.149020827826, 2530.0776563874101, -46.09516587164056, -56.530842001859583, ECLIPSE_TOTAL },
+    { 18048.083707902224, 18048.082736488341, 763.311252218454, 15.253778471970888, -30.019021095431938, ECLIPSE_ANNULAR },
+    { 18225.733363623203, 18225.731168157705, 1881.0943475757424, -3.7652828783585126, 95.099860440832742, ECLIPSE_TOTAL },
+    { 18402.368982490687, 18402.362427959542, 5546.490031909304, -40.187351815165904, -123.84713707008569, ECLIPSE_TOTAL },
+    { 18580.07071698724, 18580.062540183309, 6668.3195660261545, NAN, NAN, ECLIPSE_PARTIAL },
+    { 18727.582996273613, 18727.590036043013, 6480.0579095806806, NAN, NAN, ECLIPSE_PARTIAL },
+    { 18904.366155962711, 18904.375967449887, 7708.8344987417295, NAN, NAN, ECLIPSE_PARTIAL },
+    { 19082.269104236882, 19082.271431941364, 2059.4598415826595, 22.326965059723619, -102.65699410063743, ECLIPSE_TOTAL },
+    { 19258.481352021645, 19258.484865698207, 2853.0088075432345, -25.646217302022212, 174.83831908275332, ECLIPSE_ANNULAR },
+    { 19436.799927683325, 19436.796806688595, 2614.180340719271, -23.067880151244793, 82.800267502103452, ECLIPSE_ANNULAR },
+    { 19612.900308634307, 19612.897988391127, 2006.9546192316, 21.506123943634115, 41.585046681779772, ECLIPSE_TOTAL },
+    { 19791.032104113867, 19791.022755183101, 7475.788829504374, NAN, NAN, ECLIPSE_PARTIAL },
+    { 19938.241857191275, 19938.251958015764, 9525.9094758548199, NAN, NAN, ECLIPSE_PARTIAL },
+    { 19967.554583958226, 19967.547484110917, 6519.1890088248883, NAN, NAN, ECLIPSE_PARTIAL },
+    { 20115.235936021305, 20115.245211306868, 7360.4562446210275, NAN, NAN, ECLIPSE_PARTIAL },
+    { 20292.908537416606, 20292.914380923554, 5105.1878951109202, -33.209507602444631, 25.6557942951857, ECLIPSE_TOTAL },
+    { 20469.424327266701, 20469.427542206919, 2671.6110056647171, 3.8499529092676941, -153.6851449262461, ECLIPSE_ANNULAR },
+    { 20647.347499869949, 20647.347828503625, 266.43603192758229, 19.487618863244887, -123.88716241919711, ECLIPSE_ANNULAR },
+    { 20823.909495517182, 20823.907430314619, 1816.2995026023666, -39.279198258058365, 35.045856471108323, ECLIPSE_TOTAL },
+    { 21001.491643687354, 21001.485533425672, 4759.3951891211909, 71.553554870414885, -176.38012224621019, ECLIPSE_ANNULAR },
+    { 21178.557510067716, 21178.550947746211, 6003.8125037685841, -84.74280751729853, 20.672483132448008, ECLIPSE_TOTAL },
+    { 21325.93313909549, 21325.943243708392, 8412.2779696931757, NAN, NAN, ECLIPSE_PARTIAL },
+    { 21355.524619026033, 21355.512815020535, 9488.01668801909, NAN, NAN, ECLIPSE_PARTIAL },
+    { 21503.631766860635, 21503.640177158708, 7154.6135970999603, NAN, NAN, ECLIPSE_PARTIAL },
+    { 21680.302522181792, 21680.30626012932, 3236.7314044672034, -10.685142605060546, -100.55853384855288, ECLIPSE_TOTAL },
+    { 21857.883247903144, 21857.886867412202, 2835.4734109396309, 8.6904080381532545, 46.885103090403845, ECLIPSE_ANNULAR },
+    { 22034.924449922655, 22034.922728324978, 1547.9365061758397, 27.987060100365795, 20.747077971610047, ECLIPSE_TOTAL },
+    { 22211.893188164831, 22211.890986163344, 1681.2183816987117, -25.846687198109837, 27.899218300138159, ECLIPSE_ANNULAR },
+    { 22389.628557424996, 22389.621891589872, 6112.6130288364875, 64.552592813516597, 58.708285210651468, ECLIPSE_TOTAL },
+    { 22565.945796131331, 22565.938134333897, 6155.2421868561805, -62.184846422482558, -55.085793654933809, ECLIPSE_ANNULAR },
+    { 22714.676123598241, 22714.684021638204, 6526.5456393621143, NAN, NAN, ECLIPSE_PARTIAL },
+    { 22890.862978974703, 22890.870135148194, 6494.9594214332965, NAN, NAN, ECLIPSE_PARTIAL },
+    { 23068.818203848892, 23068.82098490914, 2139.6387797965317, -25.199456039457107, 77.550198193504002, ECLIPSE_ANNULAR },
+    { 23245.554088280172, 23245.556034040354, 1762.9665853841234, 25.520569891785961, 168.28714224027919, ECLIPSE_TOTAL },
+    { 23422.794042800335, 23422.791050347703, 2298.2024472976477, 7.0723590514222572, 69.538816189366855, ECLIPSE_ANNULAR },
+    { 23600.242688742852, 23600.239338708052, 2971.9421828644759, -10.976300164562815, -96.138631736186682, ECLIPSE_TOTAL },
+    { 23776.918449065797, 23776.910431979657, 6596.2659118533811, NAN, NAN, ECLIPSE_PARTIAL },
+    { 23925.219514864097, 23925.230879144048, 9317.682044025396, NAN, NAN, ECLIPSE_PARTIAL },
+    { 23954.740637725095, 23954.73115620836, 8143.82196254059, NAN, NAN, ECLIPSE_PARTIAL },
+    { 24101.852593508422, 24101.860030933276, 6812.3027177807198, NAN, NAN, ECLIPSE_PARTIAL },
+    { 24279.302580785978, 24279.308612508219, 4669.0658844082564, 70.056550562964247, -96.602964736393574, ECLIPSE_ANNULAR },
+    { 24456.512463232273, 24456.515341994782, 2574.015660415102, -47.323158445970364, 175.63814987433977, ECLIPSE_TOTAL },
+    { 24633.362131392572, 24633.361810568589, 253.19977988770742, 20.980949834468543, -130.35505584359655, ECLIPSE_ANNULAR },
+    { 24811.086963202964, 24811.084833122673, 1817.9026318188371, -6.0127684952509002, -32.523644663484674, ECLIPSE_TOTAL },
+    { 24987.669232280918, 24987.66323794036, 5089.6485439225662, -31.102816657465436, 123.08927904168286, ECLIPSE_TOTAL },
+    { 25165.404630732235, 25165.39652914217, 6572.8871919269368, NAN, NAN, ECLIPSE_PARTIAL },
+    { 25312.91593242728, 25312.923267454953, 6770.7313687940823, NAN, NAN, ECLIPSE_PARTIAL },
+    { 25342.254435075411, 25342.244215585015, 9478.1017160231149, NAN, NAN, ECLIPSE_PARTIAL },
+    { 25489.669311331145, 25489.67944774932, 7983.9627824791096, NAN, NAN, ECLIPSE_PARTIAL },
+    { 25667.604659339635, 25667.60728983787, 2323.4571670678929, 29.000459813530792, 134.94690635275677, ECLIPSE_TOTAL },
+    { 25843.79285523334, 25843.796722729498, 3152.7265077389757, -32.809986081253129, 60.273494061354086, ECLIPSE_ANNULAR },
+    { 26022.127518386846, 26022.124651730082, 2390.7651553840583, -16.749030087736671, -37.145168068228372, ECLIPSE_ANNULAR },
+    { 26198.223254061104, 26198.221320803197, 1675.6659920171464, 14.264256839923283, -76.863623360012411, ECLIPSE_TOTAL },
+    { 26376.348674939614, 26376.33953326592, 7280.7001251032198, NAN, NAN, ECLIPSE_PARTIAL },
+    { 26552.880004461967, 26552.873278726805, 6161.7955438183017, 69.834493278162526, 102.19736779160485, ECLIPSE_TOTAL },
+    { 26700.570045462577, 26700.579368952436, 7424.405155722362, NAN, NAN, ECLIPSE_PARTIAL },
+    { 26878.211358174955, 26878.217769398401, 5584.9895482204565, -43.171198283760184, -89.512128656611324, ECLIPSE_TOTAL },
+    { 27054.776280855036, 27054.779523862038, 2704.8906263520216, 6.5007485839357857, 78.639327828607293, ECLIPSE_ANNULAR },
+    { 27232.630137266595, 27232.631113620206, 787.34078380860512, 12.826311069160935, 133.5704289986632, ECLIPSE_ANNULAR },
+    { 27409.275779172287, 27409.273747075669, 1790.4376064579717, -37.221915701836636, -94.220933701595129, ECLIPSE_TOTAL },
+    { 27586.758190728273, 27586.752771444331, 4202.6468151621448, 63.172527750526221, 95.046893001141939, ECLIPSE_ANNULAR },
+    { 27763.927048946131, 27763.920502886118, 5983.7468448099316, -87.044357292964236, -172.80267299150938, ECLIPSE_TOTAL },
+    { 27911.218298099742, 27911.228847073718, 8861.2108158585179, NAN, NAN, ECLIPSE_PARTIAL },
+    { 27940.795117291414, 27940.783979119296, 8935.9514123120243, NAN, NAN, ECLIPSE_PARTIAL },
+    { 28088.97832980645, 28088.986906669994, 7266.5923714988348, NAN, NAN, ECLIPSE_PARTIAL },
+    { 28265.60982093748, 28265.614008223034, 3648.5227363244362, -13.073767714867868, 148.16610405567405, ECLIPSE_TOTAL },
+    { 28443.208757265504, 28443.212593000473, 2994.1206811037259, 7.7277746908339076, -71.012621472988371, ECLIPSE_ANNULAR },
+    { 28620.247786750511, 28620.2464813365, 1175.7125486655609, 28.17166968342061, -93.863323227880215, ECLIPSE_TOTAL },
+    { 28797.206027447613, 28797.2041071895, 1464.9512962463418, -27.893257309114677, -83.526455769463723, ECLIPSE_ANNULAR },
+    { 28974.956476891268, 28974.950137672469, 5796.2249294517696, 66.198584220360758, -46.696819297684357, ECLIPSE_TOTAL },
+    { 29151.26387524962, 29151.256541309631, 5901.3841322421231, -63.460585969803674, -161.04587661043479, ECLIPSE_ANNULAR },
+    { 29300.004527579888, 29300.012700752708, 6743.4163970347081, NAN, NAN, ECLIPSE_PARTIAL },
+    { 29476.18421696949, 29476.191709169747, 6834.8759416461335, NAN, NAN, ECLIPSE_PARTIAL },
+    { 29654.136957613275, 29654.139981813474, 2326.6531297976148, -22.367998727029093, -36.900188308653711, ECLIPSE_ANNULAR },
+    { 29830.876300821521, 29830.878672600073, 2149.8173348491614, 24.583931385464648, 53.508877365284718, ECLIPSE_TOTAL },
+    { 30008.117366480281, 30008.114578544479, 2147.648522173643, 9.4604660528582514, -47.29996195572852, ECLIPSE_ANNULAR },
+    { 30185.554403248578, 30185.55150540359, 2559.0628124725595, -10.329586088156436, 151.6154386711253, ECLIPSE_TOTAL },
+    { 30362.261052969745, 30362.253198137631, 6492.1051314579026, NAN, NAN, ECLIPSE_PARTIAL },
+    { 30510.496554573685, 30510.508563533505, 9856.1856909269572, NAN, NAN, ECLIPSE_PARTIAL },
+    { 30540.031676147722, 30540.022633230801, 7701.7380722867683, NAN, NAN, ECLIPSE_PARTIAL },
+    { 30687.220483761786, 30687.227926543164, 6829.6922354024564, NAN, NAN, ECLIPSE_PARTIAL },
+    { 30864.568521856399, 30864.57525572231, 5228.0103417595956, 74.924245129043797, -169.51013565078048, ECLIPSE_ANNULAR },
+    { 31041.880108969472, 31041.883027692231, 2606.9104568766938, -47.278328599764059, 47.546946243818297, ECLIPSE_TOTAL },
+    { 31218.637928844728, 31218.638284721506, 282.2179403153749, 26.093431787216165, 131.09664040202, ECLIPSE_ANNULAR },
+    { 31396.443496825392, 31396.441402200682, 1781.3118261100435, -7.2199738123580515, -160.9647418146339, ECLIPSE_ANNULAR },
+    { 31572.967181429925, 31572.961773194293, 4608.1570243712458, -23.284130266805612, 12.334642419419779, ECLIPSE_TOTAL },
+    { 31750.741932333167, 31750.733877023944, 6505.8950668024027, NAN, NAN, ECLIPSE_PARTIAL },
+    { 31898.244007393783, 31898.251674516832, 7098.8842366788622, NAN, NAN, ECLIPSE_PARTIAL },
+    { 31927.568763906082, 31927.558997519889, 9053.5803820829969, NAN, NAN, ECLIPSE_PARTIAL },
+    { 32074.979018793056, 32074.98941758498, 8211.6944689368265, NAN, NAN, ECLIPSE_PARTIAL },
+    { 32252.934175255901, 32252.937158421591, 2630.7211778973933, 35.935708087938586, 14.97551974187863, ECLIPSE_TOTAL },
+    { 32429.110964284253, 32429.115127916422, 3407.4736211920767, -39.615082964374224, -56.132764607283605, ECLIPSE_ANNULAR },
+    { 32607.448711307556, 32607.446152814049, 2124.5028848910756, -10.266399154749678, -154.9306725303598, ECLIPSE_ANNULAR },
+    { 32783.552248600186, 32783.550651813581, 1386.8628824708171, 7.4632110165749674, 162.67429206547453, ECLIPSE_TOTAL },
+    { 32961.658779100486, 32961.649902736659, 7040.9702418567285, NAN, NAN, ECLIPSE_PARTIAL },
+    { 33138.210627664776, 33138.204235118181, 5844.2125639830701, 60.752064629172828, -40.491825586284222, ECLIPSE_TOTAL },
+    { 33285.901941915734, 33285.911331494113, 7506.0835637387727, NAN, NAN, ECLIPSE_PARTIAL },
+    { 33463.51545812461, 33463.522422395974, 6048.4856362041974, -55.471163539860591, 150.41424143323871, ECLIPSE_TOTAL },
+    { 33640.127184001438, 33640.1304677015, 2749.2157209135044, 9.8669216181241453, -48.856979757881454, ECLIPSE_ANNULAR },
+    { 33817.913040239007, 33817.914660197064, 1299.5564443141357, 5.6225360205709389, 30.157326298139637, ECLIPSE_ANNULAR },
+    { 33994.640681511395, 33994.638695996066, 1752.4530968773679, -34.181443323999915, 136.28743561184734, ECLIPSE_TOTAL },
+    { 34172.025275153697, 34172.020548464978, 3650.6045864784846, 54.608246462482192, 1.1984102205282454, ECLIPSE_ANNULAR },
+    { 34349.295781938694, 34349.289255463664, 5959.6971965884377, -84.759702783928574, -8.8381103919788515, ECLIPSE_TOTAL },
+    { 34496.502689378445, 34496.51368074202, 9316.980723189643, NAN, NAN, ECLIPSE_PARTIAL },
+    { 34526.067502925565, 34526.057026607108, 8391.4898239239592, NAN, NAN, ECLIPSE_PARTIAL },
+    { 34674.326952962358, 34674.335675444767, 7358.8349503168156, NAN, NAN, ECLIPSE_PARTIAL },
+    { 34850.915524860589, 34850.920173807543, 4075.496053269494, -16.659813561545686, 37.005022237374561, ECLIPSE_TOTAL },
+    { 35028.538009811789, 35028.542021045643, 3120.2763681254587, 7.1706084830241066, 169.60260619799496, ECLIPSE_ANNULAR },
+    { 35205.566541116183, 35205.565691344171, 766.36304274090685, 27.298997542110008, 153.28502435776113, ECLIPSE_TOTAL },
+    { 35382.525134329946, 35382.523435505565, 1295.3221260582682, -29.794684989336027, 163.08840351628677, ECLIPSE_ANNULAR },
+    { 35560.278086193124, 35560.272121821159, 5434.0587585142885, 67.438648032730811, -149.77025704425293, ECLIPSE_TOTAL },
+    { 35736.589571817654, 35736.582500906399, 5700.1725552822072, -65.822962595224823, 86.30890202398092, ECLIPSE_ANNULAR },
+    { 35885.324749471831, 35885.333264744397, 7016.2987116689228, NAN, NAN, ECLIPSE_PARTIAL },
+    { 36061.511975634188, 36061.519754225352, 7128.2789000463117, NAN, NAN, ECLIPSE_PARTIAL },
+    { 36090.950906531572, 36090.939871045972, 9832.7562930616714, NAN, NAN, ECLIPSE_PARTIAL },
+    { 36239.449405964573, 36239.452730128593, 2558.2160555541072, -19.988725646297198, -149.2478563830054, ECLIPSE_ANNULAR },
+    { 36416.202098723537, 36416.204866529821, 2509.0873808348947, 23.316276681800279, -62.954513082556844, ECLIPSE_TOTAL },
+    { 36593.436961105697, 36593.434416615812, 1966.6800308872607, 11.992379979651357, -162.6367904181397, ECLIPSE_ANNULAR },
+    { 36770.868086126291, 36770.865623727637, 2164.4832388842715, -10.523106313831237, 38.831276296525061, ECLIPSE_TOTAL },
+    { 36947.600508438096, 36947.592848934932, 6359.9230711029741, 60.937901810409066, 77.419416554830491, ECLIPSE_ANNULAR },
+    { 37125.324069137998, 37125.315459659789, 7272.8053585356183, NAN, NAN, ECLIPSE_PARTIAL },
+    { 37272.588778918769, 37272.596225389469, 6846.2522100178312, NAN, NAN, ECLIPSE_PARTIAL },
+    { 37449.834573566368, 37449.841997241063, 5783.9500586037684, 75.873497470000927, 133.37006908978441, ECLIPSE_ANNULAR },
+    { 37627.248025097317, 37627.250980506949, 2637.1173916478847, -46.065372881185233, -80.953691305523222, ECLIPSE_TOTAL },
+    { 37803.914911038933, 37803.915931246222, 813.28609290605118, 30.254549017785966, 32.98888407860494, ECLIPSE_ANNULAR },
+    { 37981.800956766638, 37981.798885839889, 1755.4076275302705, -7.4875162278698735, 70.367001046869575, ECLIPSE_ANNULAR },
+    { 38158.264089193166, 38158.259280929204, 4111.946695449783, -16.628456728726029, -96.995840896133117, ECLIPSE_TOTAL },
+    { 38336.081372962006, 38336.073345716977, 6457.9302561401209, NAN, NAN, ECLIPSE_PARTIAL },
+    { 38483.567703310902, 38483.575734371727, 7460.3357783498777, NAN, NAN, ECLIPSE_PARTIAL },
+    { 38512.8809188085, 38512.871625447624, 8609.8655312214014, NAN, NAN, ECLIPSE_PARTIAL },
+    { 38660.295016300872, 38660.30561728157, 8394.4235623912482, NAN, NAN, ECLIPSE_PARTIAL },
+    { 38838.257940476571, 38838.26132339883, 2978.5539619803258, 43.041416253460774, -102.40139699662261, ECLIPSE_TOTAL },
+    { 39014.436314598643, 39014.440710901807, 3612.1382000801659, -45.88714924520346, -174.21927440706006, ECLIPSE_ANNULAR },
+    { 39192.763089311185, 39192.760897534063, 1812.0587719564305, -3.6847484984580419, 89.771027854532804, ECLIPSE_ANNULAR },
+    { 39368.886933968315, 39368.885626727119, 1137.7317439402436, 1.1660675770465718, 40.44827991154358, ECLIPSE_TOTAL },
+    { 39546.961715000427, 39546.953170333181, 6750.8887099015392, NAN, NAN, ECLIPSE_PARTIAL },
+    { 39723.546447335852, 39723.540346632384, 5566.5319006310992, 52.541569165868687, -172.0489357329138, ECLIPSE_TOTAL },
+    { 39871.228571270498, 39871.238070828738, 7628.6847099679635, NAN, NAN, ECLIPSE_PARTIAL },
+    { 40048.821853150024, 40048.829346864637, 6487.7031295410225, NAN, NAN, ECLIPSE_PARTIAL },
+    { 40225.474686868853, 40225.478045333715, 2823.197900649649, 14.021314258121015, -175.39084601365064, ECLIPSE_ANNULAR },
+    { 40403.197455763511, 40403.199702735779, 1793.4830006504685, -1.9519234861946044, -74.420573972852367, ECLIPSE_ANNULAR },
+    { 40580.003511200084, 40580.001591064502, 1697.6039384736489, -30.301086545241603, 6.7225976822852545, ECLIPSE_TOTAL },
+    { 40757.293755993123, 40757.289714792467, 3109.5930992770814, 46.002956575560759, -95.448859597702921, ECLIPSE_ANNULAR },
+    { 40934.663796015266, 40934.657290332456, 5933.8771683183195, -80.681182410152957, -162.80412286384637, ECLIPSE_TOTAL },
+    { 41081.784822728259, 41081.796265811558, 9791.0262244595579, NAN, NAN, ECLIPSE_PARTIAL },
+    { 41111.339868061645, 41111.330066634757, 7839.8556988443279, NAN, NAN, ECLIPSE_PARTIAL },
+    { 41259.678692852751, 41259.687528746945, 7422.0813817847002, NAN, NAN, ECLIPSE_PARTIAL },
+    { 41436.218903869958, 41436.224033515122, 4523.9043633527308, -21.643471605132564, -73.918207918316341, ECLIPSE_TOTAL },
+    { 41613.871017752303, 41613.875162968965, 3213.6728633710413, 7.0408401199310937, 48.749938087363034, ECLIPSE_ANNULAR },
+    { 41790.882809471193, 41790.882435154861, 337.90546233395798, 25.397395582099826, 41.146176611947126, ECLIPSE_TOTAL },
+    { 41967.849425574052, 41967.847898246458, 1164.1442224895329, -31.310514255906948, 48.161286631665746, ECLIPSE_ANNULAR },
+    { 42145.596188680247, 42145.590623822318, 5049.677902302019, 67.845435586070721, 109.16649320412702, ECLIPSE_TOTAL },
+    { 42321.920416805813, 42321.913566769799, 5532.7723601804701, -68.78345212289409, -28.204379032858043, ECLIPSE_ANNULAR },
+    { 42470.63937900067, 42470.64827813291, 7323.9229183525431, NAN, NAN, ECLIPSE_PARTIAL },
+    { 42646.844921647738, 42646.852949931119, 7386.3696152445627, NAN, NAN, ECLIPSE_PARTIAL },
+    { 42676.293167199918, 42676.282364997598, 9638.6139900105809, NAN, NAN, ECLIPSE_PARTIAL },
+    { 42824.754645052592, 42824.758334748083, 2841.0842412327452, -18.324053312378307, 100.92430651933262, ECLIPSE_ANNULAR },
+    { 43001.533024117685, 43001.53614378989, 2827.4974824095734, 21.807620728875072, 178.27635545960453, ECLIPSE_TOTAL },
+    { 43178.750510641286, 43178.748270755932, 1737.3247363222565, 14.377863774605061, 84.487547438717741, ECLIPSE_ANNULAR },
+    { 43356.185978122718, 43356.183913008652, 1806.9702382454168, -11.533286823978759, -75.401099365451955, ECLIPSE_TOTAL },
+    { 43532.935069039486, 43532.927652774946, 6186.0368484381825, 56.733000489482272, -29.583327916330632, ECLIPSE_ANNULAR },
+    { 43710.619955898299, 43710.611755485792, 6873.6390825376766, NAN, NAN, ECLIPSE_PARTIAL },
+    { 43857.955208610125, 43857.962675595962, 6879.8567822589794, NAN, NAN, ECLIPSE_PARTIAL },
+    { 44035.100544445246, 44035.108647743335, 6338.6614682156487, 66.513518456635282, 88.826306024323173, ECLIPSE_ANNULAR },
+    { 44212.615478437256, 44212.618472646347, 2669.5812822967227, -43.865192965544317, 149.99578320752551, ECLIPSE_TOTAL },
+    { 44389.192108612675, 44389.193790171979, 1347.9658143692523, 33.503671774503374, -64.449562113383237, ECLIPSE_ANNULAR },
+    { 44567.158473128678, 44567.156421546613, 1733.8791436235151, -6.8676981072197751, -58.324406217617764, ECLIPSE_ANNULAR },
+    { 44743.561011695849, 44743.556806989371, 3609.3669591878297, -11.115378916693402, 154.50384864760844, ECLIPSE_TOTAL },
+    { 44921.422833181001, 44921.414816343706, 6428.3246320462431, NAN, NAN, ECLIPSE_PARTIAL },
+    { 45068.88721347315, 45068.895637697671, 7853.5007119159636, NAN, NAN, ECLIPSE_PARTIAL },
+    { 45098.191084668542, 45098.182283976523, 8147.8835440830189, NAN, NAN, ECLIPSE_PARTIAL },
+    { 45245.616888842334, 45245.627637138605, 8535.6376915222845, NAN, NAN, ECLIPSE_PARTIAL },
+    { 45423.576317946638, 45423.58014391303, 3363.7832665852943, 50.225165040706898, 143.07791768150116, ECLIPSE_TOTAL },
+    { 45599.768195325632, 45599.772768372648, 3772.3332265856679, -51.511368245822588, 66.689258380009051, ECLIPSE_ANNULAR },
+    { 45778.070390207504, 45778.068627251239, 1451.2291765991877, 2.9228511471456473, -22.778458717516834, ECLIPSE_ANNULAR },
+    { 45954.228100704044, 45954.227028269939, 935.35258642614758, -4.46234385198112, -83.68153292202544, ECLIPSE_TOTAL },
+    { 46132.25860636685, 46132.250450973108, 6418.5520447463177, NAN, NAN, ECLIPSE_PARTIAL },
+    { 46308.887054736479, 46308.881208204395, 5325.3623230081639, 45.359601138728799, 58.475467230531649, ECLIPSE_TOTAL },
+    { 46456.551621951636, 46456.56125966792, 7779.2456852194773, NAN, NAN, ECLIPSE_PARTIAL },
+    { 46634.131168436383, 46634.139162213869, 6898.087530666553, NAN, NAN, ECLIPSE_PARTIAL },
+    { 46810.819154331482, 46810.822617090205, 2923.3886748773116, 18.820960375099652, 58.946659201259536, ECLIPSE_ANNULAR },
+    { 46988.48370903774, 46988.486563103164, 2267.0148134401156, -9.7997166072507227, 179.85324757575788, ECLIPSE_ANNULAR },
+    { 47165.36335848915, 47165.361530294009, 1619.0275350386694, -25.715898590519551, -122.57361913452729, ECLIPSE_TOTAL },
+    { 47342.565314708751, 47342.561934714853, 2592.2437117781756, 37.486842507766035, 165.60351808244448, ECLIPSE_ANNULAR },
+    { 47520.028283578024, 47520.021824267111, 5883.4220173717604, -76.03833038618383, 52.328949737680432, ECLIPSE_TOTAL },
+    { 47696.616636461942, 47696.607481993458, 7314.8714672111673, NAN, NAN, ECLIPSE_PARTIAL },
+    { 47845.031021831986, 47845.039961111906, 7476.0648920421136, NAN, NAN, ECLIPSE_PARTIAL },
+    { 48021.521570527751, 48021.527185293657, 4980.6306615535805, -28.04415149436144, 174.61327365819091, ECLIPSE_TOTAL },
+    { 48199.206067826461, 48199.210321971514, 3287.5362447013581, 7.4829414408380241, -72.934450669763123, ECLIPSE_ANNULAR },
+    { 48376.195886447029, 48376.196015089197, 116.20127309083013, 22.343060531351831, -70.280629514465573, ECLIPSE_TOTAL },
+    { 48553.178286902119, 48553.176887110938, 1066.8182926943598, -32.259923351066575, -68.132271246555035, ECLIPSE_ANNULAR },
+    { 48730.908674869293, 48730.903554482567, 4624.7897880759192, 66.600584361942978, 10.534982131786983, ECLIPSE_TOTAL },
+    { 48907.257921081633, 48907.251234749274, 5411.7844514295684, -72.115902335079809, -144.05370146536916, ECLIPSE_ANNULAR },
+    { 49055.946103874958, 49055.955449885114, 7684.0138367844893, NAN, NAN, ECLIPSE_PARTIAL },
+    { 49085.467313733927, 49085.456343460646, 9752.3027382075197, NAN, NAN, ECLIPSE_PARTIAL },
+    { 49232.183705475931, 49232.191942784892, 7603.7565405287414, NAN, NAN, ECLIPSE_PARTIAL },
+    { 49261.641084854942, 49261.630472403303, 9483.5498758815975, NAN, NAN, ECLIPSE_PARTIAL },
+    { 49410.053504133524, 49410.057615919737, 3168.7239149899797, -17.526408244587849, -6.6818824804549664, ECLIPSE_ANNULAR },
+    { 49586.868583517979, 49586.872016378329, 3109.505160591204, 20.274625080239154, 57.414721097204051, ECLIPSE_TOTAL },
+    { 49764.058942483614, 49764.057058583399, 1466.6807387376825, 16.524368535619082, -26.222046471334149, ECLIPSE_ANNULAR },
+    { 49941.507214389807, 49941.505516100879, 1479.0334668055127, -13.087732874660965, 169.23863303402982, ECLIPSE_TOTAL },
+    { 50118.265733244196, 50118.25859765747, 5978.620807419431, 55.669498360123384, -145.03709404632906, ECLIPSE_ANNULAR },
+    { 50295.919102310305, 50295.911286677547, 6502.3416141996131, NAN, NAN, ECLIPSE_PARTIAL },
+    { 50443.319541734927, 50443.327047333412, 6931.1940602070408, NAN, NAN, ECLIPSE_PARTIAL },
+    { 50620.369497339532, 50620.378240638471, 6869.3119275931585, NAN, NAN, ECLIPSE_PARTIAL },
+    { 50797.98162004177, 50797.984662190283, 2710.3132853621464, -40.932891171369107, 20.530733672998679, ECLIPSE_TOTAL },
+    { 50974.471416694607, 50974.473737804939, 1871.6308787672542, 35.740532801115272, -162.12409223996514, ECLIPSE_ANNULAR },
+    { 51152.515056179793, 51152.513027917063, 1709.4219545320871, -5.4601464231531098, 173.23602493909036, ECLIPSE_ANNULAR },
+    { 51328.858925270601, 51328.855318431903, 3108.1623189018005, -6.7499790299913878, 46.332790045719683, ECLIPSE_TOTAL },
+    { 51506.763737542897, 51506.755736639745, 6397.4208624753473, NAN, NAN, ECLIPSE_PARTIAL },
+    { 51654.203267438417, 51654.212107601641, 8272.3527569990183, NAN, NAN, ECLIPSE_PARTIAL },
+    { 51683.500719525677, 51683.492418640613, 7679.3294386274547, NAN, NAN, ECLIPSE_PARTIAL },
+    { 51830.944076498999, 51830.954921849894, 8639.8545390368563, NAN, NAN, ECLIPSE_PARTIAL },
+    { 52008.89015798219, 52008.894462286269, 3779.23316533967, 57.346928028800278, 31.768790568831189, ECLIPSE_TOTAL },
+    { 52185.10541643294, 52185.11012183156, 3897.4950171122709, -56.355551109887521, -52.525294316614179, ECLIPSE_ANNULAR },
+    { 52363.371892876174, 52363.370609277321, 1052.1867663752632, 9.3757265695875471, -132.83922815133639, ECLIPSE_ANNULAR },
+    { 52539.57492473349, 52539.574040325504, 773.06055721144241, -9.3526550154776107, 150.64250610153641, ECLIPSE_TOTAL },
+    { 52717.547651160923, 52717.539961571572, 6029.5351685575069, -53.829567002820184, -175.89215289420889, ECLIPSE_ANNULAR },
+    { 52894.233426462881, 52894.227786761054, 5129.3725520183652, 39.279187809848764, -71.273132954622156, ECLIPSE_TOTAL },
+    { 53041.868682093133, 53041.878505740606, 7976.2859999424127, NAN, NAN, ECLIPSE_PARTIAL },
+    { 53219.444628127916, 53219.453081611035, 7270.2757617116758, NAN, NAN, ECLIPSE_PARTIAL },
+    { 53248.890098947566, 53248.879625966729, 9692.4832993318614, NAN, NAN, ECLIPSE_PARTIAL },
+    { 53396.158530717068, 53396.16214615279, 3066.4995757264874, 24.310389740697715, -65.129378276771618, ECLIPSE_ANNULAR },
+    { 53573.773870164681, 53573.777290462604, 2704.2995723482841, -17.707350890326968, 72.42673216209387, ECLIPSE_ANNULAR },
+    { 53750.719817450045, 53750.718110728878, 1513.9803022531717, -20.583519090789014, 108.66095570976751, ECLIPSE_TOTAL },
+    { 53927.839205436379, 53927.836469326394, 2092.37922683539, 29.013593372219777, 65.09292104458909, ECLIPSE_ANNULAR },
+    { 54105.390494183084, 54105.384094683126, 5820.1573191862426, -71.053343553964055, -87.922054092781252, ECLIPSE_TOTAL },
+    { 54281.895717311534, 54281.887200687692, 6800.2575091062945, NAN, NAN, ECLIPSE_PARTIAL },
+    { 54430.383846721656, 54430.392878620718, 7520.8221954783103, NAN, NAN, ECLIPSE_PARTIAL },
+    { 54606.823500330065, 54606.829605391962, 5446.2931388796151, -36.204254820006213, 62.291338104710583, ECLIPSE_TOTAL },
+    { 54784.54308635529, 54784.547424545177, 3342.3079761939939, 8.4934089113713753, 164.57398828418422, ECLIPSE_ANNULAR },
+    { 54961.50796132414, 54961.508600234505, 577.3140463591152, 18.305084557957404, 178.02464281300377, ECLIPSE_TOTAL },
+    { 55138.509762213129, 55138.508465583305, 988.24557875665448, -32.406792357282839, 174.78993620471948, ECLIPSE_ANNULAR },
+    { 55316.219058733033, 55316.214397942924, 4188.7053602395272, 63.747574538909191, -89.523022273484131, ECLIPSE_TOTAL },
+    { 55492.599336066087, 55492.592782178195, 5315.8900954394994, -75.216383129845809, 102.57354384616957, ECLIPSE_ANNULAR },
+    { 55641.246449417558, 55641.256290134064, 8084.1890312864925, NAN, NAN, ECLIPSE_PARTIAL },
+    { 55670.764994643207, 55670.754387252142, 9344.089130357992, NAN, NAN, ECLIPSE_PARTIAL },
+    { 55817.528031838512, 55817.536441168209, 7782.9912198051679, NAN, NAN, ECLIPSE_PARTIAL },
+    { 55846.993864420983, 55846.983404321836, 9361.9044296150278, NAN, NAN, ECLIPSE_PARTIAL },
+    { 55995.345760962904, 55995.350353603782, 3542.9927244176442, -17.833349869462481, -111.9984238527115, ECLIPSE_ANNULAR },
+    { 56172.209561561584, 56172.213262013451, 3348.6006614041416, 18.791868968724089, -65.807357309796316, ECLIPSE_TOTAL },
+    { 56349.361216387224, 56349.359749726362, 1146.1876062519825, 18.174638315229956, -134.33742620141641, ECLIPSE_ANNULAR },
+    { 56526.833829966483, 56526.832448651599, 1197.3374942897731, -15.12602678856717, 51.984977768995009, ECLIPSE_TOTAL },
+    { 56703.591186729311, 56703.58438102089, 5726.7242376602135, 55.629585548859119, 101.11006615270566, ECLIPSE_ANNULAR },
+    { 56881.222315641084, 56881.21485246966, 6164.8218681071248, -58.739021691839199, -143.65730863083695, ECLIPSE_ANNULAR },
+    { 57028.680508785474, 57028.688081454849, 7010.2732792864081, NAN, NAN, ECLIPSE_PARTIAL },
+    { 57205.640906876899, 57205.650257725654, 7380.7703082153675, NAN, NAN, ECLIPSE_PARTIAL },
+    { 57383.344386053104, 57383.347504310426, 2776.323937163796, -37.64408342911814, -108.53107518127163, ECLIPSE_TOTAL },
+    { 57559.753424469673, 57559.756358713603, 2380.3809667322066, 37.045746777138262, 99.44911245948731, ECLIPSE_ANNULAR },
+    { 57737.869682644559, 57737.867691254229, 1673.9936985177128, -3.4029818885666674, 45.374106166542674, ECLIPSE_ANNULAR },
+    { 57914.158586674261, 57914.155565431174, 2613.8187458804841, -3.5125386634395666, -61.918959684124715, ECLIPSE_TOTAL },
+    { 58092.104024189779, 58092.096044986538, 6364.5041164455652, NAN, NAN, ECLIPSE_PARTIAL },
+    { 58239.516715184633, 58239.525986625609, 8710.5157278929073, NAN, NAN, ECLIPSE_PARTIAL },
+    { 58268.810270597467, 58268.802474379161, 7206.8902143789701, NAN, NAN, ECLIPSE_PARTIAL },
+    { 58416.276203602552, 58416.287101263501, 8710.6260116509857, NAN, NAN, ECLIPSE_PARTIAL },
+    { 58594.198846180181, 58594.203670586066, 4230.9183142645861, 64.373649607338848, -74.979265805731956, ECLIPSE_TOTAL },
+    { 58770.4488565231, 58770.453642601358, 3980.8756115356377, -60.041616918139901, -171.68309055877387, ECLIPSE_ANNULAR },
+    { 58948.667718040328, 58948.666964798547, 614.95406994089365, 15.577737301756862, 119.69294971744785, ECLIPSE_ANNULAR },
+    { 59124.927205990825, 59124.926465300457, 648.95302587464641, -13.38350164380431, 23.535403027553343, ECLIPSE_TOTAL },
+    { 59302.831862324892, 59302.824688903645, 5605.5570208380432, -42.435475509610143, 72.642455875686778, ECLIPSE_ANNULAR },
+    { 59479.584816895214, 59479.57934417863, 4971.6390815580517, 34.184483639815916, 158.15179096804201, ECLIPSE_TOTAL },
+    { 59627.182007341726, 59627.192044590236, 8203.3267686300842, NAN, NAN, ECLIPSE_PARTIAL },
+    { 59804.761358579002, 59804.770240653124, 7613.0114852025299, NAN, NAN, ECLIPSE_PARTIAL },
+    { 59834.229382139616, 59834.219038479307, 9518.996768340774, NAN, NAN, ECLIPSE_PARTIAL },
+    { 59981.494323710293, 59981.49812570327, 3240.7878938487484, 30.281865903678352, 171.97504173979803, ECLIPSE_TOTAL },
+    { 60159.067538550946, 60159.071489037211, 3110.0119535481786, -25.643446653143481, -36.438627715937827, ECLIPSE_ANNULAR },
+    { 60336.071224366766, 60336.06968531858, 1367.5678660514855, -14.941390076251864, -18.877893708059403, ECLIPSE_TOTAL },
+    { 60513.118360034336, 60513.116221627315, 1631.4009943696083, 20.791712845055688, -37.626363593352977, ECLIPSE_ANNULAR },
+    { 60690.747812283698, 60690.74151015871, 5721.4856746360301, -65.508339334113131, 134.59684971629716, ECLIPSE_TOTAL },
+    { 60867.180229616846, 60867.172313321666, 6319.2297052615695, 74.343078244355269, 42.635263163762602, ECLIPSE_ANNULAR },
+    { 61015.734541450045, 61015.743680129664, 7577.6996653124952, NAN, NAN, ECLIPSE_PARTIAL },
+    { 61192.126870309068, 61192.133452855116, 5904.227494947776, -46.71466938552981, -52.476669855382724, ECLIPSE_TOTAL },
+    { 61369.880041245473, 61369.884459679604, 3394.6602971535544, 10.22084528376103, 41.979548117275613, ECLIPSE_ANNULAR },
+    { 61546.818099816715, 61546.819267538405, 1055.1709781845948, 13.245418824989134, 66.272348876734, ECLIPSE_TOTAL },
+    { 61723.844303144106, 61723.84308181324, 931.16232055293369, -31.73272473974113, 56.576019302970678, ECLIPSE_ANNULAR },
+    { 61901.526022725964, 61901.521850966019, 3728.8320020380738, 59.267247496363403, 168.44674907202622, ECLIPSE_TOTAL },
+    { 62077.945003157009, 62077.938547981132, 5247.6357721175864, -77.467339863853823, -6.5452401242464475, ECLIPSE_ANNULAR },
+    { 62226.540258002729, 62226.550643261478, 8526.0071291680106, NAN, NAN, ECLIPSE_PARTIAL },
+    { 62256.058504819761, 62256.048294146574, 8909.048136942416, NAN, NAN, ECLIPSE_PARTIAL },
+    { 62402.878512416442, 62402.887053025406, 7919.4470667143669, NAN, NAN, ECLIPSE_PARTIAL },
+    { 62432.351595802887, 62432.341249534613, 9274.7818277320384, NAN, NAN, ECLIPSE_PARTIAL },
+    { 62580.632167511932, 62580.637292172876, 3958.7489031084788, -19.425803842095092, 144.62530105595658, ECLIPSE_ANNULAR },
+    { 62757.555274845108, 62757.559205013538, 3551.3337661401924, 17.519215604909995, 168.92701596631105, ECLIPSE_TOTAL },
+    { 62934.659068290734, 62934.658063244133, 788.55409766021319, 19.234890373477736, 119.45414165158343, ECLIPSE_ANNULAR },
+    { 63112.16486574195, 63112.163760775278, 953.15625618640354, -17.374759778848638, -66.745721795120573, ECLIPSE_TOTAL },
+    { 63288.911937505065, 63288.905506116462, 5433.7704430242502, 56.219333694067515, -10.513309109665101, ECLIPSE_ANNULAR },
+    { 63466.53038431055, 63466.523233091713, 5866.7623327344782, -57.840848883153498, 113.55867082281546, ECLIPSE_ANNULAR },
+    { 63614.038132359463, 63614.04580040968, 7116.3035990791814, NAN, NAN, ECLIPSE_PARTIAL },
+    { 63643.45017096532, 63643.43976922772, 9638.2905211768721, NAN, NAN, ECLIPSE_PARTIAL },
+    { 63790.916594522459, 63790.926504294956, 7860.1535608836257, NAN, NAN, ECLIPSE_PARTIAL },
+    { 63968.704049879685, 63968.707269284343, 2864.3366929345416, -34.17597361478289, 122.82055034060761, ECLIPSE_TOTAL },
+    { 64145.039856914336, 64145.043361969903, 2861.1032927173806, 37.499994436231482, -0.70283609503815114, ECLIPSE_ANNULAR },
+    { 64323.221005934516, 64323.219077184083, 1617.1727402994027, -0.8768173617810624, -81.409591092264463, ECLIPSE_ANNULAR },
+    { 64499.460769961035, 64499.458314847514, 2132.4051820267973, -1.3681945588173958, -170.67284862557474, ECLIPSE_TOTAL },
+    { 64677.44179709832, 64677.433862661004, 6315.1416760923166, 57.754517745768872, 164.71898174172293, ECLIPSE_ANNULAR },
+    { 64824.828748976819, 64824.8384576565, 9158.3261022392708, NAN, NAN, ECLIPSE_PARTIAL },
+    { 64854.121518484404, 64854.114215828937, 6745.2373541392262, NAN, NAN, ECLIPSE_PARTIAL },
+    { 65001.611095883323, 65001.622019532835, 8764.4192758683384, NAN, NAN, ECLIPSE_PARTIAL },
+    { 65179.504823717143, 65179.510186761785, 4698.2580665178439, 70.851197844414415, -175.43987006985765, ECLIPSE_TOTAL },
+    { 65355.796570353166, 65355.801403590434, 4037.6591806349375, -62.368701198151967, 69.813392241388613, ECLIPSE_ANNULAR },
+    { 65533.958263822067, 65533.958088507985, 142.58170265434921, 21.404502953340746, 14.823205586879212, ECLIPSE_ANNULAR },
+    { 65710.28413172935, 65710.283497628174, 556.93749299790159, -16.467527667880699, -104.73586985781174, ECLIPSE_TOTAL },
+    { 65888.109703737427, 65888.103112755256, 5134.3768510473883, -32.703077151287417, -33.044660707758538, ECLIPSE_ANNULAR },
+    { 66064.94134930674, 66064.93600150643, 4854.0362586346246, 30.126968292058816, 26.382294236861242, ECLIPSE_TOTAL },
+    { 66212.488354476722, 66212.498659100471, 8485.0261367799012, NAN, NAN, ECLIPSE_PARTIAL },
+    { 66242.130093336935, 66242.117865700478, 9782.2675104863865, NAN, NAN, ECLIPSE_PARTIAL },
+    { 66390.083426993689, 66390.092686733507, 7909.6320678165166, NAN, NAN, ECLIPSE_PARTIAL },
+    { 66419.574272030804, 66419.564017520897, 9390.6649621836132, NAN, NAN, ECLIPSE_PARTIAL },
+    { 66566.824791897438, 66566.828829652964, 3460.2555291805893, 36.779131236157696, 50.911595760512171, ECLIPSE_TOTAL },
+    { 66744.365477205807, 66744.36991312106, 3478.2890563167989, -33.481368303252438, -146.83386090645331, ECLIPSE_ANNULAR },
+    { 66921.418418104382, 66921.417083402819, 1188.0433988932009, -8.9945215780243331, -145.26730136825586, ECLIPSE_TOTAL },
+    { 67098.401931473913, 67098.400351755205, 1202.8903182312438, 12.799758970434729, -142.07001473985332, ECLIPSE_ANNULAR },
+    { 67276.100787271309, 67276.094614338101, 5593.4661252639653, -59.548458831556296, -0.10504311093070484, ECLIPSE_TOTAL },
+    { 67452.469016865565, 67452.46167235676, 5863.3440168700754, 67.219648505007427, -123.21257726766368, ECLIPSE_ANNULAR },
+    { 67601.083888225126, 67601.093137753705, 7638.966313589799, NAN, NAN, ECLIPSE_PARTIAL },
+    { 67777.431791417592, 67777.43883782941, 6353.2214311259531, -66.894156300989437, -177.61719488572044, ECLIPSE_TOTAL },
+    { 67955.21601637156, 67955.220519089649, 3450.7786791742456, 12.683561305963222, -80.423771861660043, ECLIPSE_ANNULAR },
+    { 68132.129204245051, 68132.130891213164, 1523.9988650428713, 7.4730538628789933, -46.5701393352618, ECLIPSE_TOTAL },
+    { 68309.179925630131, 68309.178770671439, 881.03723429510126, -30.127562551996434, -62.277410304799332, ECLIPSE_ANNULAR },
+    { 68486.831525183792, 68486.827854782852, 3262.1253777556271, 53.65444941129747, 63.730524861225184, ECLIPSE_TOTAL },
+    { 68663.292990847331, 68663.28661762338, 5192.9602659979546, -77.858065962611676, -111.48504701506236, ECLIPSE_ANNULAR },
+    { 68811.828983849715, 68811.839947881512, 8997.1072829040841, NAN, NAN, ECLIPSE_PARTIAL },
+    { 68841.348851496645, 68841.339065781751, 8455.1273001792724, NAN, NAN, ECLIPSE_PARTIAL },
+    { 68988.233615161822, 68988.242258216662, 8024.722389392261, NAN, NAN, ECLIPSE_PARTIAL },
+    { 69017.711990829499, 69017.701738506206, 9205.1926916845296, NAN, NAN, ECLIPSE_PARTIAL },
+    { 69165.912513378789, 69165.918222385968, 4416.9939898543562, -22.576524400105935, 43.174311383886064, ECLIPSE_ANNULAR },
+    { 69342.906236595256, 69342.910352512466, 3712.3166897217275, 16.46283419016893, 41.464074310825197, ECLIPSE_TOTAL },
+    { 69519.951977989374, 69519.951482883727, 390.00090597994534, 19.463997554396773, 15.260823084089186, ECLIPSE_ANNULAR },
+    { 69697.500422599667, 69697.499551234927, 747.95728975841155, -19.659413385660894, 173.05775221900072, ECLIPSE_TOTAL },
+    { 69874.227944644328, 69874.221931410371, 5099.6675747099753, 57.038035570180227, -119.40449069712263, ECLIPSE_ANNULAR },
+    { 70051.843530811137, 70051.836647071686, 5610.3948158756193, -58.745012358186429, 4.8107734453475359, ECLIPSE_ANNULAR },
+    { 70199.390367989225, 70199.398175868366, 7265.2497378648886, NAN, NAN, ECLIPSE_PARTIAL },
+    { 70228.784660482474, 70228.774566309265, 9364.3464894941699, NAN, NAN, ECLIPSE_PARTIAL },
+    { 70376.196979354514, 70376.207398608254, 8304.4514374884366, NAN, NAN, ECLIPSE_PARTIAL },
+    { 70554.058797134116, 70554.062158503395, 2988.4187175384182, -30.855612834458764, -4.5458973185196294, ECLIPSE_TOTAL },
+    { 70730.331191093879, 70730.335221134068, 3309.8750407672096, 37.328365426558371, -103.02787737589586, ECLIPSE_ANNULAR },
+    { 70908.5677931604, 70908.565963500558, 1530.0796261250698, 1.937292520832405, 153.38483766139561, ECLIPSE_ANNULAR },
+    { 71084.766789542991, 71084.76486832129, 1675.1778186994461, -0.29477994242250682, 79.442191816699179, ECLIPSE_TOTAL },
+    { 71262.777276405119, 71262.76940652779, 6251.5618078382331, 55.340992349039468, 41.260234543896559, ECLIPSE_ANNULAR },
+    { 71410.13883542984, 71410.148991090929, 9620.2892280171709, NAN, NAN, ECLIPSE_PARTIAL },
+    { 71439.433385320983, 71439.426574843674, 6285.150916313868, -56.378771646296443, 165.89474961081871, ECLIPSE_TOTAL },
+    { 71586.949322843604, 71586.960242454952, 8796.63748563236, NAN, NAN, ECLIPSE_PARTIAL },
+    { 71764.807201488307, 71764.813129821094, 5188.7517124423921, 76.188256375586718, 96.567813733568329, ECLIPSE_TOTAL },
+    { 71941.148193878093, 71941.153043773229, 4069.9928820282271, -63.054984239852956, -48.76199199914538, ECLIPSE_ANNULAR },
+    { 72119.244575390534, 72119.245015451379, 356.61957776081476, 26.685182367782012, -87.694787638185673, ECLIPSE_ANNULAR },
+    { 72295.645196139682, 72295.644635496457, 493.72789740196185, -18.507701373719424, 125.92857960367502, ECLIPSE_TOTAL },
+    { 72473.384401393618, 72473.378428710217, 4640.2177703567922, -24.316484380624399, -135.85366565027806, ECLIPSE_ANNULAR },
+    { 72650.301035741402, 72650.295788480595, 4760.1041019135928, 26.930354235329247, -106.11833143044606, ECLIPSE_TOTAL },
+    { 72797.79151559672, 72797.802106974093, 8792.3525598808792, NAN, NAN, ECLIPSE_PARTIAL },
+    { 72827.411208196208, 72827.399559222875, 9318.7896331689517, NAN, NAN, ECLIPSE_PARTIAL },
+    { 72975.40953310726, 72975.41913140926, 8171.3168724483339, NAN, NAN, ECLIPSE_PARTIAL },
+    { 73004.922771927857, 73004.912581046199, 9291.6789172068602, NAN, NAN, ECLIPSE_PARTIAL }
+};
+
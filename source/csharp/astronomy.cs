@@ -359,7 +359,7 @@ namespace CosineKitty
     /// <summary>
     /// Spherical coordinates: latitude, longitude, distance.
     /// </summary>
-    public struct Spherical
+    public readonly struct Spherical
     {
         /// <summary>The latitude angle: -90..+90 degrees.</summary>
         public readonly double lat;
@@ -391,7 +391,7 @@ namespace CosineKitty
     /// This structure is passed to functions that calculate phenomena as observed
     /// from a particular place on the Earth.
     /// </remarks>
-    public struct Observer
+    public readonly struct Observer
     {
         /// <summary>
         /// Geographic latitude in degrees north (positive) or south (negative) of the equator.
@@ -546,7 +546,7 @@ namespace CosineKitty
     /// (geocentric or topocentric, depending on context),
     /// oriented with respect to the projection of the Earth's equator onto the sky.
     /// </remarks>
-    public struct Equatorial
+    public readonly struct Equatorial
     {
         /// <summary>
         /// Right ascension in sidereal hours.
@@ -584,7 +584,7 @@ namespace CosineKitty
     /// Coordinates of a celestial body as seen from the center of the Sun (heliocentric),
     /// oriented with respect to the plane of the Earth's orbit around the Sun (the ecliptic).
     /// </remarks>
-    public struct Ecliptic
+    public readonly struct Ecliptic
     {
         /// <summary>
         /// Cartesian x-coordinate: in the direction of the equinox along the ecliptic plane.
@@ -637,7 +637,7 @@ namespace CosineKitty
     /// the surface of the Earth (a topocentric observer).
     /// Optionally corrected for atmospheric refraction.
     /// </remarks>
-    public struct Topocentric
+    public readonly struct Topocentric
     {
         /// <summary>
         /// Compass direction around the horizon in degrees. 0=North, 90=East, 180=South, 270=West.
@@ -2933,7 +2933,14 @@ namespace CosineKitty
 
         private static AstroVector CalcVsop(vsop_model_t model, AstroTime time)
         {
-            double t = time.tt / 365250;    /* millennia since 2000 */
+            double x, y, z;
+            CalcVsop(model, time.tt, out x, out y, out z);
+            return new AstroVector(x, y, z, time);
+        }
+
+        private static void CalcVsop(vsop_model_t model, double tt, out double x, out double y, out double z)
+        {
+            double t = tt / 365250;    /* millennia since 2000 */
 
             /* Calculate the VSOP "B" trigonometric series to obtain ecliptic spherical coordinates. */
             double sphere0 = VsopFormulaCalc(model.lat, t);
@@ -2947,11 +2954,9 @@ namespace CosineKitty
             double eclip2 = sphere2 * Math.Sin(sphere1);
 
             /* Convert ecliptic Cartesian coordinates to equatorial Cartesian coordinates. */
-            double x = eclip0 + 0.000000440360*eclip1 - 0.000000190919*eclip2;
-            double y = -0.000000479966*eclip0 + 0.917482137087*eclip1 - 0.397776982902*eclip2;
-            double z = 0.397776982902*eclip1 + 0.917482137087*eclip2;
-
-            return new AstroVector(x, y, z, time);
+            x = eclip0 + 0.000000440360*eclip1 - 0.000000190919*eclip2;
+            y = -0.000000479966*eclip0 + 0.917482137087*eclip1 - 0.397776982902*eclip2;
+            z = 0.397776982902*eclip1 + 0.917482137087*eclip2;
         }
 
         private static double VsopHelioDistance(vsop_model_t model, AstroTime time)
@@ -3227,6 +3232,13 @@ namespace CosineKitty
         }
 
         private static RotationMatrix precession_rot(double tt1, double tt2)
+        {
+            var rot = new double[3,3];
+            precession_rot(tt1, tt2, rot);
+            return new RotationMatrix(rot);
+        }
+
+        private static void precession_rot(double tt1, double tt2, double[,] rot)
         {
             double xx, yx, zx, xy, yy, zy, xz, yz, zz;
             double t, psia, omegaa, chia, sa, ca, sb, cb, sc, cc, sd, cd;
@@ -3281,7 +3293,6 @@ namespace CosineKitty
             yz = -sc * cb * ca - sa * cc;
             zz = -sc * cb * sa + cc * ca;
 
-            var rot = new double[3,3];
             if (tt2 == 0.0)
             {
                 /* Perform rotation from other epoch to J2000.0. */
@@ -3308,8 +3319,6 @@ namespace CosineKitty
                 rot[2, 1] = zy;
                 rot[2, 2] = zz;
             }
-
-            return new RotationMatrix(rot);
         }
 
         private static AstroVector precession(double tt1, AstroVector pos, double tt2)
@@ -3443,34 +3452,37 @@ namespace CosineKitty
         };
 
         private static void iau2000b(AstroTime time)
+        {
+            if (double.IsNaN(time.psi))
+                iau2000b(time.tt, out time.psi, out time.eps);
+        }
+
+        private static void iau2000b(double tt, out double psi, out double eps)
         {
             /* Adapted from the NOVAS C 3.1 function of the same name. */
 
             double t, el, elp, f, d, om, arg, dp, de, sarg, carg;
             int i;
 
-            if (double.IsNaN(time.psi))
+            t = tt / 36525.0;
+            el  = ((485868.249036 + t * 1717915923.2178) % ASEC360) * ASEC2RAD;
+            elp = ((1287104.79305 + t * 129596581.0481)  % ASEC360) * ASEC2RAD;
+            f   = ((335779.526232 + t * 1739527262.8478) % ASEC360) * ASEC2RAD;
+            d   = ((1072260.70369 + t * 1602961601.2090) % ASEC360) * ASEC2RAD;
+            om  = ((450160.398036 - t * 6962890.5431)    % ASEC360) * ASEC2RAD;
+            dp = 0;
+            de = 0;
+            for (i=76; i >= 0; --i)
             {
-                t = time.tt / 36525.0;
-                el  = ((485868.249036 + t * 1717915923.2178) % ASEC360) * ASEC2RAD;
-                elp = ((1287104.79305 + t * 129596581.0481)  % ASEC360) * ASEC2RAD;
-                f   = ((335779.526232 + t * 1739527262.8478) % ASEC360) * ASEC2RAD;
-                d   = ((1072260.70369 + t * 1602961601.2090) % ASEC360) * ASEC2RAD;
-                om  = ((450160.398036 - t * 6962890.5431)    % ASEC360) * ASEC2RAD;
-                dp = 0;
-                de = 0;
-                for (i=76; i >= 0; --i)
-                {
-                    arg = (iau_row[i].nals0*el + iau_row[i].nals1*elp + iau_row[i].nals2*f + iau_row[i].nals3*d + iau_row[i].nals4*om) % PI2;
-                    sarg = Math.Sin(arg);
-                    carg = Math.Cos(arg);
-                    dp += (iau_row[i].cls0 + iau_row[i].cls1*t) * sarg + iau_row[i].cls2*carg;
-                    de += (iau_row[i].cls3 + iau_row[i].cls4*t) * carg + iau_row[i].cls5*sarg;
-                }
-
-                time.psi = -0.000135 + (dp * 1.0e-7);
-                time.eps = +0.000388 + (de * 1.0e-7);
+                arg = (iau_row[i].nals0*el + iau_row[i].nals1*elp + iau_row[i].nals2*f + iau_row[i].nals3*d + iau_row[i].nals4*om) % PI2;
+                sarg = Math.Sin(arg);
+                carg = Math.Cos(arg);
+                dp += (iau_row[i].cls0 + iau_row[i].cls1*t) * sarg + iau_row[i].cls2*carg;
+                de += (iau_row[i].cls3 + iau_row[i].cls4*t) * carg + iau_row[i].cls5*sarg;
             }
+
+            psi = -0.000135 + (dp * 1.0e-7);
+            eps = +0.000388 + (de * 1.0e-7);
         }
 
         private static double mean_obliq(double tt)
@@ -3489,11 +3501,15 @@ namespace CosineKitty
         private static earth_tilt_t e_tilt(AstroTime time)
         {
             iau2000b(time);
+            return e_tilt(time.tt, time.psi, time.eps);
+        }
 
-            double mobl = mean_obliq(time.tt);
-            double tobl = mobl + (time.eps / 3600.0);
-            double ee = time.psi * Math.Cos(mobl * DEG2RAD) / 15.0;
-            return new earth_tilt_t(time.tt, time.psi, time.eps, ee, mobl, tobl);
+        private static earth_tilt_t e_tilt(double tt, double psi, double eps)
+        {
+            double mobl = mean_obliq(tt);
+            double tobl = mobl + (eps / 3600.0);
+            double ee = psi * Math.Cos(mobl * DEG2RAD) / 15.0;
+            return new earth_tilt_t(tt, psi, eps, ee, mobl, tobl);
         }
 
         private static double era(double ut)        /* Earth Rotation Angle */
@@ -3509,9 +3525,14 @@ namespace CosineKitty
 
         private static double sidereal_time(AstroTime time)
         {
-            double t = time.tt / 36525.0;
-            double eqeq = 15.0 * e_tilt(time).ee;    /* Replace with eqeq=0 to get GMST instead of GAST (if we ever need it) */
-            double theta = era(time.ut);
+            return sidereal_time(time.ut, time.tt, e_tilt(time).ee);
+        }
+
+        private static double sidereal_time(double ut, double tt, double ee)
+        {
+            double t = tt / 36525.0;
+            double eqeq = 15.0 * ee;    /* Replace with eqeq=0 to get GMST instead of GAST (if we ever need it) */
+            double theta = era(ut);
             double st = (eqeq + 0.014506 +
                 (((( -    0.0000000368   * t
                     -    0.000029956  ) * t
@@ -3552,7 +3573,13 @@ namespace CosineKitty
 
         private static RotationMatrix nutation_rot(AstroTime time, int direction)
         {
-            earth_tilt_t tilt = e_tilt(time);
+            var rot = new double[3,3];
+            nutation_rot(e_tilt(time), direction, rot);
+            return new RotationMatrix(rot);
+        }
+
+        private static void nutation_rot(earth_tilt_t tilt, int direction, double[,] rot)
+        {
             double oblm = tilt.mobl * DEG2RAD;
             double oblt = tilt.tobl * DEG2RAD;
             double psi = tilt.dpsi * ASEC2RAD;
@@ -3573,8 +3600,6 @@ namespace CosineKitty
             double yz = cpsi * cobm * sobt - sobm * cobt;
             double zz = cpsi * sobm * sobt + cobm * cobt;
 
-            var rot = new double[3,3];
-
             if (direction == 0)
             {
                 /* forward rotation */
@@ -3601,8 +3626,6 @@ namespace CosineKitty
                 rot[2, 1] = yz;
                 rot[2, 2] = zz;
             }
-
-            return new RotationMatrix(rot);
         }
 
 
@@ -3811,6 +3834,68 @@ namespace CosineKitty
             }
         }
 
+        private static void CheckBatchLength(int count, int length, string name)
+        {
+            if (length != count)
+                throw new ArgumentException(string.Format("The span `{0}` must have {1} elements, but it has {2}.", name, count, length));
+        }
+
+        private static bool IsVsopBody(Body body)
+        {
+            return (body >= Body.Mercury && body <= Body.Neptune);
+        }
+
+        private static void HelioVectorRaw(Body body, double tt, out double x, out double y, out double z)
+        {
+            /* Same as HelioVector for the Sun and the planets Mercury..Neptune, without any allocations. */
+            if (body == Body.Sun)
+                x = y = z = 0.0;
+            else
+                CalcVsop(vsop[(int)body], tt, out x, out y, out z);
+        }
+
+        /// <summary>
+        /// Calculates heliocentric Cartesian coordinates of a body at many times.
+        /// </summary>
+        /// <remarks>
+        /// This function calculates the same vectors as calling #Astronomy.HelioVector
+        /// once for each time in `ut`, but it writes the coordinates into caller-supplied spans
+        /// instead of returning #AstroVector values. For the Sun and the planets Mercury through Neptune,
+        /// no memory is allocated, so a high-rate service does not create garbage for
+        /// the .NET garbage collector. Other bodies are calculated by calling #Astronomy.HelioVector.
+        /// </remarks>
+        /// <param name="body">A body for which to calculate heliocentric positions: the Sun, Moon, EMB, SSB, or any of the planets.</param>
+        /// <param name="ut">The UT day values of the times, as in the `ut` field of #AstroTime.</param>
+        /// <param name="x">Receives the J2000 equatorial x-coordinate at each time, in AU.</param>
+        /// <param name="y">Receives the J2000 equatorial y-coordinate at each time, in AU.</param>
+        /// <param name="z">Receives the J2000 equatorial z-coordinate at each time, in AU.</param>
+        public static void HelioVectorBatch(
+            Body body,
+            ReadOnlySpan<double> ut,
+            Span<double> x,
+            Span<double> y,
+            Span<double> z)
+        {
+            CheckBatchLength(ut.Length, x.Length, "x");
+            CheckBatchLength(ut.Length, y.Length, "y");
+            CheckBatchLength(ut.Length, z.Length, "z");
+
+            for (int i = 0; i < ut.Length; ++i)
+            {
+                if (body == Body.Sun || IsVsopBody(body))
+                {
+                    HelioVectorRaw(body, TerrestrialTime(ut[i]), out x[i], out y[i], out z[i]);
+                }
+                else
+                {
+                    AstroVector vec = HelioVector(body, new AstroTime(ut[i]));
+                    x[i] = vec.x;
+                    y[i] = vec.y;
+                    z[i] = vec.z;
+                }
+            }
+        }
+
         /// <summary>
         /// Calculates the distance between a body and the Sun at a given time.
         /// </summary>
@@ -3953,6 +4038,86 @@ namespace CosineKitty
             }
         }
 
+        private static void GeoVectorRaw(
+            Body body,
+            double ut,
+            double tt,
+            Aberration aberration,
+            out double x,
+            out double y,
+            out double z)
+        {
+            /* Same as GeoVector for the Sun and the planets other than the Earth, without any allocations. */
+            double ex = 0.0, ey = 0.0, ez = 0.0;
+            double ltt = tt;
+
+            if (aberration == Aberration.None)
+                CalcVsop(vsop[(int)Body.Earth], tt, out ex, out ey, out ez);
+
+            for (int iter=0; iter < 10; ++iter)
+            {
+                HelioVectorRaw(body, ltt, out x, out y, out z);
+                if (aberration == Aberration.Corrected)
+                    CalcVsop(vsop[(int)Body.Earth], ltt, out ex, out ey, out ez);
+
+                x -= ex;
+                y -= ey;
+                z -= ez;
+                double ltt2 = TerrestrialTime(ut + (-Math.Sqrt(x*x + y*y + z*z) / C_AUDAY));
+                if (Math.Abs(ltt2 - ltt) < 1.0e-9)
+                    return;
+
+                ltt = ltt2;
+            }
+            throw new Exception("Light travel time correction did not converge");
+        }
+
+        /// <summary>
+        /// Calculates geocentric Cartesian coordinates of a body at many times.
+        /// </summary>
+        /// <remarks>
+        /// This function calculates the same vectors as calling #Astronomy.GeoVector
+        /// once for each time in `ut`, but it writes the coordinates into caller-supplied spans
+        /// instead of returning #AstroVector values. For the Sun and the planets other than the Earth,
+        /// no memory is allocated. Other bodies are calculated by calling #Astronomy.GeoVector.
+        /// </remarks>
+        /// <param name="body">A body for which to calculate geocentric positions: the Sun, Moon, or any of the planets.</param>
+        /// <param name="ut">The UT day values of the times, as in the `ut` field of #AstroTime.</param>
+        /// <param name="aberration">`Aberration.Corrected` to correct for aberration, or `Aberration.None` to leave uncorrected.</param>
+        /// <param name="x">Receives the J2000 equatorial x-coordinate at each time, in AU.</param>
+        /// <param name="y">Receives the J2000 equatorial y-coordinate at each time, in AU.</param>
+        /// <param name="z">Receives the J2000 equatorial z-coordinate at each time, in AU.</param>
+        public static void GeoVectorBatch(
+            Body body,
+            ReadOnlySpan<double> ut,
+            Aberration aberration,
+            Span<double> x,
+            Span<double> y,
+            Span<double> z)
+        {
+            if (aberration != Aberration.Corrected && aberration != Aberration.None)
+                throw new ArgumentException(string.Format("Unsupported aberration option {0}", aberration));
+
+            CheckBatchLength(ut.Length, x.Length, "x");
+            CheckBatchLength(ut.Length, y.Length, "y");
+            CheckBatchLength(ut.Length, z.Length, "z");
+
+            for (int i = 0; i < ut.Length; ++i)
+            {
+                if (body == Body.Sun || (body != Body.Earth && IsVsopBody(body)))
+                {
+                    GeoVectorRaw(body, ut[i], TerrestrialTime(ut[i]), aberration, out x[i], out y[i], out z[i]);
+                }
+                else
+                {
+                    AstroVector vec = GeoVector(body, new AstroTime(ut[i]), aberration);
+                    x[i] = vec.x;
+                    y[i] = vec.y;
+                    z[i] = vec.z;
+                }
+            }
+        }
+
         /// <summary>
         /// Calculates equatorial coordinates of a celestial body as seen by an observer on the Earth's surface.
         /// </summary>
@@ -4002,6 +4167,105 @@ namespace CosineKitty
             }
         }
 
+        private static AstroVector RotateRaw(double[,] rot, AstroVector pos)
+        {
+            return new AstroVector(
+                rot[0, 0]*pos.x + rot[1, 0]*pos.y + rot[2, 0]*pos.z,
+                rot[0, 1]*pos.x + rot[1, 1]*pos.y + rot[2, 1]*pos.z,
+                rot[0, 2]*pos.x + rot[1, 2]*pos.y + rot[2, 2]*pos.z,
+                null
+            );
+        }
+
+        /// <summary>
+        /// Calculates equatorial coordinates of a celestial body at many times, as seen by one observer.
+        /// </summary>
+        /// <remarks>
+        /// This function calculates the same coordinates as calling #Astronomy.Equator
+        /// once for each time in `ut`, but it writes the results into caller-supplied spans
+        /// instead of returning #Equatorial values. The only memory allocated is a pair of
+        /// rotation matrices that are reused for every time. For bodies other than the Sun
+        /// and the planets, such as the Moon, each position is calculated by #Astronomy.GeoVector,
+        /// which does allocate memory.
+        /// </remarks>
+        /// <param name="body">The celestial body to be observed. Not allowed to be `Body.Earth`.</param>
+        /// <param name="ut">The UT day values of the times, as in the `ut` field of #AstroTime.</param>
+        /// <param name="observer">A location on or near the surface of the Earth.</param>
+        /// <param name="equdate">Selects the date of the Earth's equator in which to express the equatorial coordinates.</param>
+        /// <param name="aberration">Selects whether or not to correct for aberration.</param>
+        /// <param name="ra">Receives the right ascension at each time, in sidereal hours.</param>
+        /// <param name="dec">Receives the declination at each time, in degrees.</param>
+        /// <param name="dist">Receives the distance to the body at each time, in AU.</param>
+        public static void EquatorBatch(
+            Body body,
+            ReadOnlySpan<double> ut,
+            Observer observer,
+            EquatorEpoch equdate,
+            Aberration aberration,
+            Span<double> ra,
+            Span<double> dec,
+            Span<double> dist)
+        {
+            if (equdate != EquatorEpoch.OfDate && equdate != EquatorEpoch.J2000)
+                throw new ArgumentException(string.Format("Unsupported equator epoch {0}", equdate));
+
+            if (aberration != Aberration.Corrected && aberration != Aberration.None)
+                throw new ArgumentException(string.Format("Unsupported aberration option {0}", aberration));
+
+            CheckBatchLength(ut.Length, ra.Length, "ra");
+            CheckBatchLength(ut.Length, dec.Length, "dec");
+            CheckBatchLength(ut.Length, dist.Length, "dist");
+
+            var prec = new double[3,3];
+            var nut = new double[3,3];
+            bool raw = (body == Body.Sun || (body != Body.Earth && IsVsopBody(body)));
+            for (int i = 0; i < ut.Length; ++i)
+            {
+                /* Same steps as geo_pos, GeoVector, and Equator, with the Earth's tilt calculated once per time. */
+                double psi, eps;
+                double tt = TerrestrialTime(ut[i]);
+                iau2000b(tt, out psi, out eps);
+                earth_tilt_t tilt = e_tilt(tt, psi, eps);
+                double gast = sidereal_time(ut[i], tt, tilt.ee);
+
+                AstroVector pos1 = terra(observer, gast);
+                nutation_rot(tilt, -1, nut);
+                AstroVector pos2 = RotateRaw(nut, pos1);
+                precession_rot(tt, 0.0, prec);
+                AstroVector gc_observer = RotateRaw(prec, pos2);
+
+                AstroVector gc;
+                if (raw)
+                {
+                    double gx, gy, gz;
+                    GeoVectorRaw(body, ut[i], tt, aberration, out gx, out gy, out gz);
+                    gc = new AstroVector(gx, gy, gz, null);
+                }
+                else
+                {
+                    gc = GeoVector(body, new AstroTime(ut[i]), aberration);
+                }
+
+                var j2000 = new AstroVector(gc.x - gc_observer.x, gc.y - gc_observer.y, gc.z - gc_observer.z, null);
+                Equatorial equ;
+                if (equdate == EquatorEpoch.OfDate)
+                {
+                    precession_rot(0.0, tt, prec);
+                    AstroVector temp = RotateRaw(prec, j2000);
+                    nutation_rot(tilt, 0, nut);
+                    equ = vector2radec(RotateRaw(nut, temp));
+                }
+                else
+                {
+                    equ = vector2radec(j2000);
+                }
+
+                ra[i] = equ.ra;
+                dec[i] = equ.dec;
+                dist[i] = equ.dist;
+            }
+        }
+
         /// <summary>
         /// Calculates the apparent location of a body relative to the local horizon of an observer on the Earth.
         /// </summary>
@@ -4047,6 +4311,16 @@ namespace CosineKitty
             double ra,
             double dec,
             Refraction refraction)
+        {
+            return HorizonGast(sidereal_time(time), observer, ra, dec, refraction);
+        }
+
+        private static Topocentric HorizonGast(
+            double gast,
+            Observer observer,
+            double ra,
+            double dec,
+            Refraction refraction)
         {
             double sinlat = Math.Sin(observer.latitude * DEG2RAD);
             double coslat = Math.Cos(observer.latitude * DEG2RAD);
@@ -4061,7 +4335,7 @@ namespace CosineKitty
             var une = new AstroVector(-sinlat * coslon, -sinlat * sinlon, coslat, null);
             var uwe = new AstroVector(sinlon, -coslon, 0.0, null);
 
-            double spin_angle = -15.0 * sidereal_time(time);
+            double spin_angle = -15.0 * gast;
             AstroVector uz = spin(spin_angle, uze);
             AstroVector un = spin(spin_angle, une);
             AstroVector uw = spin(spin_angle, uwe);
@@ -4124,6 +4398,56 @@ namespace CosineKitty
             return new Topocentric(az, 90.0 - zd, hor_ra, hor_dec);
         }
 
+        /// <summary>
+        /// Calculates horizontal coordinates of a body at many times, as seen by one observer.
+        /// </summary>
+        /// <remarks>
+        /// This function calculates the same coordinates as calling #Astronomy.Horizon
+        /// once for each element of the spans, but it writes the azimuth and altitude
+        /// into caller-supplied spans instead of returning #Topocentric values,
+        /// and it does not allocate any memory.
+        /// The spans `ra` and `dec` are typically filled in by #Astronomy.EquatorBatch
+        /// with `EquatorEpoch.OfDate` for the same times and observer.
+        /// </remarks>
+        /// <param name="ut">The UT day values of the times, as in the `ut` field of #AstroTime.</param>
+        /// <param name="observer">The geographic location of the observer.</param>
+        /// <param name="ra">The equator-of-date right ascension of the body at each time, in sidereal hours.</param>
+        /// <param name="dec">The equator-of-date declination of the body at each time, in degrees.</param>
+        /// <param name="refraction">
+        /// Selects whether to correct for atmospheric refraction, and if so, which model to use.
+        /// The recommended value for most uses is `Refraction.Normal`.
+        /// </param>
+        /// <param name="azimuth">Receives the azimuth at each time, in degrees clockwise from north.</param>
+        /// <param name="altitude">Receives the altitude above the horizon at each time, in degrees.</param>
+        public static void HorizonBatch(
+            ReadOnlySpan<double> ut,
+            Observer observer,
+            ReadOnlySpan<double> ra,
+            ReadOnlySpan<double> dec,
+            Refraction refraction,
+            Span<double> azimuth,
+            Span<double> altitude)
+        {
+            if (refraction != Refraction.None && refraction != Refraction.Normal && refraction != Refraction.JplHor)
+                throw new ArgumentException(string.Format("Unsupported refraction option {0}", refraction));
+
+            CheckBatchLength(ut.Length, ra.Length, "ra");
+            CheckBatchLength(ut.Length, dec.Length, "dec");
+            CheckBatchLength(ut.Length, azimuth.Length, "azimuth");
+            CheckBatchLength(ut.Length, altitude.Length, "altitude");
+
+            for (int i = 0; i < ut.Length; ++i)
+            {
+                double psi, eps;
+                double tt = TerrestrialTime(ut[i]);
+                iau2000b(tt, out psi, out eps);
+                double gast = sidereal_time(ut[i], tt, e_tilt(tt, psi, eps).ee);
+                Topocentric hor = HorizonGast(gast, observer, ra[i], dec[i], refraction);
+                azimuth[i] = hor.azimuth;
+                altitude[i] = hor.altitude;
+            }
+        }
+
         /// <summary>
         /// Calculates geocentric ecliptic coordinates for the Sun.
         /// </summary>
@@ -4826,6 +5150,44 @@ namespace CosineKitty
             }
         }
 
+        /// <summary>
+        /// Searches for rise or set times starting at many different times.
+        /// </summary>
+        /// <remarks>
+        /// This function is intended for generating tables of rise or set times,
+        /// for example the sunrise on each day of a year.
+        /// For each time in `startUt`, it performs the same search as #Astronomy.SearchRiseSet,
+        /// and writes the UT day value of the event into the caller-supplied span `eventUt`
+        /// instead of returning an #AstroTime object.
+        /// The searches themselves still allocate memory, but the table does not.
+        /// </remarks>
+        /// <param name="body">The Sun, Moon, or any planet other than the Earth.</param>
+        /// <param name="observer">The location where observation takes place.</param>
+        /// <param name="direction">Either `Direction.Rise` to find rise times or `Direction.Set` to find set times.</param>
+        /// <param name="startUt">The UT day values of the times at which to start the searches.</param>
+        /// <param name="limitDays">Limits how many days after each start time to search for a rise or set time.</param>
+        /// <param name="eventUt">
+        /// Receives the UT day value of each rise or set time.
+        /// An element is set to `double.NaN` when the event does not occur within `limitDays` days
+        /// of the start time; this is a normal condition, not an error.
+        /// </param>
+        public static void SearchRiseSetBatch(
+            Body body,
+            Observer observer,
+            Direction direction,
+            ReadOnlySpan<double> startUt,
+            double limitDays,
+            Span<double> eventUt)
+        {
+            CheckBatchLength(startUt.Length, eventUt.Length, "eventUt");
+
+            for (int i = 0; i < startUt.Length; ++i)
+            {
+                AstroTime time = SearchRiseSet(body, observer, direction, new AstroTime(startUt[i]), limitDays);
+                eventUt[i] = (time != null) ? time.ut : double.NaN;
+            }
+        }
+
         /// <summary>
         /// Searches for the time when a celestial body reaches a specified hour angle as seen by an observer on the Earth.
         /// </summary>
@@ -0,0 +1,286 @@
+/*
+    _astronomy.c  -  Don Cross <cosinekitty.com>
+
+    https://github.com/cosinekitty/astronomy
+
+    Optional compiled extension module for the Python version of Astronomy Engine.
+    It runs the batch functions in astronomy.py (HelioVectorBatch, EquatorBatch, HorizonBatch)
+    through the C version of Astronomy Engine in source/c/astronomy.c.
+    astronomy.py uses this module automatically when it can be imported;
+    otherwise it falls back to its own pure Python code.
+
+    Build it with the script build_native in this directory.
+
+    The functions here are private to astronomy.py. Each one takes arrays of
+    doubles through the buffer protocol (so numpy arrays and array.array('d')
+    both work without copying), writes its results into caller-provided arrays,
+    and returns an astro_status_t value. When compiled with ASTRONOMY_THREADS
+    (as build_native does by default), the calculations run with the GIL released,
+    so calls from several Python threads run in parallel.
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <string.h>
+#include "astronomy.h"
+
+/*
+    The C engine keeps caches in static variables unless it is compiled
+    with ASTRONOMY_THREADS. Releasing the GIL is only safe with thread-local caches,
+    so without ASTRONOMY_THREADS the calculations hold the GIL.
+*/
+#ifdef ASTRONOMY_THREADS
+#define BEGIN_CALC      Py_BEGIN_ALLOW_THREADS
+#define END_CALC        Py_END_ALLOW_THREADS
+#else
+#define BEGIN_CALC      {
+#define END_CALC        }
+#endif
+
+#define MAX_BUFFERS     8
+
+typedef struct
+{
+    int count;
+    Py_buffer view[MAX_BUFFERS];
+}
+buffer_list_t;
+
+static int IsDoubleFormat(const char *format)
+{
+    /* Accept native doubles: "d", "@d", "=d", and "<d" or ">d" when that is the native byte order. */
+    static const union { unsigned short u; unsigned char b[2]; } probe = { 1 };
+    const char native_order = probe.b[0] ? '<' : '>';
+
+    if (format == NULL)
+        return 0;
+
+    if (format[0] == '@' || format[0] == '=' || format[0] == native_order)
+        ++format;
+
+    return !strcmp(format, "d");
+}
+
+static double *GetArray(buffer_list_t *list, PyObject *obj, Py_ssize_t count, int writable, const char *name)
+{
+    Py_buffer *view;
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+
+    if (writable)
+        flags |= PyBUF_WRITABLE;
+
+    if (list->count >= MAX_BUFFERS)
+    {
+        PyErr_SetString(PyExc_RuntimeError, "too many array arguments");
+        return NULL;
+    }
+
+    view = &list->view[list->count];
+    if (PyObject_GetBuffer(obj, view, flags) != 0)
+        return NULL;
+    ++list->count;
+
+    if (view->itemsize != sizeof(double) || !IsDoubleFormat(view->format))
+    {
+        PyErr_Format(PyExc_TypeError, "%s must be an array of C doubles", name);
+        return NULL;
+    }
+
+    if (view->len != count * (Py_ssize_t)sizeof(double))
+    {
+        PyErr_Format(PyExc_ValueError, "%s must have %zd elements", name, count);
+        return NULL;
+    }
+
+    return (double *)view->buf;
+}
+
+static void ReleaseArrays(buffer_list_t *list)
+{
+    while (list->count > 0)
+        PyBuffer_Release(&list->view[--list->count]);
+}
+
+static int CheckCount(Py_ssize_t count)
+{
+    if (count < 0 || count > INT_MAX)
+    {
+        PyErr_SetString(PyExc_ValueError, "invalid number of elements");
+        return 1;
+    }
+    return 0;
+}
+
+static PyObject *helio_vector(PyObject *self, PyObject *args)
+{
+    int body;
+    Py_ssize_t count;
+    PyObject *ut_obj, *x_obj, *y_obj, *z_obj;
+    const double *ut;
+    double *tt, *x, *y, *z;
+    buffer_list_t list;
+    astro_status_t status = ASTRO_SUCCESS;
+    Py_ssize_t i;
+    (void)self;
+
+    if (!PyArg_ParseTuple(args, "inOOOO", &body, &count, &ut_obj, &x_obj, &y_obj, &z_obj))
+        return NULL;
+
+    if (CheckCount(count))
+        return NULL;
+
+    list.count = 0;
+    if (NULL == (ut = GetArray(&list, ut_obj, count, 0, "ut"))) goto fail;
+    if (NULL == (x  = GetArray(&list, x_obj,  count, 1, "x" ))) goto fail;
+    if (NULL == (y  = GetArray(&list, y_obj,  count, 1, "y" ))) goto fail;
+    if (NULL == (z  = GetArray(&list, z_obj,  count, 1, "z" ))) goto fail;
+
+    tt = PyMem_RawMalloc((count > 0 ? count : 1) * sizeof(double));
+    if (tt == NULL)
+    {
+        PyErr_NoMemory();
+        goto fail;
+    }
+
+    BEGIN_CALC
+    for (i = 0; i < count; ++i)
+        tt[i] = Astronomy_TimeFromDays(ut[i]).tt;
+    status = Astronomy_HelioVectorBatch((astro_body_t)body, (int)count, tt, x, y, z);
+    END_CALC
+
+    PyMem_RawFree(tt);
+    ReleaseArrays(&list);
+    return PyLong_FromLong((long)status);
+
+fail:
+    ReleaseArrays(&list);
+    return NULL;
+}
+
+static PyObject *equator(PyObject *self, PyObject *args)
+{
+    int body, ofdate, aberration;
+    Py_ssize_t count;
+    PyObject *ut_obj, *lat_obj, *lon_obj, *height_obj, *ra_obj, *dec_obj, *dist_obj;
+    const double *ut, *lat, *lon, *height;
+    double *ra, *dec, *dist;
+    buffer_list_t list;
+    astro_status_t status = ASTRO_SUCCESS;
+    Py_ssize_t i;
+    (void)self;
+
+    if (!PyArg_ParseTuple(args, "inOOOOppOOO", &body, &count, &ut_obj, &lat_obj, &lon_obj, &height_obj, &ofdate, &aberration, &ra_obj, &dec_obj, &dist_obj))
+        return NULL;
+
+    if (CheckCount(count))
+        return NULL;
+
+    list.count = 0;
+    if (NULL == (ut     = GetArray(&list, ut_obj,     count, 0, "ut"       ))) goto fail;
+    if (NULL == (lat    = GetArray(&list, lat_obj,    count, 0, "latitude" ))) goto fail;
+    if (NULL == (lon    = GetArray(&list, lon_obj,    count, 0, "longitude"))) goto fail;
+    if (NULL == (height = GetArray(&list, height_obj, count, 0, "height"   ))) goto fail;
+    if (NULL == (ra     = GetArray(&list, ra_obj,     count, 1, "ra"       ))) goto fail;
+    if (NULL == (dec    = GetArray(&list, dec_obj,    count, 1, "dec"      ))) goto fail;
+    if (NULL == (dist   = GetArray(&list, dist_obj,   count, 1, "dist"     ))) goto fail;
+
+    BEGIN_CALC
+    for (i = 0; i < count; ++i)
+    {
+        astro_time_t time = Astronomy_TimeFromDays(ut[i]);
+        astro_observer_t observer = Astronomy_MakeObserver(lat[i], lon[i], height[i]);
+        astro_equatorial_t equ = Astronomy_Equator(
+            (astro_body_t)body,
+            &time,
+            observer,
+            ofdate ? EQUATOR_OF_DATE : EQUATOR_J2000,
+            aberration ? ABERRATION : NO_ABERRATION);
+
+        if (equ.status != ASTRO_SUCCESS)
+        {
+            status = equ.status;
+            break;
+        }
+        ra[i] = equ.ra;
+        dec[i] = equ.dec;
+        dist[i] = equ.dist;
+    }
+    END_CALC
+
+    ReleaseArrays(&list);
+    return PyLong_FromLong((long)status);
+
+fail:
+    ReleaseArrays(&list);
+    return NULL;
+}
+
+static PyObject *horizon(PyObject *self, PyObject *args)
+{
+    int refraction;
+    Py_ssize_t count;
+    PyObject *ut_obj, *lat_obj, *lon_obj, *height_obj, *ra_obj, *dec_obj, *az_obj, *alt_obj;
+    const double *ut, *lat, *lon, *height, *ra, *dec;
+    double *az, *alt;
+    buffer_list_t list;
+    astro_status_t status = ASTRO_SUCCESS;
+    Py_ssize_t i;
+    (void)self;
+
+    if (!PyArg_ParseTuple(args, "nOOOOOOiOO", &count, &ut_obj, &lat_obj, &lon_obj, &height_obj, &ra_obj, &dec_obj, &refraction, &az_obj, &alt_obj))
+        return NULL;
+
+    if (CheckCount(count))
+        return NULL;
+
+    list.count = 0;
+    if (NULL == (ut     = GetArray(&list, ut_obj,     count, 0, "ut"       ))) goto fail;
+    if (NULL == (lat    = GetArray(&list, lat_obj,    count, 0, "latitude" ))) goto fail;
+    if (NULL == (lon    = GetArray(&list, lon_obj,    count, 0, "longitude"))) goto fail;
+    if (NULL == (height = GetArray(&list, height_obj, count, 0, "height"   ))) goto fail;
+    if (NULL == (ra     = GetArray(&list, ra_obj,     count, 0, "ra"       ))) goto fail;
+    if (NULL == (dec    = GetArray(&list, dec_obj,    count, 0, "dec"      ))) goto fail;
+    if (NULL == (az     = GetArray(&list, az_obj,     count, 1, "azimuth"  ))) goto fail;
+    if (NULL == (alt    = GetArray(&list, alt_obj,    count, 1, "altitude" ))) goto fail;
+
+    BEGIN_CALC
+    for (i = 0; i < count; ++i)
+    {
+        astro_time_t time = Astronomy_TimeFromDays(ut[i]);
+        astro_observer_t observer = Astronomy_MakeObserver(lat[i], lon[i], height[i]);
+        astro_horizon_t hor = Astronomy_Horizon(&time, observer, ra[i], dec[i], (astro_refraction_t)refraction);
+        az[i] = hor.azimuth;
+        alt[i] = hor.altitude;
+    }
+    END_CALC
+
+    ReleaseArrays(&list);
+    return PyLong_FromLong((long)status);
+
+fail:
+    ReleaseArrays(&list);
+    return NULL;
+}
+
+static PyMethodDef AstronomyMethods[] =
+{
+    { "helio_vector", helio_vector, METH_VARARGS, "Batch heliocentric vectors; see astronomy.HelioVectorBatch." },
+    { "equator",      equator,      METH_VARARGS, "Batch equatorial coordinates; see astronomy.EquatorBatch." },
+    { "horizon",      horizon,      METH_VARARGS, "Batch horizontal coordinates; see astronomy.HorizonBatch." },
+    { NULL, NULL, 0, NULL }
+};
+
+static struct PyModuleDef AstronomyModule =
+{
+    PyModuleDef_HEAD_INIT,
+    "_astronomy",
+    "Compiled batch functions for astronomy.py, built on the C version of Astronomy Engine.",
+    -1,
+    AstronomyMethods,
+    NULL, NULL, NULL, NULL
+};
+
+PyMODINIT_FUNC PyInit__astronomy(void)
+{
+    return PyModule_Create(&AstronomyModule);
+}
@@ -0,0 +1,152 @@
+/*
+    astronomy_wasm.c  -  Don Cross <cosinekitty.com>
+
+    https://github.com/cosinekitty/astronomy
+
+    Batch entry points exported from the WebAssembly build of Astronomy Engine.
+    The JavaScript binding astronomy_wasm.js copies typed arrays into the
+    WebAssembly memory, calls one of these functions once for the whole batch,
+    and copies the results back out.
+
+    Every function takes only numbers and pointers to arrays of doubles,
+    so the binding never has to lay out a C structure in memory.
+    Times are UT days since noon on January 1, 2000, the same as the `ut`
+    property of an AstroTime object in astronomy.js.
+    Each function returns an astro_status_t value.
+*/
+
+#include <math.h>
+#include "astronomy.h"
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#else
+#define EMSCRIPTEN_KEEPALIVE
+#endif
+
+EMSCRIPTEN_KEEPALIVE
+int Wasm_HelioVectorBatch(int body, int count, const double *ut, double *x, double *y, double *z)
+{
+    int i;
+
+    for (i = 0; i < count; ++i)
+    {
+        double pos[3];
+        double tt = Astronomy_TimeFromDays(ut[i]).tt;
+        astro_status_t status = Astronomy_HelioVectorRaw((astro_body_t)body, tt, pos);
+        if (status != ASTRO_SUCCESS)
+            return status;
+        x[i] = pos[0];
+        y[i] = pos[1];
+        z[i] = pos[2];
+    }
+
+    return ASTRO_SUCCESS;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int Wasm_EquatorBatch(
+    int body,
+    int count,
+    const double *ut,
+    const double *latitude,
+    const double *longitude,
+    const double *height,
+    int ofdate,
+    int aberration,
+    double *ra,
+    double *dec,
+    double *dist)
+{
+    int i;
+
+    for (i = 0; i < count; ++i)
+    {
+        astro_time_t time = Astronomy_TimeFromDays(ut[i]);
+        astro_observer_t observer = Astronomy_MakeObserver(latitude[i], longitude[i], height[i]);
+        astro_equatorial_t equ = Astronomy_Equator(
+            (astro_body_t)body,
+            &time,
+            observer,
+            ofdate ? EQUATOR_OF_DATE : EQUATOR_J2000,
+            aberration ? ABERRATION : NO_ABERRATION);
+
+        if (equ.status != ASTRO_SUCCESS)
+            return equ.status;
+
+        ra[i] = equ.ra;
+        dec[i] = equ.dec;
+        dist[i] = equ.dist;
+    }
+
+    return ASTRO_SUCCESS;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int Wasm_HorizonBatch(
+    int count,
+    const double *ut,
+    const double *latitude,
+    const double *longitude,
+    const double *height,
+    const double *ra,
+    const double *dec,
+    int refraction,
+    double *azimuth,
+    double *altitude)
+{
+    int i;
+
+    if (refraction < REFRACTION_NONE || refraction > REFRACTION_JPLHOR)
+        return ASTRO_INVALID_PARAMETER;
+
+    for (i = 0; i < count; ++i)
+    {
+        astro_time_t time = Astronomy_TimeFromDays(ut[i]);
+        astro_observer_t observer = Astronomy_MakeObserver(latitude[i], longitude[i], height[i]);
+        astro_horizon_t hor = Astronomy_Horizon(&time, observer, ra[i], dec[i], (astro_refraction_t)refraction);
+        azimuth[i] = hor.azimuth;
+        altitude[i] = hor.altitude;
+    }
+
+    return ASTRO_SUCCESS;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int Wasm_SearchRiseSetBatch(
+    int body,
+    double latitude,
+    double longitude,
+    double height,
+    int direction,
+    int count,
+    const double *start_ut,
+    double limit_days,
+    double *event_ut)
+{
+    int i;
+    astro_observer_t observer = Astronomy_MakeObserver(latitude, longitude, height);
+    astro_observer_state_t state = Astronomy_MakeObserverState(observer);
+
+    if (direction != DIRECTION_RISE && direction != DIRECTION_SET)
+        return ASTRO_INVALID_PARAMETER;
+
+    for (i = 0; i < count; ++i)
+    {
+        astro_search_result_t result = Astronomy_SearchRiseSetState(
+            (astro_body_t)body,
+            &state,
+            (astro_direction_t)direction,
+            Astronomy_TimeFromDays(start_ut[i]),
+            limit_days);
+
+        if (result.status == ASTRO_SUCCESS)
+            event_ut[i] = result.time.ut;
+        else if (result.status == ASTRO_SEARCH_FAILURE)
+            event_ut[i] = NAN;      /* no rise or set within limit_days, e.g. the polar midnight sun */
+        else
+            return result.status;
+    }
+
+    return ASTRO_SUCCESS;
+}
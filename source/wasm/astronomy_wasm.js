@@ -0,0 +1,343 @@
+/*
+    Astronomy Engine for WebAssembly.
+    https://github.com/cosinekitty/astronomy
+
+    MIT License
+
+    Copyright (c) 2019-2020 Don Cross <cosinekitty@gmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/**
+ * @fileoverview Thin JavaScript binding for the WebAssembly build of Astronomy Engine.
+ *
+ * The WebAssembly modules `astronomy.wasm` and `astronomy_simd.wasm` are compiled
+ * from `source/c/astronomy.c` by the `build` script in this directory.
+ * This binding loads whichever one the JavaScript engine supports and
+ * exposes batch functions that take and return typed arrays.
+ * Each batch crosses into WebAssembly only once, however many elements it has.
+ *
+ * Times are expressed as UT days since noon on January 1, 2000:
+ * the `ut` property of an `Astronomy.AstroTime` object in `astronomy.js`.
+ *
+ * @author Don Cross <cosinekitty@gmail.com>
+ * @license MIT
+ */
+'use strict';
+
+/**
+ * @name AstronomyWasm
+ * @namespace AstronomyWasm
+ */
+(function(AstronomyWasm){
+'use strict';
+
+/* Body names in the order of the C enumerated type astro_body_t. */
+const BodyNames = [
+    'Mercury', 'Venus', 'Earth', 'Mars', 'Jupiter', 'Saturn', 'Uranus', 'Neptune', 'Pluto',
+    'Sun', 'Moon', 'EMB', 'SSB'
+];
+
+/* Names of the C astro_status_t values, for error messages. */
+const StatusNames = [
+    'ASTRO_SUCCESS', 'ASTRO_NOT_INITIALIZED', 'ASTRO_INVALID_BODY', 'ASTRO_NO_CONVERGE',
+    'ASTRO_BAD_TIME', 'ASTRO_BAD_VECTOR', 'ASTRO_SEARCH_FAILURE', 'ASTRO_EARTH_NOT_ALLOWED',
+    'ASTRO_NO_MOON_QUARTER', 'ASTRO_WRONG_MOON_QUARTER', 'ASTRO_INTERNAL_ERROR',
+    'ASTRO_INVALID_PARAMETER', 'ASTRO_FAIL_NEPTUNE_APSIS', 'ASTRO_SEARCH_PENDING'
+];
+
+/*
+    The smallest module that uses a SIMD instruction.
+    WebAssembly.validate() accepts it only if the engine supports 128-bit SIMD.
+*/
+const SimdProbe = new Uint8Array([
+    0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0,
+    10, 10, 1, 8, 0, 65, 0, 253, 15, 253, 98, 11
+]);
+
+function BodyCode(body) {
+    const code = BodyNames.indexOf(body);
+    if (code < 0)
+        throw `Invalid body name: ${body}`;
+    return code;
+}
+
+function RefractionCode(refraction) {
+    if (!refraction)
+        return 0;
+    if (refraction === 'normal')
+        return 1;
+    if (refraction === 'jplhor')
+        return 2;
+    throw `Invalid refraction option: ${refraction}`;
+}
+
+function CheckStatus(funcName, status) {
+    if (status !== 0)
+        throw `${funcName}: WebAssembly engine returned ${StatusNames[status] || status}`;
+}
+
+function IsNode() {
+    return (typeof process !== 'undefined') && process.versions && process.versions.node;
+}
+
+async function LoadBytes(filename, baseUrl) {
+    if (IsNode() && !baseUrl) {
+        const fs = require('fs');
+        const path = require('path');
+        return fs.readFileSync(path.join(__dirname, filename));
+    }
+    const response = await fetch((baseUrl || '') + filename);
+    if (!response.ok)
+        throw `Cannot load ${filename}: HTTP status ${response.status}`;
+    return await response.arrayBuffer();
+}
+
+function MakeImports(module) {
+    /*
+        The modules are built standalone, so they import almost nothing.
+        Satisfy whatever imports there are with stubs: the only one the batch
+        functions can reach is the notification that memory has grown.
+    */
+    const imports = {};
+    for (let imp of WebAssembly.Module.imports(module)) {
+        if (imp.kind !== 'function')
+            continue;
+        imports[imp.module] = imports[imp.module] || {};
+        imports[imp.module][imp.name] = (imp.name === 'emscripten_notify_memory_growth')
+            ? function() {}
+            : function() { throw `WebAssembly engine called unexpected import ${imp.module}.${imp.name}`; };
+    }
+    return imports;
+}
+
+/**
+ * @brief The WebAssembly version of Astronomy Engine, ready to use.
+ *
+ * Obtain an instance by calling {@link AstronomyWasm.Load}.
+ *
+ * Every batch function takes arrays of numbers. They can be typed arrays
+ * like `Float64Array` or ordinary arrays. Where the documentation says
+ * a parameter is a number or an array, a single number applies to every element.
+ * The results are returned as `Float64Array` objects.
+ *
+ * @class
+ * @memberof AstronomyWasm
+ *
+ * @property {boolean} simd
+ *      `true` if the SIMD build of the module was loaded.
+ */
+class Engine {
+    constructor(instance, simd) {
+        this.exports = instance.exports;
+        this.simd = simd;
+        if (this.exports._initialize)
+            this.exports._initialize();
+    }
+
+    _Call(funcName, count, inputs, noutputs, call) {
+        /* Allocate one block for all the arrays, copy the inputs in, call, and copy the outputs out. */
+        const narrays = inputs.length + noutputs;
+        const base = this.exports.malloc(8 * Math.max(1, count * narrays));
+        if (!base)
+            throw `${funcName}: out of WebAssembly memory`;
+        try {
+            /* Create the view after malloc, because growing the memory detaches older views. */
+            const heap = new Float64Array(this.exports.memory.buffer);
+            const ptr = [];
+            for (let k = 0; k < narrays; ++k)
+                ptr.push(base + 8*count*k);
+            for (let k = 0; k < inputs.length; ++k) {
+                const offset = ptr[k] / 8;
+                const value = inputs[k];
+                if (typeof value === 'number')
+                    heap.fill(value, offset, offset + count);
+                else if (value.length !== count)
+                    throw `${funcName}: input array ${k} has ${value.length} elements, but ${count} are required.`;
+                else
+                    heap.set(value, offset);
+            }
+            CheckStatus(funcName, call(ptr));
+            const outputs = [];
+            for (let k = inputs.length; k < narrays; ++k)
+                outputs.push(new Float64Array(this.exports.memory.buffer, ptr[k], count).slice());
+            return outputs;
+        } finally {
+            this.exports.free(base);
+        }
+    }
+
+    /**
+     * @brief Calculates heliocentric positions of a body for many times.
+     *
+     * Batch version of `Astronomy.HelioVector`.
+     *
+     * @param {string} body
+     *      One of the names in `Astronomy.Bodies`.
+     *
+     * @param {Float64Array | number[]} ut
+     *      The times, as UT days since noon on January 1, 2000.
+     *
+     * @returns {{x: Float64Array, y: Float64Array, z: Float64Array}}
+     *      Coordinates in AU, in the J2000 equatorial orientation.
+     */
+    HelioVectorBatch(body, ut) {
+        const code = BodyCode(body);
+        const count = ut.length;
+        const [x, y, z] = this._Call('HelioVectorBatch', count, [ut], 3,
+            p => this.exports.Wasm_HelioVectorBatch(code, count, p[0], p[1], p[2], p[3]));
+        return { x, y, z };
+    }
+
+    /**
+     * @brief Calculates equatorial coordinates of a body for many times and observers.
+     *
+     * Batch version of `Astronomy.Equator`.
+     *
+     * @param {string} body
+     *      The body to observe. Not allowed to be `"Earth"`.
+     *
+     * @param {Float64Array | number[]} ut
+     *      The times, as UT days since noon on January 1, 2000.
+     *
+     * @param {{latitude: (number | Float64Array), longitude: (number | Float64Array), height: (number | Float64Array)}} observer
+     *      Either an `Astronomy.Observer`, or an object whose properties are
+     *      arrays with one element per time.
+     *
+     * @param {boolean} ofdate
+     *      `true` for coordinates in the equator of date, `false` for J2000.
+     *
+     * @param {boolean} aberration
+     *      `true` to correct for aberration.
+     *
+     * @returns {{ra: Float64Array, dec: Float64Array, dist: Float64Array}}
+     *      Right ascensions in sidereal hours, declinations in degrees, and distances in AU.
+     */
+    EquatorBatch(body, ut, observer, ofdate, aberration) {
+        const code = BodyCode(body);
+        const count = ut.length;
+        const inputs = [ut, observer.latitude, observer.longitude, observer.height];
+        const [ra, dec, dist] = this._Call('EquatorBatch', count, inputs, 3,
+            p => this.exports.Wasm_EquatorBatch(code, count, p[0], p[1], p[2], p[3], ofdate ? 1 : 0, aberration ? 1 : 0, p[4], p[5], p[6]));
+        return { ra, dec, dist };
+    }
+
+    /**
+     * @brief Calculates horizontal coordinates for many times and observers.
+     *
+     * Batch version of `Astronomy.Horizon`.
+     *
+     * @param {Float64Array | number[]} ut
+     *      The times, as UT days since noon on January 1, 2000.
+     *
+     * @param {{latitude: (number | Float64Array), longitude: (number | Float64Array), height: (number | Float64Array)}} observer
+     *      Either an `Astronomy.Observer`, or an object whose properties are
+     *      arrays with one element per time.
+     *
+     * @param {number | Float64Array} ra
+     *      Equator-of-date right ascensions in sidereal hours.
+     *
+     * @param {number | Float64Array} dec
+     *      Equator-of-date declinations in degrees.
+     *
+     * @param {string} refraction
+     *      The same as for `Astronomy.Horizon`: a false-like value, `"normal"`, or `"jplhor"`.
+     *
+     * @returns {{azimuth: Float64Array, altitude: Float64Array}}
+     *      Horizontal angles in degrees.
+     */
+    HorizonBatch(ut, observer, ra, dec, refraction) {
+        const refr = RefractionCode(refraction);
+        const count = ut.length;
+        const inputs = [ut, observer.latitude, observer.longitude, observer.height, ra, dec];
+        const [azimuth, altitude] = this._Call('HorizonBatch', count, inputs, 2,
+            p => this.exports.Wasm_HorizonBatch(count, p[0], p[1], p[2], p[3], p[4], p[5], refr, p[6], p[7]));
+        return { azimuth, altitude };
+    }
+
+    /**
+     * @brief Searches for rise or set times of a body, starting from many times.
+     *
+     * Batch version of `Astronomy.SearchRiseSet`, for one observer.
+     * This is how to fill a long table of rise or set times in one call.
+     *
+     * @param {string} body
+     *      The Sun, Moon, or any planet other than the Earth.
+     *
+     * @param {Astronomy.Observer} observer
+     *      The location of the observer.
+     *
+     * @param {number} direction
+     *      +1 to find rise times, or -1 to find set times.
+     *
+     * @param {Float64Array | number[]} startUt
+     *      The times at which to start each search, as UT days since noon on January 1, 2000.
+     *
+     * @param {number} limitDays
+     *      How many days after each start time to search.
+     *
+     * @returns {Float64Array}
+     *      The UT day value of each event, or `NaN` where the body
+     *      does not rise or set within `limitDays` of the start time.
+     */
+    SearchRiseSetBatch(body, observer, direction, startUt, limitDays) {
+        const code = BodyCode(body);
+        const count = startUt.length;
+        const [eventUt] = this._Call('SearchRiseSetBatch', count, [startUt], 1,
+            p => this.exports.Wasm_SearchRiseSetBatch(code, observer.latitude, observer.longitude, observer.height, direction, count, p[0], limitDays, p[1]));
+        return eventUt;
+    }
+}
+AstronomyWasm.Engine = Engine;
+
+/**
+ * @brief Returns `true` if the JavaScript engine supports WebAssembly SIMD.
+ *
+ * @returns {boolean}
+ */
+AstronomyWasm.SimdSupported = function() {
+    return (typeof WebAssembly === 'object') && WebAssembly.validate(SimdProbe);
+}
+
+/**
+ * @brief Loads the WebAssembly version of Astronomy Engine.
+ *
+ * Loads `astronomy_simd.wasm` if the JavaScript engine supports WebAssembly SIMD,
+ * otherwise `astronomy.wasm`.
+ * In Node.js the file is read from the directory containing this script.
+ * In a browser it is fetched relative to `options.baseUrl`.
+ *
+ * @param {{baseUrl: string, simd: boolean}} [options]
+ *      `baseUrl` is prepended to the module's filename when fetching it.
+ *      `simd` forces the SIMD build (`true`) or the plain build (`false`)
+ *      instead of detecting support automatically.
+ *
+ * @returns {Promise<AstronomyWasm.Engine>}
+ */
+AstronomyWasm.Load = async function(options) {
+    options = options || {};
+    const simd = (options.simd === undefined) ? AstronomyWasm.SimdSupported() : !!options.simd;
+    const bytes = await LoadBytes(simd ? 'astronomy_simd.wasm' : 'astronomy.wasm', options.baseUrl);
+    const module = await WebAssembly.compile(bytes);
+    const instance = await WebAssembly.instantiate(module, MakeImports(module));
+    return new Engine(instance, simd);
+}
+
+})(typeof exports==='undefined' ? (this.AstronomyWasm={}) : exports);